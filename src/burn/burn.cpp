@@ -78,12 +78,19 @@ INT16* pBurnSoundOut = NULL;		// pointer to output buffer
 
 INT32 nInterpolation   = 1;			// Desired interpolation level for ADPCM/PCM sound
 INT32 nFMInterpolation = 0;			// Desired interpolation level for FM sound
+INT32 nFMSynthesis     = 0;			// FM operator path: 0 = scalar, 1 = SIMD, 2 = SIMD checked against scalar
 
 UINT8 nBurnLayer    = 0xFF;			// Can be used externally to select which layers to show
 UINT8 nSpriteEnable = 0xFF;			// Can be used externally to select which layers to show
 
 INT32 bRunAhead = 0;
 
+INT32 bBurnVideoThreading = 0;			// let the roz, CPS layer, vector and polygon renderers hand part of a frame to worker threads
+
+INT32 bBurnSkipUnchangedFrames = 0;
+INT32 bBurnFrameUnchanged = 0;
+static INT32 bVideoHashValid = 0;		// BurnVideoUnchanged() has a frame to compare against
+
 INT32 nMaxPlayers;
 
 bool bSaveCRoms = 0;
@@ -175,6 +182,8 @@ extern "C" INT32 BurnLibExit()
 {
 	BurnGameListExit();
 
+	HiscoreIndexExit();
+
 	nBurnDrvCount = 0;
 
 	return 0;
@@ -872,6 +881,7 @@ extern "C" INT32 BurnDrvInit()
 
 	BurnCacheSizeAspect_Internal();
 
+	BurnPersistInit();
 	CheatInit();
 	HiscoreInit();
 	BurnStateInit();
@@ -885,6 +895,8 @@ extern "C" INT32 BurnDrvInit()
 	BurnRandomInit();
 	BurnSoundDCFilterReset();
 	BurnTimerPreInit();
+	bVideoHashValid = 0;
+	bBurnFrameUnchanged = 0;
 
 	nReturnValue = pDriver[nBurnDrvActive]->Init();	// Forward to drivers function
 
@@ -959,6 +971,7 @@ extern "C" INT32 BurnDrvExit()
 
 	nBurnDrvSubActive = -1;	// Rest to -1;
 
+	BurnPersistExit();	// after the driver's Exit(), devices save their data there
 	BurnExitMemoryManager();
 #if defined FBNEO_DEBUG
 	DebugTrackerExit();
@@ -1005,14 +1018,18 @@ INT32 BurnDrvCartridgeSetup(BurnCartrigeCommand nCommand)
 // Do one frame of game emulation
 extern "C" INT32 BurnDrvFrame()
 {
+	bBurnFrameUnchanged = 0;
 	CheatApply();									// Apply cheats (if any)
 	HiscoreApply();
+	BurnPersistFrame();
 	return pDriver[nBurnDrvActive]->Frame();		// Forward to drivers function
 }
 
 // Force redraw of the screen
 extern "C" INT32 BurnDrvRedraw()
 {
+	bVideoHashValid = 0;							// the front end wants a picture, whatever changed
+
 	if (pDriver[nBurnDrvActive]->Redraw) {
 		return pDriver[nBurnDrvActive]->Redraw();	// Forward to drivers function
 	}
@@ -1223,6 +1240,68 @@ INT32 BurnAreaScan(INT32 nAction, INT32* pnMin)
 	return nRet;
 }
 
+// --------- Frame change detection ----------
+static UINT64 nVideoHash = 0;
+static UINT64 nVideoHashRun = 0;
+static INT32 nVideoAreas = 0;
+
+// not a checksum - only has to tell this frame from the last one, 8 bytes per step
+static UINT64 VideoHashBlock(const UINT8 *p, UINT32 nLen, UINT64 h)
+{
+	const UINT64 k = 0x9e3779b97f4a7c15ULL;
+
+	for (; nLen >= 8; nLen -= 8, p += 8) {
+		UINT64 v;
+		memcpy(&v, p, 8);
+		h ^= v;
+		h = ((h << 27) | (h >> 37)) * k;
+	}
+
+	if (nLen) {
+		UINT64 v = 0;
+		memcpy(&v, p, nLen);
+		h ^= v ^ ((UINT64)nLen << 56);
+		h = ((h << 27) | (h >> 37)) * k;
+	}
+
+	return h;
+}
+
+static INT32 __cdecl VideoHashAcb(struct BurnArea* pba)
+{
+	nVideoHashRun = VideoHashBlock((UINT8*)pba->Data, pba->nLen, nVideoHashRun);
+	nVideoAreas++;
+
+	return 0;
+}
+
+INT32 BurnVideoUnchanged()
+{
+	// only frames that actually reach pBurnDraw count, the front end re-presents the last of those
+	if (!bBurnSkipUnchangedFrames || pBurnDraw == NULL) return 0;
+
+	UINT8 *pRecalc = pDriver[nBurnDrvActive]->pRecalcPal;
+	INT32 nSettings[4] = { nBurnLayer, nSpriteEnable, nBurnBpp, nBurnPitch };
+
+	INT32 (__cdecl *pOldAcb)(struct BurnArea* pba) = BurnAcb;
+
+	nVideoHashRun = VideoHashBlock((UINT8*)nSettings, sizeof(nSettings), 0);
+	nVideoAreas = 0;
+
+	BurnAcb = VideoHashAcb;
+	BurnAreaScan(ACB_VIDEO | ACB_READ, NULL);
+	BurnAcb = pOldAcb;
+
+	INT32 bUnchanged = bVideoHashValid && nVideoAreas && nVideoHashRun == nVideoHash && (pRecalc == NULL || *pRecalc == 0);
+
+	nVideoHash = nVideoHashRun;
+	bVideoHashValid = (nVideoAreas != 0);
+
+	if (bUnchanged) bBurnFrameUnchanged = 1;
+
+	return bUnchanged;
+}
+
 // --------- State-ing for RunAhead ----------
 // for drivers, hiscore, etc, to recognize that this is the "runahead frame"
 INT32 bBurnRunAheadFrame = 0;
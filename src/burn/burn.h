@@ -122,6 +122,7 @@ __extension__ typedef long long				INT64;
 #include "state.h"
 #include "cheat.h"
 #include "hiscore.h"
+#include "burn_persist.h"
 
 extern INT32 nBurnVer;						// Version number of the library
 
@@ -369,12 +370,17 @@ extern INT32 bRunAhead;				// "Run Ahead" lag-reduction technique UI option (on/
 extern INT32 bBurnRunAheadFrame;	// for drivers, hiscore, etc, to recognize that this is the "runahead frame"
 									// for instance, you wouldn't want to apply hi-score data on a "runahead frame"
 
+extern INT32 bBurnVideoThreading;		// front end: let the roz, CPS layer, vector and polygon renderers use worker threads (read at driver init)
+extern INT32 bBurnSkipUnchangedFrames;	// front end: set when it can present the previous frame again by itself
+extern INT32 bBurnFrameUnchanged;	// set by BurnDrvFrame() when the driver found nothing changed and didn't draw
+
 extern INT32 nBurnSoundRate;		// Samplerate of sound
 extern INT32 nBurnSoundLen;			// Length in samples per frame
 extern INT16* pBurnSoundOut;		// Pointer to output buffer
 
 extern INT32 nInterpolation;		// Desired interpolation level for ADPCM/PCM sound
 extern INT32 nFMInterpolation;		// Desired interpolation level for FM sound
+extern INT32 nFMSynthesis;			// FM operator path: 0 = scalar, 1 = SIMD, 2 = SIMD checked against scalar
 
 extern UINT32 *pBurnDrvPalette;
 
@@ -0,0 +1,384 @@
+// Background persistence of NVRAM / EEPROM / hiscore data
+//
+// The emulation thread only takes the snapshots (a memcpy / cheat-read of a few
+// KB every nBurnPersistFrames frames), the file i/o runs on a thready worker.
+// A write goes to "file.tmp" first, is flushed to disk and then renamed over
+// "file", so a crash or power loss leaves either the old or the new file.
+
+#include "burnint.h"
+#include "thready.h"
+
+#if defined (__LIBRETRO__)
+#include "streams/file_stream.h"
+#elif defined (_WIN32)
+#include <windows.h>
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+INT32 nBurnPersistFrames = 300;		// snapshot interval in frames, 0 = write at exit only
+
+#define PERSIST_MAX_SOURCES		8
+#define PERSIST_TRAILER_LEN		12	// "FBNC", payload length, crc32 (little endian)
+
+struct PersistSource {
+	TCHAR szFilename[MAX_PATH];
+	INT32 nLen;
+	BurnPersistSnapshotCB pSnapshot;
+	UINT8 *pSnap;			// scratch snapshot (emulation thread)
+	UINT8 *pWrite;			// last data handed to the writer
+	INT32 bWritten;			// pWrite is on disk (or queued)
+	INT32 bDirty;			// queued for the writer
+	INT32 bFailed;			// set by the writer, reported & retried by the emulation thread
+};
+
+static PersistSource PersistSources[PERSIST_MAX_SOURCES];
+static INT32 bPersistThread = 0;
+static volatile INT32 bPersistBusy = 0;
+static INT32 nPersistFrame = 0;
+
+static UINT32 PersistCrcTable[256];
+
+static void PersistCrcInit()
+{
+	if (PersistCrcTable[1]) return;
+
+	for (UINT32 i = 0; i < 256; i++) {
+		UINT32 c = i;
+		for (INT32 k = 0; k < 8; k++) {
+			c = (c & 1) ? (0xedb88320 ^ (c >> 1)) : (c >> 1);
+		}
+		PersistCrcTable[i] = c;
+	}
+}
+
+static UINT32 PersistCrc(const UINT8 *pData, INT32 nLen)
+{
+	UINT32 crc = 0xffffffff;
+
+	PersistCrcInit();
+
+	for (INT32 i = 0; i < nLen; i++) {
+		crc = PersistCrcTable[(crc ^ pData[i]) & 0xff] ^ (crc >> 8);
+	}
+
+	return crc ^ 0xffffffff;
+}
+
+static void PersistPut32(UINT8 *p, UINT32 v)
+{
+	p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24;
+}
+
+static UINT32 PersistGet32(const UINT8 *p)
+{
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((UINT32)p[3] << 24);
+}
+
+static void PersistDelete(const TCHAR *szFilename)
+{
+#if defined (__LIBRETRO__)
+	filestream_delete(szFilename);
+#elif defined (_WIN32) && defined (_UNICODE)
+	DeleteFileW(szFilename);
+#elif defined (_WIN32)
+	DeleteFileA(szFilename);
+#else
+	remove(szFilename);
+#endif
+}
+
+static INT32 PersistRename(const TCHAR *szFrom, const TCHAR *szTo)
+{
+#if defined (__LIBRETRO__)
+	if (filestream_rename(szFrom, szTo) == 0) return 0;
+
+	// some vfs backends won't replace an existing file, the .tmp covers the gap
+	filestream_delete(szTo);
+	return filestream_rename(szFrom, szTo) ? 1 : 0;
+#elif defined (_WIN32) && defined (_UNICODE)
+	return MoveFileExW(szFrom, szTo, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) ? 0 : 1;
+#elif defined (_WIN32)
+	return MoveFileExA(szFrom, szTo, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) ? 0 : 1;
+#else
+	return rename(szFrom, szTo) ? 1 : 0;
+#endif
+}
+
+static INT32 PersistWrite(const TCHAR *szFilename, const UINT8 *pData, INT32 nLen)
+{
+	TCHAR szTemp[MAX_PATH + 8];
+	UINT8 Trailer[PERSIST_TRAILER_LEN];
+	INT32 bOk = 1;
+
+	_stprintf(szTemp, _T("%s.tmp"), szFilename);
+
+	FILE *fp = _tfopen(szTemp, _T("wb"));
+	if (fp == NULL) return 1;
+
+	memcpy(Trailer, "FBNC", 4);
+	PersistPut32(Trailer + 4, nLen);
+	PersistPut32(Trailer + 8, PersistCrc(pData, nLen));
+
+	if (nLen && fwrite(pData, 1, nLen, fp) != (size_t)nLen) bOk = 0;
+	if (fwrite(Trailer, 1, PERSIST_TRAILER_LEN, fp) != PERSIST_TRAILER_LEN) bOk = 0;
+	if (fflush(fp)) bOk = 0;
+
+	// the data has to be on disk before the rename makes it the live file
+#if defined (__LIBRETRO__)
+	// (no descriptor behind a vfs stream, the flush above is all we get)
+#elif defined (_WIN32)
+	if (_commit(_fileno(fp))) bOk = 0;
+#else
+	if (fsync(fileno(fp))) bOk = 0;
+#endif
+
+	fclose(fp);
+
+	if (!bOk) {
+		PersistDelete(szTemp);
+		return 1;
+	}
+
+	return PersistRename(szTemp, szFilename);
+}
+
+// reads a whole file, returns the payload length (trailer stripped) or -1
+static INT32 PersistRead(const TCHAR *szFilename, UINT8 *pDest, INT32 nMaxLen, INT32 bNeedTrailer)
+{
+	FILE *fp = _tfopen(szFilename, _T("rb"));
+	if (fp == NULL) return -1;
+
+	fseek(fp, 0, SEEK_END);
+	INT32 nSize = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+
+	if (nSize < 0) {
+		fclose(fp);
+		return -1;
+	}
+
+	UINT8 *pBuf = (UINT8*)malloc(nSize + 1);
+	if (pBuf == NULL) {
+		fclose(fp);
+		return -1;
+	}
+
+	nSize = fread(pBuf, 1, nSize, fp);
+	fclose(fp);
+
+	INT32 nLen = nSize;
+
+	if (nSize >= PERSIST_TRAILER_LEN && memcmp(pBuf + nSize - PERSIST_TRAILER_LEN, "FBNC", 4) == 0 && PersistGet32(pBuf + nSize - 8) == (UINT32)(nSize - PERSIST_TRAILER_LEN)) {
+		nLen = nSize - PERSIST_TRAILER_LEN;
+		if (PersistGet32(pBuf + nSize - 4) != PersistCrc(pBuf, nLen)) {
+			bprintf(PRINT_ERROR, _T("*** %s is corrupt (checksum mismatch), ignoring it\n"), szFilename);
+			nLen = -1;
+		}
+	} else if (bNeedTrailer) {
+		nLen = -1;
+	}
+
+	if (nLen > 0) {
+		memcpy(pDest, pBuf, (nLen < nMaxLen) ? nLen : nMaxLen);
+	}
+
+	free(pBuf);
+
+	return (nLen < nMaxLen) ? nLen : nMaxLen;
+}
+
+INT32 BurnPersistLoad(const TCHAR *szFilename, UINT8 *pDest, INT32 nMaxLen)
+{
+	INT32 nRet = PersistRead(szFilename, pDest, nMaxLen, 0);
+
+	if (nRet < 0) {
+		// a complete .tmp means we went down between writing it and the rename
+		TCHAR szTemp[MAX_PATH + 8];
+		_stprintf(szTemp, _T("%s.tmp"), szFilename);
+
+		nRet = PersistRead(szTemp, pDest, nMaxLen, 1);
+	}
+
+	return nRet;
+}
+
+INT32 BurnPersistSave(const TCHAR *szFilename, const UINT8 *pData, INT32 nLen)
+{
+	// don't race the worker on the same file
+	if (bPersistThread) {
+		thready.notify_wait();
+		bPersistBusy = 0;
+	}
+
+	return PersistWrite(szFilename, pData, nLen);
+}
+
+static void PersistWriterThread()
+{
+	for (INT32 i = 0; i < PERSIST_MAX_SOURCES; i++) {
+		PersistSource *src = &PersistSources[i];
+
+		if (src->bDirty) {
+			src->bFailed = PersistWrite(src->szFilename, src->pWrite, src->nLen);
+			src->bDirty = 0;
+		}
+	}
+
+	bPersistBusy = 0;
+}
+
+// takes a snapshot, returns 1 when it differs from what was written last
+static INT32 PersistSnapshot(PersistSource *src)
+{
+	if (src->pSnapshot(src->pSnap, src->nLen)) return 0;
+
+	if (src->bWritten && memcmp(src->pSnap, src->pWrite, src->nLen) == 0) return 0;
+
+	UINT8 *pTemp = src->pWrite;
+	src->pWrite = src->pSnap;
+	src->pSnap = pTemp;
+
+	return 1;
+}
+
+void BurnPersistInit()
+{
+	if (bPersistThread) BurnPersistExit(); // previous init failed without an exit
+
+	memset(PersistSources, 0, sizeof(PersistSources));
+
+	nPersistFrame = 0;
+	bPersistBusy = 0;
+}
+
+// the writer is only started once something registers, most games never do
+static void PersistThreadStart()
+{
+	if (bPersistThread) return;
+
+	thready.init(PersistWriterThread);
+	thready.set_threading(1);
+	bPersistThread = 1;
+}
+
+void BurnPersistFrame()
+{
+	if (!bPersistThread || nBurnPersistFrames <= 0 || bBurnRunAheadFrame) return;
+
+	if (++nPersistFrame < nBurnPersistFrames) return;
+
+	// the worker is still busy with the last round (slow media), try again next frame
+	if (bPersistBusy) return;
+
+	nPersistFrame = 0;
+
+	thready.notify_wait();
+
+	INT32 bQueued = 0;
+
+	for (INT32 i = 0; i < PERSIST_MAX_SOURCES; i++) {
+		PersistSource *src = &PersistSources[i];
+
+		if (src->pSnapshot == NULL) continue;
+
+		if (src->bFailed) {
+			bprintf(PRINT_ERROR, _T("*** Couldn't write %s, will retry\n"), src->szFilename);
+			src->bFailed = 0;
+			src->bWritten = 0;
+		}
+
+		if (PersistSnapshot(src)) {
+			src->bWritten = 1;
+			src->bDirty = 1;
+			bQueued = 1;
+		}
+	}
+
+	if (bQueued) {
+		bPersistBusy = 1;
+		thready.notify();
+	}
+}
+
+INT32 BurnPersistAdd(const TCHAR *szFilename, INT32 nLen, BurnPersistSnapshotCB pSnapshot)
+{
+	if (nLen <= 0 || pSnapshot == NULL) return -1;
+
+	INT32 nSlot = -1;
+
+	for (INT32 i = 0; i < PERSIST_MAX_SOURCES; i++) {
+		if (PersistSources[i].pSnapshot && _tcsncmp(PersistSources[i].szFilename, szFilename, MAX_PATH) == 0) {
+			BurnPersistRemove(i, 0); // re-registered (device initialised twice)
+		}
+		if (nSlot == -1 && PersistSources[i].pSnapshot == NULL) {
+			nSlot = i;
+		}
+	}
+
+	if (nSlot == -1) {
+		bprintf(PRINT_ERROR, _T("BurnPersistAdd: no free slot for %s\n"), szFilename);
+		return -1;
+	}
+
+	PersistSource *src = &PersistSources[nSlot];
+
+	memset(src, 0, sizeof(PersistSource));
+	_tcsncpy(src->szFilename, szFilename, MAX_PATH - 1);
+	src->nLen = nLen;
+	src->pSnap = (UINT8*)malloc(nLen);
+	src->pWrite = (UINT8*)malloc(nLen);
+
+	if (src->pSnap == NULL || src->pWrite == NULL) {
+		free(src->pSnap);
+		free(src->pWrite);
+		memset(src, 0, sizeof(PersistSource));
+		return -1;
+	}
+
+	src->pSnapshot = pSnapshot;
+
+	PersistThreadStart();
+
+	return nSlot;
+}
+
+void BurnPersistRemove(INT32 nSlot, INT32 bSave)
+{
+	if (nSlot < 0 || nSlot >= PERSIST_MAX_SOURCES) return;
+
+	PersistSource *src = &PersistSources[nSlot];
+
+	if (src->pSnapshot == NULL) return;
+
+	if (bPersistThread) {
+		thready.notify_wait();
+		bPersistBusy = 0;
+	}
+
+	if (bSave && src->pSnapshot(src->pSnap, src->nLen) == 0) {
+		if (PersistWrite(src->szFilename, src->pSnap, src->nLen)) {
+			bprintf(PRINT_ERROR, _T("*** Couldn't write %s\n"), src->szFilename);
+		}
+	}
+
+	free(src->pSnap);
+	free(src->pWrite);
+	memset(src, 0, sizeof(PersistSource));
+}
+
+void BurnPersistExit()
+{
+	if (bPersistThread) {
+		thready.notify_wait();
+		thready.exit();
+		bPersistThread = 0;
+		bPersistBusy = 0;
+	}
+
+	// whatever is still registered belongs to a caller that saves on its own
+	for (INT32 i = 0; i < PERSIST_MAX_SOURCES; i++) {
+		BurnPersistRemove(i, 0);
+	}
+}
@@ -0,0 +1,30 @@
+// Background persistence of NVRAM / EEPROM / hiscore data
+
+// Sources are snapshotted every nBurnPersistFrames frames (0 = only at exit),
+// anything that changed since the last write is handed to a worker thread which
+// writes "file.tmp" and renames it over "file".  Every file gets a small trailer
+// (magic, payload length, crc32) that BurnPersistLoad() checks, files without it
+// are loaded as-is so older saves keep working.  The trailer goes after the data:
+// older builds read .nv / .hi / .fs files from the start and stop at the length
+// they expect, so they load these files too (and drop the trailer on their next save).
+// The worker thread is only started by the first BurnPersistAdd().
+extern INT32 nBurnPersistFrames;
+
+// snapshot callback: copy nLen bytes of the current data to pDest,
+// return non-zero to skip this round (data not ready / not valid yet)
+typedef INT32 (*BurnPersistSnapshotCB)(UINT8 *pDest, INT32 nLen);
+
+void BurnPersistInit();
+void BurnPersistFrame();
+void BurnPersistExit();
+
+// returns a slot for BurnPersistRemove(), or -1
+INT32 BurnPersistAdd(const TCHAR *szFilename, INT32 nLen, BurnPersistSnapshotCB pSnapshot);
+// bSave: take a last snapshot and write it synchronously
+void BurnPersistRemove(INT32 nSlot, INT32 bSave);
+
+// returns the number of bytes copied to pDest (at most nMaxLen), or -1 when
+// there is no (valid) file
+INT32 BurnPersistLoad(const TCHAR *szFilename, UINT8 *pDest, INT32 nMaxLen);
+// synchronous write, returns 0 on success
+INT32 BurnPersistSave(const TCHAR *szFilename, const UINT8 *pData, INT32 nLen);
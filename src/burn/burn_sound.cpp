@@ -26,6 +26,7 @@ INT32 cmc_4p_Precalc()
 void BurnSoundInit()
 {
 	cmc_4p_Precalc();
+	BurnSoundMixInit();
 }
 
 static INT16 dac_lastin_r  = 0;
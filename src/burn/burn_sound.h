@@ -29,6 +29,14 @@ void BurnSoundCopyClamp_C(INT32* Src, INT16* Dest, INT32 Len);
 void BurnSoundCopyClamp_Add_C(INT32* Src, INT16* Dest, INT32 Len);
 void BurnSoundCopyClamp_Mono_C(INT32* Src, INT16* Dest, INT32 Len);
 void BurnSoundCopyClamp_Mono_Add_C(INT32* Src, INT16* Dest, INT32 Len);
+void BurnSoundClampStereo_C(INT32* Src, INT16* Dest, INT32 Len);
+void BurnSoundClampStereo_Add_C(INT32* Src, INT16* Dest, INT32 Len);
+
+// best version for the host cpu (SSE2/AVX2/NEON, C otherwise), selected by BurnSoundMixInit()
+// Src is interleaved L/R INT32, Dest = clip(Src) or clip(Dest + clip(Src))
+extern void (*BurnSoundClampStereo)(INT32* Src, INT16* Dest, INT32 Len);
+extern void (*BurnSoundClampStereo_Add)(INT32* Src, INT16* Dest, INT32 Len);
+void BurnSoundMixInit(); // called from BurnSoundInit()
 
 void BurnSoundInit(); // init cubic filter table, etc
 
@@ -1,6 +1,25 @@
 #include "burnint.h"
 //#include "burn_sound.h"
 
+// C versions of the mixing / clamping routines in burn_sound_a.asm, plus the interleaved
+// stereo clamp. BurnSoundMixInit() points the BurnSoundClampStereo* function pointers at
+// the best version for the host cpu (AVX2 or SSE2 on x86, NEON on ARM).
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+ #include <immintrin.h>
+ #define SND_X86_SIMD
+ #define SND_TARGET_SSE2 __attribute__((target("sse2")))
+ #define SND_TARGET_AVX2 __attribute__((target("avx2")))
+ #define SND_HAS_AVX2
+#elif defined(_MSC_VER) && (defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+ #include <emmintrin.h>
+ #define SND_X86_SIMD
+ #define SND_TARGET_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+ #include <arm_neon.h>
+ #define SND_NEON_SIMD
+#endif
+
 #define CLIP(A) ((A) < -0x8000 ? -0x8000 : (A) > 0x7fff ? 0x7fff : (A))
 
 void BurnSoundCopyClamp_C(INT32 *Src, INT16 *Dest, INT32 Len)
@@ -43,4 +62,158 @@ void BurnSoundCopyClamp_Mono_Add_C(INT32 *Src, INT16 *Dest, INT32 Len)
 	}
 }
 
+// interleaved stereo, no scaling: what the sound chip wrappers do at the end of every update
+void BurnSoundClampStereo_C(INT32 *Src, INT16 *Dest, INT32 Len)
+{
+	Len *= 2;
+	while (Len--) {
+		*Dest = CLIP(*Src);
+		Src++;
+		Dest++;
+	}
+}
+
+void BurnSoundClampStereo_Add_C(INT32 *Src, INT16 *Dest, INT32 Len)
+{
+	Len *= 2;
+	while (Len--) {
+		*Dest = CLIP(CLIP(*Src) + *Dest);
+		Src++;
+		Dest++;
+	}
+}
+
+#if defined SND_X86_SIMD
+
+SND_TARGET_SSE2 static void BurnSoundClampStereo_SSE2(INT32 *Src, INT16 *Dest, INT32 Len)
+{
+	INT32 i = 0;
+	Len *= 2;
+
+	for (; i + 8 <= Len; i += 8) {
+		__m128i a = _mm_loadu_si128((__m128i*)(Src + i + 0));
+		__m128i b = _mm_loadu_si128((__m128i*)(Src + i + 4));
+		_mm_storeu_si128((__m128i*)(Dest + i), _mm_packs_epi32(a, b));
+	}
+
+	for (; i < Len; i++) {
+		Dest[i] = CLIP(Src[i]);
+	}
+}
+
+SND_TARGET_SSE2 static void BurnSoundClampStereo_Add_SSE2(INT32 *Src, INT16 *Dest, INT32 Len)
+{
+	INT32 i = 0;
+	Len *= 2;
+
+	for (; i + 8 <= Len; i += 8) {
+		__m128i a = _mm_loadu_si128((__m128i*)(Src + i + 0));
+		__m128i b = _mm_loadu_si128((__m128i*)(Src + i + 4));
+		__m128i d = _mm_loadu_si128((__m128i*)(Dest + i));
+		_mm_storeu_si128((__m128i*)(Dest + i), _mm_adds_epi16(d, _mm_packs_epi32(a, b)));
+	}
+
+	for (; i < Len; i++) {
+		Dest[i] = CLIP(CLIP(Src[i]) + Dest[i]);
+	}
+}
+
+#if defined SND_HAS_AVX2
+
+// 256-bit packs work per 128-bit lane, permute4x64 puts the words back in order
+
+SND_TARGET_AVX2 static void BurnSoundClampStereo_AVX2(INT32 *Src, INT16 *Dest, INT32 Len)
+{
+	INT32 i = 0;
+	Len *= 2;
+
+	for (; i + 16 <= Len; i += 16) {
+		__m256i a = _mm256_loadu_si256((__m256i*)(Src + i + 0));
+		__m256i b = _mm256_loadu_si256((__m256i*)(Src + i + 8));
+		_mm256_storeu_si256((__m256i*)(Dest + i), _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xd8));
+	}
+
+	for (; i < Len; i++) {
+		Dest[i] = CLIP(Src[i]);
+	}
+}
+
+SND_TARGET_AVX2 static void BurnSoundClampStereo_Add_AVX2(INT32 *Src, INT16 *Dest, INT32 Len)
+{
+	INT32 i = 0;
+	Len *= 2;
+
+	for (; i + 16 <= Len; i += 16) {
+		__m256i a = _mm256_loadu_si256((__m256i*)(Src + i + 0));
+		__m256i b = _mm256_loadu_si256((__m256i*)(Src + i + 8));
+		__m256i d = _mm256_loadu_si256((__m256i*)(Dest + i));
+		_mm256_storeu_si256((__m256i*)(Dest + i), _mm256_adds_epi16(d, _mm256_permute4x64_epi64(_mm256_packs_epi32(a, b), 0xd8)));
+	}
+
+	for (; i < Len; i++) {
+		Dest[i] = CLIP(CLIP(Src[i]) + Dest[i]);
+	}
+}
+
+#endif // SND_HAS_AVX2
+
+#elif defined SND_NEON_SIMD
+
+static void BurnSoundClampStereo_NEON(INT32 *Src, INT16 *Dest, INT32 Len)
+{
+	INT32 i = 0;
+	Len *= 2;
+
+	for (; i + 8 <= Len; i += 8) {
+		vst1q_s16(Dest + i, vcombine_s16(vqmovn_s32(vld1q_s32(Src + i + 0)), vqmovn_s32(vld1q_s32(Src + i + 4))));
+	}
+
+	for (; i < Len; i++) {
+		Dest[i] = CLIP(Src[i]);
+	}
+}
+
+static void BurnSoundClampStereo_Add_NEON(INT32 *Src, INT16 *Dest, INT32 Len)
+{
+	INT32 i = 0;
+	Len *= 2;
+
+	for (; i + 8 <= Len; i += 8) {
+		int16x8_t s = vcombine_s16(vqmovn_s32(vld1q_s32(Src + i + 0)), vqmovn_s32(vld1q_s32(Src + i + 4)));
+		vst1q_s16(Dest + i, vqaddq_s16(vld1q_s16(Dest + i), s));
+	}
+
+	for (; i < Len; i++) {
+		Dest[i] = CLIP(CLIP(Src[i]) + Dest[i]);
+	}
+}
+
+#endif
+
 #undef CLIP
+
+void (*BurnSoundClampStereo)(INT32* Src, INT16* Dest, INT32 Len) = BurnSoundClampStereo_C;
+void (*BurnSoundClampStereo_Add)(INT32* Src, INT16* Dest, INT32 Len) = BurnSoundClampStereo_Add_C;
+
+void BurnSoundMixInit()
+{
+#if defined SND_X86_SIMD
+ #if defined __GNUC__
+	__builtin_cpu_init();
+	if (!__builtin_cpu_supports("sse2")) return;
+ #endif
+
+	BurnSoundClampStereo        = BurnSoundClampStereo_SSE2;
+	BurnSoundClampStereo_Add    = BurnSoundClampStereo_Add_SSE2;
+
+ #if defined SND_HAS_AVX2
+	if (__builtin_cpu_supports("avx2")) {
+		BurnSoundClampStereo     = BurnSoundClampStereo_AVX2;
+		BurnSoundClampStereo_Add = BurnSoundClampStereo_Add_AVX2;
+	}
+ #endif
+#elif defined SND_NEON_SIMD
+	BurnSoundClampStereo        = BurnSoundClampStereo_NEON;
+	BurnSoundClampStereo_Add    = BurnSoundClampStereo_Add_NEON;
+#endif
+}
@@ -84,6 +84,11 @@ INT32 BurnByteswap(UINT8* pMem, INT32 nLen);
 void BurnNibbleExpand(UINT8 *source, UINT8 *dst, INT32 length, INT32 swap, UINT8 nxor);
 INT32 BurnClearScreen();
 
+// frame change detection: the driver's scan reports its video areas (RAM, palette,
+// scroll registers..) for ACB_VIDEO, its Draw() calls this first and returns early
+// when it's non-zero - pBurnDraw still holds the frame drawn last time
+INT32 BurnVideoUnchanged();
+
 // from intf/input/inp_interface.cpp
 extern INT32 nInputIntfMouseDivider;
 
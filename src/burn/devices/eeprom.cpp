@@ -22,6 +22,14 @@ static INT32 neeprom_available = 0;
 
 static INT32 overrun_errmsg_ignore = 0;
 
+static INT32 persist_slot = -1;
+
+static INT32 eeprom_persist_snapshot(UINT8 *dest, INT32 len)
+{
+	memcpy(dest, eeprom_data, len);
+	return 0;
+}
+
 static INT32 eeprom_command_match(const char *buf, const char *cmd, INT32 len)
 {
 	if ( cmd == 0 )	return 0;
@@ -100,12 +108,11 @@ void EEPROMInit(const eeprom_interface *interface)
 
 	INT32 len = ((1 << intf->address_bits) * (intf->data_bits >> 3)) & (MEMORY_SIZE-1);
 
-	FILE *fz = _tfopen(output, _T("rb"));
-	if (fz != NULL) {
+	if (BurnPersistLoad(output, eeprom_data, len) >= 0) {
 		neeprom_available = 1;
-		fread (eeprom_data, len, 1, fz);
-		fclose (fz);
 	}
+
+	persist_slot = BurnPersistAdd(output, len, eeprom_persist_snapshot);
 }
 
 void EEPROMExit()
@@ -116,18 +123,10 @@ void EEPROMExit()
 
 	if (!DebugDev_EEPROMInitted) return;
 
-	TCHAR output[MAX_PATH];
-	_stprintf (output, _T("%s%s.nv"), szAppEEPROMPath, BurnDrvGetText(DRV_NAME));
-
 	neeprom_available = 0;
 
-	INT32 len = ((1 << intf->address_bits) * (intf->data_bits >> 3)) & (MEMORY_SIZE-1);
-
-	FILE *fz = _tfopen(output, _T("wb"));
-	if (fz) {
-		fwrite (eeprom_data, len, 1, fz);
-		fclose (fz);
-	}
+	BurnPersistRemove(persist_slot, 1);
+	persist_slot = -1;
 
 	overrun_errmsg_ignore = 0;
 
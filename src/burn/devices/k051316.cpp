@@ -61,6 +61,8 @@ void K051316Init(INT32 chip, UINT8 *gfx, UINT8 *gfxexp, INT32 mask, void (*callb
 		K051316TransMask[chip] = transp & 0xff;
 		K051316TransColor[chip] = 0;
 	}
+
+	GenericRozSetThreading(bBurnVideoThreading);
 }
 
 void K051316Reset()
@@ -90,6 +92,8 @@ void K051316Exit()
 		BurnFree (K051316TileMap[i]);
 		K051316Callback[i] = NULL;
 	}
+
+	GenericRozSetThreading(0);
 }
 
 void K051316SetOffset(INT32 chip, INT32 xoffs, INT32 yoffs)
@@ -193,123 +197,91 @@ void K051316WrapEnable(INT32 chip, INT32 status)
 	force_update[chip] = 1;
 }
 
-static inline void copy_roz(INT32 chip, UINT32 startx, UINT32 starty, INT32 incxx, INT32 incxy, INT32 incyx, INT32 incyy, INT32 wrap, INT32 transp, INT32 flags)
+// non-wrapping opaque copy: the (cx >> 16) term isn't masked, wide coordinates bleed into the row bits
+static void copy_roz_opaque_nowrap(INT32 chip, UINT32 startx, UINT32 starty, INT32 incxx, INT32 incxy, INT32 incyx, INT32 incyy, INT32 flags)
 {
-	UINT32 hshift = 512 << 16;
-	UINT32 wshift = 512 << 16;
-
-	if (flags & 0x200) transp = 0; // force opaque
-
 	INT32 priority = flags & 0xff;
+	UINT16 *src = K051316TileMap[chip];
 
 	if (flags & 0x100)	// indexed colors
 	{
 		UINT16 *dst = pTransDraw;
-		UINT16 *src = K051316TileMap[chip];
 
 		for (INT32 sy = 0; sy < nScreenHeight; sy++, startx+=incyx, starty+=incyy)
 		{
 			UINT32 cx = startx;
 			UINT32 cy = starty;
-	
-			if (wrap) {
-				if (transp) {
-					for (INT32 x = 0; x < nScreenWidth; x++, cx+=incxx, cy+=incxy, dst++)
-					{
-						INT32 pxl = src[(((cy >> 16) & 0x1ff) << 9) | ((cx >> 16) & 0x1ff)];
-				
-						if (!(pxl & 0x8000)) {
-							*dst = pxl;
-						}
-					}
-				} else {
-					for (INT32 x = 0; x < nScreenWidth; x++, cx+=incxx, cy+=incxy, dst++) {
-						*dst = src[(((cy >> 16) & 0x1ff) << 9) | ((cx >> 16) & 0x1ff)] & 0x7fff;
-					}
-				}
-			} else {
-				if (transp) {
-					for (INT32 x = 0; x < nScreenWidth; x++, cx+=incxx, cy+=incxy, dst++)
-					{
-						if (cx < wshift && cy < hshift) {
-							INT32 pxl = src[(((cy >> 16) & 0x1ff) << 9) | ((cx >> 16) & 0x1ff)];
-							if (!(pxl & 0x8000)) {
-								*dst = pxl;
-							}
-						}
-					}
-				} else {
-					for (INT32 x = 0; x < nScreenWidth; x++, cx+=incxx, cy+=incxy, dst++)
-					{
-						UINT32 pos = ((cy >> 16) << 9) | (cx >> 16);
-	
-						if (pos >= 0x40000) continue;
-	
-						*dst = src[pos] & 0x7fff;
-					}
-				}
+
+			for (INT32 x = 0; x < nScreenWidth; x++, cx+=incxx, cy+=incxy, dst++)
+			{
+				UINT32 pos = ((cy >> 16) << 9) | (cx >> 16);
+
+				if (pos >= 0x40000) continue;
+
+				*dst = src[pos] & 0x7fff;
 			}
 		}
 	}
 	else	// 32-bit colors
 	{
-		if (k051316_bitmap32 == NULL) return; // no high-color render target set
-
 		UINT32 *dst = k051316_bitmap32;
 		UINT8 *pri = k051316_priority_bitmap;
-		UINT16 *src = K051316TileMap[chip];
 		UINT32 *pal = k051316_palette32;
 
 		for (INT32 sy = 0; sy < nScreenHeight; sy++, startx+=incyx, starty+=incyy)
 		{
 			UINT32 cx = startx;
 			UINT32 cy = starty;
-	
-			if (wrap) {
-				if (transp) {
-					for (INT32 x = 0; x < nScreenWidth; x++, cx+=incxx, cy+=incxy, dst++, pri++)
-					{
-						INT32 pxl = src[(((cy >> 16) & 0x1ff) << 9) | ((cx >> 16) & 0x1ff)];
-				
-						if (!(pxl & 0x8000)) {
-							*dst = pal[pxl];
-							*pri = priority;
-						}
-					}
-				} else {
-					for (INT32 x = 0; x < nScreenWidth; x++, cx+=incxx, cy+=incxy, dst++, pri++) {
-						*dst = pal[src[(((cy >> 16) & 0x1ff) << 9) | ((cx >> 16) & 0x1ff)] & 0x7fff];
-						*pri = priority;
-					}
-				}
-			} else {
-				if (transp) {
-					for (INT32 x = 0; x < nScreenWidth; x++, cx+=incxx, cy+=incxy, dst++, pri++)
-					{
-						if (cx < wshift && cy < hshift) {
-							INT32 pxl = src[(((cy >> 16) & 0x1ff) << 9) | ((cx >> 16) & 0x1ff)];
-							if (!(pxl & 0x8000)) {
-								*dst = pal[pxl];
-								*pri = priority;
-							}
-						}
-					}
-				} else {
-					for (INT32 x = 0; x < nScreenWidth; x++, cx+=incxx, cy+=incxy, dst++, pri++)
-					{
-						UINT32 pos = ((cy >> 16) << 9) | (cx >> 16);
-	
-						if (pos >= 0x40000) continue;
-	
-						*dst = pal[src[pos] & 0x7fff];
-						*pri = priority;
-					}
-				}
+
+			for (INT32 x = 0; x < nScreenWidth; x++, cx+=incxx, cy+=incxy, dst++, pri++)
+			{
+				UINT32 pos = ((cy >> 16) << 9) | (cx >> 16);
+
+				if (pos >= 0x40000) continue;
+
+				*dst = pal[src[pos] & 0x7fff];
+				*pri = priority;
 			}
 		}
 	}
 }
 
+static inline void copy_roz(INT32 chip, UINT32 startx, UINT32 starty, INT32 incxx, INT32 incxy, INT32 incyx, INT32 incyy, INT32 wrap, INT32 transp, INT32 flags)
+{
+	if (flags & 0x200) transp = 0; // force opaque
+
+	if (!(flags & 0x100) && k051316_bitmap32 == NULL) return; // no high-color render target set
+
+	if (!wrap && !transp) {
+		copy_roz_opaque_nowrap(chip, startx, starty, incxx, incxy, incyx, incyy, flags);
+		return;
+	}
+
+	// bit 15 of a tilemap pixel marks it transparent
+	GenericRozSource src = { K051316TileMap[chip], 512, 512, wrap, (UINT16)(transp ? 0x8000 : 0), 0x8000, 0x7fff };
+	GenericRozTarget dst;
+
+	dst.pitch = nScreenWidth;
+	dst.priority = flags & 0xff;
+
+	if (flags & 0x100)	// indexed colors
+	{
+		dst.dst16 = pTransDraw;
+		dst.dst32 = NULL;
+		dst.palette32 = NULL;
+		dst.pri = NULL;
+	}
+	else	// 32-bit colors
+	{
+		dst.dst16 = NULL;
+		dst.dst32 = k051316_bitmap32;
+		dst.palette32 = k051316_palette32;
+		dst.pri = k051316_priority_bitmap;
+	}
+
+	GenericRozDraw(&src, &dst, 0, nScreenWidth, 0, nScreenHeight, startx, starty, incxx, incxy, incyx, incyy);
+}
+
 void K051316_zoom_draw(INT32 chip, INT32 flags)
 {
 	UINT32 startx,starty;
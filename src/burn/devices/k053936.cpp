@@ -71,6 +71,8 @@ void K053936Init(INT32 chip, UINT8 *ram, INT32 len, INT32 w, INT32 h, void (*pCa
 	if (chip == 1) {
 		pTileCallback1 = pCallback;
 	}
+
+	GenericRozSetThreading(bBurnVideoThreading);
 }
 
 void K053936Exit()
@@ -85,6 +87,8 @@ void K053936Exit()
 		K053936Wrap[i] = 0;
 		K053936Offset[i][0] = K053936Offset[i][1] = 0;
 	}
+
+	GenericRozSetThreading(0);
 }
 
 void K053936PredrawTiles3(INT32 chip, UINT8 *gfx, INT32 tile_size_x, INT32 tile_size_y, INT32 transparent)
@@ -259,70 +263,11 @@ static inline void copy_roz32(INT32 chip, INT32 minx, INT32 maxx, INT32 miny, IN
 		return;
 	}
 
-	UINT8  *pri = k053936_priority_bitmap;
-	UINT32 *dst = k053936_bitmap32;
-	UINT32 *pal = k053936_palette32;
-	UINT16 *src = tscreen[chip];
-
-	INT32 width = nWidth[chip];
-	INT32 hmask = nHeight[chip] - 1;
-	INT32 wmask = nWidth[chip] - 1;
-
-	INT32 wrap = K053936Wrap[chip];
-	
-	dst += maxx * miny; // right?
-	
-	for (INT32 sy = miny; sy < maxy; sy++, startx+=incyx, starty+=incyy)
-	{
-		UINT32 cx = startx;
-		UINT32 cy = starty;
+	// lines are laid out back to back from maxx * miny, the priority output starts at the top of its bitmap
+	GenericRozSource src = { tscreen[chip], nWidth[chip], nHeight[chip], K053936Wrap[chip], (UINT16)(transp ? 0x8000 : 0), 0x8000, 0x7fff };
+	GenericRozTarget dst = { NULL, k053936_bitmap32 + maxx * miny - minx, k053936_palette32, k053936_priority_bitmap - minx, maxx - minx, priority };
 
-		if (transp) {
-			if (wrap) {
-				for (INT32 x = minx; x < maxx; x++, cx+=incxx, cy+=incxy, dst++, pri++)
-				{
-					INT32 pxl = src[(((cy >> 16) & hmask) * width) + ((cx >> 16) & wmask)];
-		
-					if (!(pxl & 0x8000)) {
-						*dst = pal[pxl];
-						*pri = priority;
-					}
-				}
-			} else {
-				for (INT32 x = minx; x < maxx; x++, cx+=incxx, cy+=incxy, dst++, pri++)
-				{
-					INT32 yy = cy >> 16;
-					if (yy > hmask || yy < 0) continue;
-					INT32 xx = cx >> 16;
-					if (xx > wmask || xx < 0) continue;
-
-					INT32 pxl = src[(yy * width) + xx];
-
-					if (!(pxl & 0x8000)) {
-						*dst = pal[pxl];
-						*pri = priority;
-					}
-				}
-			}
-		} else {
-			if (wrap) {
-				for (INT32 x = minx; x < maxx; x++, cx+=incxx, cy+=incxy, dst++, pri++) {
-					*dst = pal[src[(((cy >> 16) & hmask) * width) + ((cx >> 16) & wmask)] & 0x7fff];
-					*pri = priority;
-				}
-			} else {
-				for (INT32 x = minx; x < maxx; x++, cx+=incxx, cy+=incxy, dst++, pri++) {
-					INT32 yy = cy >> 16;
-					if (yy > hmask || yy < 0) continue;
-					INT32 xx = cx >> 16;
-					if (xx > wmask || xx < 0) continue;
-
-					*dst = pal[src[(yy * width) + xx] & 0x7fff];
-					*pri = priority;
-				}
-			}
-		}
-	}
+	GenericRozDraw(&src, &dst, minx, maxx, miny, maxy, startx, starty, incxx, incxy, incyx, incyy);
 }
 
 static inline void copy_roz16(INT32 chip, INT32 minx, INT32 maxx, INT32 miny, INT32 maxy, UINT32 startx, UINT32 starty, INT32 incxx, INT32 incxy, INT32 incyx, INT32 incyy, INT32 transp, INT32 transp_mask, INT32 priority)
@@ -352,69 +297,11 @@ static inline void copy_roz16(INT32 chip, INT32 minx, INT32 maxx, INT32 miny, IN
 		return;
 	}
 
-	UINT8  *pri = pPrioDraw;
-	UINT16 *dst = pTransDraw;
-	UINT16 *src = BurnBitmapGetBitmap(1);
-
-	INT32 width = clip_maxx;
-	INT32 hmask = clip_maxy - 1;
-	INT32 wmask = clip_maxx - 1;
-
-	INT32 wrap = K053936Wrap[chip];
-	
-	dst += maxx * miny; // right?
-
-	for (INT32 sy = miny; sy < maxy; sy++, startx+=incyx, starty+=incyy)
-	{
-		UINT32 cx = startx;
-		UINT32 cy = starty;
+	// lines are laid out back to back from maxx * miny, the priority output starts at the top of its bitmap
+	GenericRozSource src = { BurnBitmapGetBitmap(1), clip_maxx, clip_maxy, K053936Wrap[chip], (UINT16)transp_mask, (UINT16)transp, (UINT16)(transp_mask ? 0xffff : 0x7fff) };
+	GenericRozTarget dst = { pTransDraw + maxx * miny - minx, NULL, NULL, pPrioDraw - minx, maxx - minx, priority };
 
-		if (transp_mask) {
-			if (wrap) {
-				for (INT32 x = minx; x < maxx; x++, cx+=incxx, cy+=incxy, dst++, pri++)
-				{
-					INT32 pxl = src[(((cy >> 16) & hmask) * width) + ((cx >> 16) & wmask)];
-		
-					if ((pxl & transp_mask) != transp) {
-						*dst = pxl;
-						*pri = priority;
-					}
-				}
-			} else {
-				for (INT32 x = minx; x < maxx; x++, cx+=incxx, cy+=incxy, dst++, pri++)
-				{
-					INT32 yy = cy >> 16;
-					if (yy > hmask || yy < 0) continue;
-					INT32 xx = cx >> 16;
-					if (xx > wmask || xx < 0) continue;
-
-					INT32 pxl = src[(yy * width) + xx];
-
-					if ((pxl & transp_mask) != transp) {
-						*dst = pxl;
-						*pri = priority;
-					}
-				}
-			}
-		} else {
-			if (wrap) {
-				for (INT32 x = minx; x < maxx; x++, cx+=incxx, cy+=incxy, dst++, pri++) {
-					*dst = src[(((cy >> 16) & hmask) * width) + ((cx >> 16) & wmask)] & 0x7fff;
-					*pri = priority;
-				}
-			} else {
-				for (INT32 x = minx; x < maxx; x++, cx+=incxx, cy+=incxy, dst++, pri++) {
-					INT32 yy = cy >> 16;
-					if (yy > hmask || yy < 0) continue;
-					INT32 xx = cx >> 16;
-					if (xx > wmask || xx < 0) continue;
-
-					*dst = src[(yy * width) + xx] & 0x7fff;
-					*pri = priority;
-				}
-			}
-		}
-	}
+	GenericRozDraw(&src, &dst, minx, maxx, miny, maxy, startx, starty, incxx, incxy, incyx, incyy);
 }
 
 void K053936Draw(INT32 chip, UINT16 *ctrl, UINT16 *linectrl, INT32 flags)
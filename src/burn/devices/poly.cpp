@@ -10,6 +10,15 @@
 #include "burnint.h"
 #include "poly.h"
 
+#if (defined _MSC_VER) || (defined WIN32)
+#define POLY_THREADS_WIN32
+#include <windows.h>
+#elif defined(__linux__) || defined(__ANDROID__) || defined(__APPLE__)
+#define POLY_THREADS_PTHREAD
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
 
 /***************************************************************************
     DEBUGGING
@@ -34,6 +43,7 @@
 #define CACHE_LINE_SIZE                 64          /* this is a general guess */
 #define TOTAL_BUCKETS                   (512 / SCANLINES_PER_BUCKET)
 #define UNITS_PER_POLY                  (100 / SCANLINES_PER_BUCKET)
+#define WORK_MAX_THREADS                8           /* worker threads, the emulation thread helps out in poly_wait() */
 
 
 
@@ -43,6 +53,7 @@
 
 /* forward definitions */
 struct polygon_info;
+struct poly_work_queue;
 
 /* tri_extent describes start/end points for a scanline */
 struct tri_extent
@@ -139,7 +150,8 @@ struct polygon_info
 struct poly_manager
 {
 	/* queue management */
-//	osd_work_queue *    queue;                  /* work queue */
+	poly_work_queue *   queue;                  /* work queue (NULL: units run from poly_wait()) */
+	volatile INT32      units_done;             /* number of units rendered since the last poly_wait() */
 
 	/* triangle work units */
 	work_unit **        unit;                   /* array of work unit pointers */
@@ -181,8 +193,8 @@ struct poly_manager
 	UINT32              polygon_max;            /* maximum polygons used */
 	UINT32              extra_waits;            /* number of times we waited for an extra data */
 	UINT32              extra_max;              /* maximum extra data used */
-	UINT32              conflicts[WORK_MAX_THREADS]; /* number of conflicts found, per thread */
-	UINT32              resolved[WORK_MAX_THREADS]; /* number of conflicts resolved, per thread */
+	UINT32              conflicts[WORK_MAX_THREADS + 1]; /* number of conflicts found, per thread */
+	UINT32              resolved[WORK_MAX_THREADS + 1]; /* number of conflicts resolved, per thread */
 #endif
 };
 
@@ -196,13 +208,32 @@ static void **allocate_array(size_t *itemsize, UINT32 itemcount);
 static void free_array(void **array);
 static void *poly_item_callback(void *param, int threadid);
 //static void poly_state_presave(poly_manager *poly);
+static poly_work_queue *work_queue_alloc(poly_manager *poly);
+static void work_queue_free(poly_work_queue *queue);
+static void work_queue_publish(poly_work_queue *queue, UINT32 count);
+static void work_queue_wait(poly_work_queue *queue);
 
 static INT32 compare_exchange32(volatile INT32 *ptr, INT32 compare, INT32 exchange)
 {
+#if defined(_MSC_VER)
+	return InterlockedCompareExchange((volatile LONG *)ptr, exchange, compare);
+#elif defined(__GNUC__)
+	return __sync_val_compare_and_swap(ptr, compare, exchange);
+#else
 	INT32 prev = *ptr;
 	if (*ptr == compare)
 		*ptr = exchange;
 	return prev;
+#endif
+}
+
+static void atomic_increment32(volatile INT32 *ptr)
+{
+	INT32 orig;
+	do
+	{
+		orig = *ptr;
+	} while (compare_exchange32(ptr, orig, orig + 1) != orig);
 }
 
 #define INLINE static inline
@@ -344,10 +375,11 @@ poly_manager *poly_alloc(int max_polys, size_t extra_data_size, UINT8 flags)
 	poly->unit_count = MIN(poly->polygon_count * UNITS_PER_POLY, 65535);
 	poly->unit_next = 0;
 	poly->unit = (work_unit **)allocate_array(&poly->unit_size, poly->unit_count);
+	memset(poly->unit_bucket, 0xff, sizeof(poly->unit_bucket));
 
-	/* create the work queue */
-//	if (!(flags & POLYFLAG_NO_WORK_QUEUE))
-//		poly->queue = osd_work_queue_alloc(WORK_QUEUE_FLAG_MULTI | WORK_QUEUE_FLAG_HIGH_FREQ);
+	/* create the work queue, if the front end lets video renderers use threads */
+	if (!(flags & POLYFLAG_NO_WORK_QUEUE) && bBurnVideoThreading)
+		poly->queue = work_queue_alloc(poly);
 
 	/* request a pre-save callback for synchronization */
 	//machine.save().register_presave(save_prepost_delegate(FUNC(poly_state_presave), poly));
@@ -384,6 +416,9 @@ void poly_free(poly_manager *poly)
 }
 #endif
 
+	/* stop the workers before the units go away */
+	work_queue_free(poly->queue);
+
 	/* free the arrays */
 	free_array(poly->extra);
 	free_array((void **)poly->polygon);
@@ -414,11 +449,11 @@ void poly_wait(poly_manager *poly, const char *debug_reason)
 	//	time = get_profile_ticks();
 
 	/* wait for all pending work items to complete */
-	//if (poly->queue != NULL)
-	//osd_work_queue_wait(poly->queue, osd_ticks_per_second() * 100);
+	if (poly->queue != NULL)
+		work_queue_wait(poly->queue);
 
 	/* if we don't have a queue, just run the whole list now */
-	//else
+	else
 	{
 		int unitnum;
 		for (unitnum = 0; unitnum < poly->unit_next; unitnum++)
@@ -435,6 +470,7 @@ void poly_wait(poly_manager *poly, const char *debug_reason)
 
 	/* reset the state */
 	poly->polygon_next = poly->unit_next = 0;
+	poly->units_done = 0;
 	memset(poly->unit_bucket, 0xff, sizeof(poly->unit_bucket));
 
 	/* we need to preserve the last extra data that was supplied */
@@ -646,8 +682,8 @@ UINT32 poly_render_triangle(poly_manager *poly, void *dest, const rectangle &cli
 	}
 
 	/* enqueue the work items */
-	//if (poly->queue != NULL)
-	//osd_work_item_queue_multiple(poly->queue, poly_item_callback, poly->unit_next - startunit, poly->unit[startunit], poly->unit_size, WORK_ITEM_FLAG_AUTO_RELEASE);
+	if (poly->queue != NULL)
+		work_queue_publish(poly->queue, poly->unit_next);
 
 	/* return the total number of pixels in the triangle */
 	poly->triangles++;
@@ -754,8 +790,8 @@ UINT32 poly_render_triangle_custom(poly_manager *poly, void *dest, const rectang
 #endif
 
 	/* enqueue the work items */
-	//if (poly->queue != NULL)
-	//	osd_work_item_queue_multiple(poly->queue, poly_item_callback, poly->unit_next - startunit, poly->unit[startunit], poly->unit_size, WORK_ITEM_FLAG_AUTO_RELEASE);
+	if (poly->queue != NULL)
+		work_queue_publish(poly->queue, poly->unit_next);
 
 	/* return the total number of pixels in the object */
 	poly->triangles++;
@@ -979,8 +1015,8 @@ UINT32 poly_render_quad(poly_manager *poly, void *dest, const rectangle &cliprec
 #endif
 
 	/* enqueue the work items */
-	//if (poly->queue != NULL)
-	//	osd_work_item_queue_multiple(poly->queue, poly_item_callback, poly->unit_next - startunit, poly->unit[startunit], poly->unit_size, WORK_ITEM_FLAG_AUTO_RELEASE);
+	if (poly->queue != NULL)
+		work_queue_publish(poly->queue, poly->unit_next);
 
 	/* return the total number of pixels in the triangle */
 	poly->quads++;
@@ -1211,8 +1247,8 @@ UINT32 poly_render_polygon(poly_manager *poly, void *dest, const rectangle &clip
 #endif
 
 	/* enqueue the work items */
-	//if (poly->queue != NULL)
-	//	osd_work_item_queue_multiple(poly->queue, poly_item_callback, poly->unit_next - startunit, poly->unit[startunit], poly->unit_size, WORK_ITEM_FLAG_AUTO_RELEASE);
+	if (poly->queue != NULL)
+		work_queue_publish(poly->queue, poly->unit_next);
 
 	/* return the total number of pixels in the triangle */
 	poly->quads++;
@@ -1368,6 +1404,7 @@ static void *poly_item_callback(void *param, int threadid)
 		{
 			orig_count_next = unit->shared.count_next;
 		} while (compare_exchange32((volatile INT32 *)&unit->shared.count_next, orig_count_next, 0) != orig_count_next);
+		atomic_increment32(&polygon->poly->units_done);
 
 		/* if we have no more work to do, do nothing */
 		orig_count_next >>= 16;
@@ -1378,3 +1415,266 @@ static void *poly_item_callback(void *param, int threadid)
 	return NULL;
 }
 
+
+
+
+/***************************************************************************
+    WORK QUEUE
+***************************************************************************/
+
+/*
+    Each poly manager owns a small pool of worker threads. Units are handed
+    out in the order they were queued and units hitting the same bucket are
+    chained in poly_item_callback(), so every scanline is drawn in queue order
+    no matter how many threads take part.
+*/
+
+struct poly_worker
+{
+	poly_work_queue *   queue;
+	int                 threadid;
+};
+
+struct poly_work_queue
+{
+	poly_manager *      poly;
+	INT32               threads;                /* number of worker threads running */
+	INT32               queued;                 /* units [0, queued) are ready to render */
+	INT32               claimed;                /* next unit to hand out */
+	INT32               exiting;
+	poly_worker         worker[WORK_MAX_THREADS];
+#if defined(POLY_THREADS_WIN32)
+	HANDLE              thread[WORK_MAX_THREADS];
+	CRITICAL_SECTION    lock;
+	HANDLE              wake;                   /* manual-reset, XP has no condition variables */
+	HANDLE              done;                   /* the last unit was rendered */
+#elif defined(POLY_THREADS_PTHREAD)
+	pthread_t           thread[WORK_MAX_THREADS];
+	pthread_mutex_t     lock;
+	pthread_cond_t      wake;
+	pthread_cond_t      done;
+#endif
+};
+
+#if defined(POLY_THREADS_WIN32)
+#define queue_lock(q)           EnterCriticalSection(&(q)->lock)
+#define queue_unlock(q)         LeaveCriticalSection(&(q)->lock)
+#define queue_sleep(q, ev)      do { ResetEvent((q)->ev); LeaveCriticalSection(&(q)->lock); WaitForSingleObject((q)->ev, INFINITE); EnterCriticalSection(&(q)->lock); } while (0)
+#define queue_wake(q, ev)       SetEvent((q)->ev)
+#elif defined(POLY_THREADS_PTHREAD)
+#define queue_lock(q)           pthread_mutex_lock(&(q)->lock)
+#define queue_unlock(q)         pthread_mutex_unlock(&(q)->lock)
+#define queue_sleep(q, ev)      pthread_cond_wait(&(q)->ev, &(q)->lock)
+#define queue_wake(q, ev)       pthread_cond_broadcast(&(q)->ev)
+#endif
+
+#if defined(POLY_THREADS_WIN32) || defined(POLY_THREADS_PTHREAD)
+
+/*-------------------------------------------------
+    work_queue_claim - hand out the next ready
+    unit, -1 if there is none
+-------------------------------------------------*/
+
+static INT32 work_queue_claim(poly_work_queue *queue)
+{
+	INT32 unitnum = -1;
+
+	queue_lock(queue);
+	if (queue->claimed < queue->queued)
+		unitnum = queue->claimed++;
+	queue_unlock(queue);
+
+	return unitnum;
+}
+
+
+/*-------------------------------------------------
+    work_queue_thread - worker thread body
+-------------------------------------------------*/
+
+static void work_queue_thread(poly_worker *worker)
+{
+	poly_work_queue *queue = worker->queue;
+
+	queue_lock(queue);
+	while (!queue->exiting)
+	{
+		if (queue->claimed < queue->queued)
+		{
+			INT32 unitnum = queue->claimed++;
+			queue_unlock(queue);
+			poly_item_callback(queue->poly->unit[unitnum], worker->threadid);
+			queue_lock(queue);
+			if (queue->poly->units_done == queue->queued)
+				queue_wake(queue, done);
+		}
+		else
+			queue_sleep(queue, wake);
+	}
+	queue_unlock(queue);
+}
+
+#if defined(POLY_THREADS_WIN32)
+static DWORD WINAPI work_queue_proc(LPVOID param)
+{
+	work_queue_thread((poly_worker *)param);
+	return 0;
+}
+#else
+static void *work_queue_proc(void *param)
+{
+	work_queue_thread((poly_worker *)param);
+	return NULL;
+}
+#endif
+
+static INT32 work_queue_cpus()
+{
+#if defined(POLY_THREADS_WIN32)
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return info.dwNumberOfProcessors;
+#else
+	return sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+}
+
+
+/*-------------------------------------------------
+    work_queue_alloc - start the worker threads,
+    NULL on a single core or if none could be
+    created
+-------------------------------------------------*/
+
+static poly_work_queue *work_queue_alloc(poly_manager *poly)
+{
+	INT32 threads = MIN(work_queue_cpus() - 1, WORK_MAX_THREADS);
+	poly_work_queue *queue;
+
+	if (threads < 1)
+		return NULL;
+
+	queue = (poly_work_queue *)BurnMalloc(sizeof(*queue));
+	memset(queue, 0, sizeof(*queue));
+	queue->poly = poly;
+
+#if defined(POLY_THREADS_WIN32)
+	InitializeCriticalSection(&queue->lock);
+	queue->wake = CreateEvent(NULL, TRUE, FALSE, NULL);
+	queue->done = CreateEvent(NULL, TRUE, FALSE, NULL);
+	if (queue->wake == NULL || queue->done == NULL)
+		threads = 0;
+#else
+	pthread_mutex_init(&queue->lock, NULL);
+	pthread_cond_init(&queue->wake, NULL);
+	pthread_cond_init(&queue->done, NULL);
+#endif
+
+	for (INT32 i = 0; i < threads; i++)
+	{
+		queue->worker[i].queue = queue;
+		queue->worker[i].threadid = i + 1; // 0 is the emulation thread
+#if defined(POLY_THREADS_WIN32)
+		queue->thread[i] = CreateThread(NULL, 0, work_queue_proc, &queue->worker[i], 0, NULL);
+		if (queue->thread[i] == NULL)
+			break;
+#else
+		if (pthread_create(&queue->thread[i], NULL, work_queue_proc, &queue->worker[i]) != 0)
+			break;
+#endif
+		queue->threads++;
+	}
+
+	if (queue->threads == 0)
+	{
+		bprintf(PRINT_ERROR, _T("poly: failure to create worker threads, rendering on the emulation thread\n"));
+		work_queue_free(queue);
+		return NULL;
+	}
+
+	return queue;
+}
+
+
+/*-------------------------------------------------
+    work_queue_free - stop and join the worker
+    threads
+-------------------------------------------------*/
+
+static void work_queue_free(poly_work_queue *queue)
+{
+	if (queue == NULL) return;
+
+	queue_lock(queue);
+	queue->exiting = 1;
+	queue_unlock(queue);
+	queue_wake(queue, wake);
+
+	for (INT32 i = 0; i < queue->threads; i++)
+	{
+#if defined(POLY_THREADS_WIN32)
+		WaitForSingleObject(queue->thread[i], INFINITE);
+		CloseHandle(queue->thread[i]);
+#else
+		pthread_join(queue->thread[i], NULL);
+#endif
+	}
+
+#if defined(POLY_THREADS_WIN32)
+	if (queue->done) CloseHandle(queue->done);
+	if (queue->wake) CloseHandle(queue->wake);
+	DeleteCriticalSection(&queue->lock);
+#else
+	pthread_cond_destroy(&queue->done);
+	pthread_cond_destroy(&queue->wake);
+	pthread_mutex_destroy(&queue->lock);
+#endif
+
+	BurnFree(queue);
+}
+
+
+/*-------------------------------------------------
+    work_queue_publish - make units [0, count)
+    available to the workers
+-------------------------------------------------*/
+
+static void work_queue_publish(poly_work_queue *queue, UINT32 count)
+{
+	queue_lock(queue);
+	queue->queued = count;
+	queue_unlock(queue);
+	queue_wake(queue, wake);
+}
+
+
+/*-------------------------------------------------
+    work_queue_wait - help out with the remaining
+    units, then sleep until the worker rendering
+    the last one wakes us
+-------------------------------------------------*/
+
+static void work_queue_wait(poly_work_queue *queue)
+{
+	poly_manager *poly = queue->poly;
+	INT32 unitnum;
+
+	while ((unitnum = work_queue_claim(queue)) >= 0)
+		poly_item_callback(poly->unit[unitnum], 0);
+
+	queue_lock(queue);
+	while (poly->units_done != queue->queued)
+		queue_sleep(queue, done);
+	queue->queued = queue->claimed = 0;
+	queue_unlock(queue);
+}
+
+#else
+
+/* no threads on this platform, poly_wait() renders everything */
+static poly_work_queue *work_queue_alloc(poly_manager *poly) { return NULL; }
+static void work_queue_free(poly_work_queue *queue) { }
+static void work_queue_publish(poly_work_queue *queue, UINT32 count) { }
+static void work_queue_wait(poly_work_queue *queue) { }
+
+#endif
@@ -30,6 +30,7 @@
   #endif
 #include <semaphore.h>
 #include <pthread.h>
+#include <stdint.h>
 #include <unistd.h>
 #include <fcntl.h>
 #endif
@@ -540,13 +541,18 @@ struct threadystruct
 
 		our_callback = thread_callback;
 
-		INT32 our_thread_rv = pthread_create(&our_thread, NULL, ThreadyProc, NULL);
+		// named semaphores are process-wide: every thready instance (there is one per
+		// source file that includes this) needs its own names, or their notify / wait
+		// calls cross.  (names are limited to 31 chars on macOS)
+		sprintf(our_event_str, "/fbn_o%x_%lx", getpid(), (unsigned long)(uintptr_t)this);
+		sprintf(wait_event_str, "/fbn_w%x_%lx", getpid(), (unsigned long)(uintptr_t)this);
+		sem_unlink(our_event_str);
+		sem_unlink(wait_event_str);
 
-		sprintf(our_event_str, "/fbn_our_event%x", getpid());
-		sprintf(wait_event_str, "/fbn_wait_event%x", getpid());
+		INT32 our_event_rv = ((our_event = sem_open(our_event_str, O_CREAT, 0644, 0)) == SEM_FAILED) ? -1 : 0;
+		INT32 wait_event_rv = ((wait_event = sem_open(wait_event_str, O_CREAT, 0644, 0)) == SEM_FAILED) ? -1 : 0;
 
-		INT32 our_event_rv = ((our_event = sem_open(our_event_str, O_CREAT, 0644, 1)) == SEM_FAILED) ? -1 : 0;
-		INT32 wait_event_rv = ((wait_event = sem_open(wait_event_str, O_CREAT, 0644, 1)) == SEM_FAILED) ? -1 : 0;
+		INT32 our_thread_rv = (our_event_rv == 0 && wait_event_rv == 0) ? pthread_create(&our_thread, NULL, ThreadyProc, NULL) : -1;
 
 		if (our_thread_rv == 0 && wait_event_rv == 0 && our_event_rv == 0) {
 			bprintf(0, _T("Thready: we're gonna git 'r dun!\n"));
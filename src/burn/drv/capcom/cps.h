@@ -338,6 +338,7 @@ extern INT32 nCpsGlobalYOffset;
 void DrawFnInit();
 INT32  CpsDraw();
 INT32  CpsRedraw();
+void CpsSetLayerThreading(INT32 bEnable);	// render the topmost scroll layer on a worker thread
 
 #define BURN_SND_QSND_OUTPUT_1			0
 #define BURN_SND_QSND_OUTPUT_2			1
@@ -448,6 +449,12 @@ INT32 Cps1Scr1Draw(UINT8 *Base,INT32 sx,INT32 sy);
 INT32 Cps1Scr3Draw(UINT8 *Base,INT32 sx,INT32 sy);
 INT32 Cps2Scr1Draw(UINT8 *Base,INT32 sx,INT32 sy);
 INT32 Cps2Scr3Draw(UINT8 *Base,INT32 sx,INT32 sy);
+// The tile walks are shared with the layer thread in cps_draw.cpp: pTile plots one tile
+// (nPal = palette, nAttr = tile attribute word) and returns 1 if it was blank
+typedef INT32 (*CpsScrTileFn)(INT32 nType, INT32 nX, INT32 nY, UINT32 nTile, INT32 nFlip, INT16 *pRows, INT32 nPal, INT32 nAttr);
+INT32 CpsScrTile(INT32 nType, INT32 nX, INT32 nY, UINT32 nTile, INT32 nFlip, INT16 *pRows, INT32 nPal, INT32 nAttr);
+void CpsScr1Walk(UINT8 *Base, INT32 sx, INT32 sy, INT32 nTop, INT32 nBottom, CpsScrTileFn pTile);
+void CpsScr3Walk(UINT8 *Base, INT32 sx, INT32 sy, INT32 nTop, INT32 nBottom, CpsScrTileFn pTile);
 
 // cpsr.cpp
 extern UINT8 *CpsrBase;						// Tile data base
@@ -468,8 +475,10 @@ struct CpsrLineInfo {
 extern struct CpsrLineInfo CpsrLineInfo[32];
 INT32 Cps1rPrepare();
 INT32 Cps2rPrepare();
+INT32 CpsrPrepareLines(struct CpsrLineInfo *LineInfo, UINT16 *Rows, INT32 nScrX, INT32 nScrY, INT32 nRowStart, INT32 nEndY);
 
 // cpsrd.cpp
+void CpsrWalk(UINT8 *Base, struct CpsrLineInfo *LineInfo, INT32 nScrY, INT32 nTop, INT32 nBottom, CpsScrTileFn pTile);
 INT32 Cps1rRender();
 INT32 Cps2rRender();
 
@@ -1,4 +1,5 @@
 #include "cps.h"
+#include "thready.h"
 // CPS - Draw
 
 UINT8 CpsRecalcPal = 0;			// Flag - If it is 1, recalc the whole palette
@@ -65,11 +66,10 @@ void DrawFnInit()
 	}
 }
 
-static INT32 DrawScroll1(INT32 i)
+static UINT8 *GetScroll1(INT32 i, INT32 *pnScrX, INT32 *pnScrY)
 {
-	// Draw Scroll 1
+	// Find Scroll 1
 	INT32 nOff, nScrX, nScrY;
-	UINT8 *Find;
 
 	nOff = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsSaveReg[i] + 0x02)));
 	if (Cps1OverrideLayers && nCps1LayerOffs[0] != -1) {
@@ -89,7 +89,18 @@ static INT32 DrawScroll1(INT32 i)
 	nScrY += CpsLayer1YOffs;
 	nOff <<= 8;
 	nOff &= 0xffc000;
-	Find = CpsFindGfxRam(nOff, 0x4000);
+
+	*pnScrX = nScrX;
+	*pnScrY = nScrY;
+	return CpsFindGfxRam(nOff, 0x4000);
+}
+
+static INT32 DrawScroll1(INT32 i)
+{
+	// Draw Scroll 1
+	INT32 nScrX, nScrY;
+	UINT8 *Find = GetScroll1(i, &nScrX, &nScrY);
+
 	if (Find == NULL) {
 		return 1;
 	}
@@ -97,10 +108,12 @@ static INT32 DrawScroll1(INT32 i)
 	return 0;
 }
 
-static INT32 DrawScroll2Init(INT32 i)
+static UINT8 *GetScroll2(INT32 i, INT32 *pnScrX, INT32 *pnScrY, UINT16 **ppRows, INT32 *pnRowStart)
 {
-	// Draw Scroll 2
+	// Find Scroll 2 and its row scroll table
 	INT32 nScr2Off; INT32 n;
+	INT32 nScrX, nScrY;
+	UINT8 *Base;
 
 	nScr2Off = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsSaveReg[i] + 0x04)));
 	if (Cps1OverrideLayers && nCps1LayerOffs[1] != -1) {
@@ -108,32 +121,35 @@ static INT32 DrawScroll2Init(INT32 i)
 	}
 
 	// Get scroll coordinates
-	nCpsrScrX= BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsSaveReg[i] + 0x10))); // Scroll 2 X
-	nCpsrScrY= BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsSaveReg[i] + 0x12))); // Scroll 2 Ytess
+	nScrX= BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsSaveReg[i] + 0x10))); // Scroll 2 X
+	nScrY= BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsSaveReg[i] + 0x12))); // Scroll 2 Ytess
 
 	// Get row scroll information
 	n = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsSaveReg[i] + 0x22)));
 
 	nScr2Off <<= 8;
 
-	nCpsrScrX += 0x40 - nCpsGlobalXOffset;
+	nScrX += 0x40 - nCpsGlobalXOffset;
+
+//	bprintf(PRINT_NORMAL, _T("2 %x, %x, %x\n"), nScr2Off, nScrX, nScrY);
 
-//	bprintf(PRINT_NORMAL, _T("2 %x, %x, %x\n"), nScr2Off, nCpsrScrX, nCpsrScrY);
+	nScrX += CpsLayer2XOffs;
+	nScrX &= 0x03FF;
 
-	nCpsrScrX += CpsLayer2XOffs;
-	nCpsrScrX &= 0x03FF;
+	nScrY += 0x10 - nCpsGlobalYOffset;
+	nScrY += CpsLayer2YOffs;
+	nScrY &= 0x03FF;
 
-	nCpsrScrY += 0x10 - nCpsGlobalYOffset;
-	nCpsrScrY += CpsLayer2YOffs;
-	nCpsrScrY &= 0x03FF;
+	*pnScrX = nScrX;
+	*pnScrY = nScrY;
 
 	nScr2Off &= 0xFFC000;
-	CpsrBase = CpsFindGfxRam(nScr2Off, 0x4000);
-	if (CpsrBase == NULL) {
-		return 1;
+	Base = CpsFindGfxRam(nScr2Off, 0x4000);
+	if (Base == NULL) {
+		return NULL;
 	}
 
-	CpsrRows = NULL;
+	*ppRows = NULL;
 
 	if ((n & 1) && !CpsDisableRowScroll) {
 		INT32 nTab, nStart;
@@ -145,10 +161,21 @@ static INT32 DrawScroll2Init(INT32 i)
 		nTab <<= 8;
 		nTab &= 0xFFF800; // Vampire - Row scroll effect in VS screen background
 
-		CpsrRows = (UINT16 *)CpsFindGfxRam(nTab, 0x0800);
+		*ppRows = (UINT16 *)CpsFindGfxRam(nTab, 0x0800);
 
 		// Find start offset
-		nCpsrRowStart = nStart + 16;
+		*pnRowStart = nStart + 16;
+	}
+
+	return Base;
+}
+
+static INT32 DrawScroll2Init(INT32 i)
+{
+	// Draw Scroll 2
+	CpsrBase = GetScroll2(i, &nCpsrScrX, &nCpsrScrY, &CpsrRows, &nCpsrRowStart);
+	if (CpsrBase == NULL) {
+		return 1;
 	}
 
 	CpsrPrepareDoX();
@@ -173,11 +200,10 @@ inline static INT32 DrawScroll2Do()
 	return 0;
 }
 
-static INT32 DrawScroll3(INT32 i)
+static UINT8 *GetScroll3(INT32 i, INT32 *pnScrX, INT32 *pnScrY)
 {
-	// Draw Scroll 3
+	// Find Scroll 3
 	INT32 nOff, nScrX, nScrY;
-	UINT8 *Find;
 
 	nOff = BURN_ENDIAN_SWAP_INT16(*((UINT16 *)(CpsSaveReg[i] + 0x06)));
 	if (Cps1OverrideLayers && nCps1LayerOffs[2] != -1) {
@@ -198,7 +224,18 @@ static INT32 DrawScroll3(INT32 i)
 
 	nOff <<= 8;
 	nOff &= 0xffc000;
-	Find=CpsFindGfxRam(nOff, 0x4000);
+
+	*pnScrX = nScrX;
+	*pnScrY = nScrY;
+	return CpsFindGfxRam(nOff, 0x4000);
+}
+
+static INT32 DrawScroll3(INT32 i)
+{
+	// Draw Scroll 3
+	INT32 nScrX, nScrY;
+	UINT8 *Find = GetScroll3(i, &nScrX, &nScrY);
+
 	if (Find == NULL) {
 		return 1;
 	}
@@ -229,6 +266,243 @@ static INT32 DrawStar(INT32 nLayer)
 	return 0;
 }
 
+// Layer threading
+// The topmost scroll layer is rendered on a worker thread into a buffer of palette
+// indices while the main thread draws everything below it, then composited at the
+// point where the layer would have been drawn. The worker runs the same tile walks as
+// cps_scr.cpp/cpsrd.cpp (blank tile skipping included), so the output is the same.
+static INT32 bLayerThreading = 0;
+static INT32 nThreadLayer = -1;						// scroll layer (1-3) owned by the worker this frame
+static INT32 nThreadSlices = 0;
+static INT32 bThreadSlice[MAX_RASTER];				// slices the worker has to render
+static UINT16 *pLayerBuf = NULL;					// (pen | palette << 4 | bghi mask << 11), 0 = transparent
+static INT32 nLayerBufSize = 0;
+#define LAYER_MAX_LINES	512
+static INT16 nLayerSpan[LAYER_MAX_LINES][2];		// pixels written on each line, so composite can skip the rest
+static INT32 nLayerTop, nLayerBottom;				// lines the worker is rendering, nLayerTop to nLayerBottom - 1
+
+// Plot one tile into pLayerBuf, the same as CpstOne()/Cps2tOne() and the ctv functions
+// do into pBurnDraw (the tile walks in cps_scr.cpp/cpsrd.cpp call this on the worker).
+// Returns 1 if the tile is blank (in the lines looked at)
+static INT32 LayerTile(INT32 nType, INT32 nX, INT32 nY, UINT32 nTile, INT32 nFlip, INT16 *pRows, INT32 nPal, INT32 nAttr)
+{
+	INT32 nSize = (nType & 24) + 8;
+	INT32 nWords = nSize >> 3;
+	INT32 nTileAdd = (nSize == 32) ? 16 : 8;
+	UINT16 nCode = ((nPal << 4) & 0x7f0) | ((nAttr & 0x180) << 4);
+	UINT32 nBlank = 0;
+	UINT8 *pTile;
+
+	if (Cps == 2 && nY + nSize >= nLayerBottom) nType |= CTT_CARE;
+
+	if ((nType & CTT_CARE) && (nType & CTT_ROWS) == 0) {
+		// Return if not visible at all
+		if (nX <= -nSize || nX >= nCpsScreenWidth) return 0;
+		if (nY <= -nLayerTop - nSize || nY >= nLayerBottom) return 0;
+	}
+
+	// Clip to loaded graphics data
+	nTile &= nCpsGfxMask;
+	if (nTile >= nCpsGfxLen) return (Cps == 2) ? 0 : 1;
+	pTile = CpsGfx + nTile;
+
+	if (nFlip & 2) {
+		pTile += (nSize - 1) * nTileAdd;
+		nTileAdd = -nTileAdd;
+	}
+
+	for (INT32 y = 0; y < nSize; y++, pTile += nTileAdd) {
+		INT32 nLine = nY + y;
+		INT32 nLeft = nX + (pRows ? pRows[y] : 0);
+		INT32 bVisible = (nLine >= nLayerTop && nLine < nLayerBottom);
+
+		// lines clipped off with CTT_CARE don't count towards nBlank
+		if ((nType & CTT_CARE) && !bVisible) continue;
+
+		for (INT32 w = 0; w < nWords; w++) {
+			UINT32 b = ((UINT32 *)pTile)[(nFlip & 1) ? (nWords - 1 - w) : w];
+			INT32 nPixX = nLeft + (w << 3);
+			UINT16 *pDest;
+
+			nBlank |= b;
+			if (b == 0 || !bVisible) continue;
+
+			if (nPixX < nLayerSpan[nLine][0]) nLayerSpan[nLine][0] = (nPixX < 0) ? 0 : nPixX;
+			if (nPixX + 8 > nLayerSpan[nLine][1]) nLayerSpan[nLine][1] = (nPixX + 8 > nCpsScreenWidth) ? nCpsScreenWidth : (nPixX + 8);
+
+			pDest = pLayerBuf + nLine * nCpsScreenWidth;
+			if (nPixX >= 0 && nPixX + 8 <= nCpsScreenWidth) {
+#define LAYER_PLOT(n, s) { UINT32 c = (b >> (s)) & 15; if (c) pDest[nPixX + (n)] = nCode | c; }
+				if (nFlip & 1) {
+					LAYER_PLOT(0, 0) LAYER_PLOT(1, 4) LAYER_PLOT(2, 8) LAYER_PLOT(3, 12) LAYER_PLOT(4, 16) LAYER_PLOT(5, 20) LAYER_PLOT(6, 24) LAYER_PLOT(7, 28)
+				} else {
+					LAYER_PLOT(0, 28) LAYER_PLOT(1, 24) LAYER_PLOT(2, 20) LAYER_PLOT(3, 16) LAYER_PLOT(4, 12) LAYER_PLOT(5, 8) LAYER_PLOT(6, 4) LAYER_PLOT(7, 0)
+				}
+#undef LAYER_PLOT
+			} else {
+				for (INT32 x = 0; x < 8; x++, nPixX++) {
+					UINT32 c = (nFlip & 1) ? ((b >> (x << 2)) & 15) : ((b >> (28 - (x << 2))) & 15);
+
+					if (c && nPixX >= 0 && nPixX < nCpsScreenWidth) {
+						pDest[nPixX] = nCode | c;
+					}
+				}
+			}
+		}
+	}
+
+	return nBlank == 0;
+}
+
+static void LayerThreadCallback()
+{
+	for (INT32 nSlice = 0; nSlice < nThreadSlices; nSlice++) {
+		struct CpsrLineInfo LineInfo[32];
+		INT32 nScrX, nScrY, nRowStart = 0;
+		UINT16 *Rows = NULL;
+		UINT8 *Base = NULL;
+
+		if (!bThreadSlice[nSlice]) continue;
+
+		if (Cps == 2) {
+			nLayerTop = nRasterline[nSlice];
+			nLayerBottom = nRasterline[nSlice + 1] ? nRasterline[nSlice + 1] : nCpsScreenHeight;
+		} else {
+			nLayerTop = 0;
+			nLayerBottom = nCpsScreenHeight;
+		}
+
+		memset(pLayerBuf + nLayerTop * nCpsScreenWidth, 0, (nLayerBottom - nLayerTop) * nCpsScreenWidth * sizeof(UINT16));
+		for (INT32 y = nLayerTop; y < nLayerBottom; y++) {
+			nLayerSpan[y][0] = nCpsScreenWidth;
+			nLayerSpan[y][1] = 0;
+		}
+
+		// the same walks the main thread uses, with the line table built locally
+		switch (nThreadLayer) {
+			case 1:
+				Base = GetScroll1(nSlice, &nScrX, &nScrY);
+				if (Base) CpsScr1Walk(Base, nScrX, nScrY, nLayerTop, nLayerBottom, LayerTile);
+				break;
+			case 2:
+				Base = GetScroll2(nSlice, &nScrX, &nScrY, &Rows, &nRowStart);
+				if (Base) {
+					CpsrPrepareLines(LineInfo, Rows, nScrX, nScrY, nRowStart, nLayerBottom);
+					CpsrWalk(Base, LineInfo, nScrY, nLayerTop, nLayerBottom, LayerTile);
+				}
+				break;
+			case 3:
+				Base = GetScroll3(nSlice, &nScrX, &nScrY);
+				if (Base) CpsScr3Walk(Base, nScrX, nScrY, nLayerTop, nLayerBottom, LayerTile);
+				break;
+		}
+	}
+}
+
+void CpsSetLayerThreading(INT32 bEnable)
+{
+	if (bEnable && !bLayerThreading) {
+		thready.init(LayerThreadCallback);
+	}
+	if (!bEnable && bLayerThreading) {
+		thready.exit();
+		BurnFree(pLayerBuf);
+		nLayerBufSize = 0;
+	}
+
+	bLayerThreading = bEnable;
+	nThreadLayer = -1;
+}
+
+// Hand nLayer (for the slices flagged in bThreadSlice) to the worker
+static void LayerThreadStart(INT32 nLayer, INT32 nSlices)
+{
+	INT32 nSize = nCpsScreenWidth * nCpsScreenHeight;
+
+	nThreadLayer = -1;
+	if (!bLayerThreading || nLayer < 1 || nCpsScreenHeight > LAYER_MAX_LINES) return;
+
+	if (nLayerBufSize != nSize) {
+		BurnFree(pLayerBuf);
+		pLayerBuf = (UINT16 *)BurnMalloc(nSize * sizeof(UINT16));
+		nLayerBufSize = (pLayerBuf) ? nSize : 0;
+		if (pLayerBuf == NULL) return;
+	}
+
+	nThreadLayer = nLayer;
+	nThreadSlices = nSlices;
+	thready.notify();
+}
+
+static void LayerThreadWait()
+{
+	if (nThreadLayer > 0) {
+		thready.notify_wait();
+	}
+}
+
+// Draw lines nFrom to nTo - 1 of the worker's layer, only the pens let through by the
+// CPS1 BgHi masks if bBgHi is set
+static void LayerThreadComposite(INT32 nFrom, INT32 nTo, INT32 bBgHi)
+{
+	UINT32 nMask[4];
+
+	LayerThreadWait();
+
+	for (INT32 i = 0; i < 4; i++) {
+		nMask[i] = BURN_ENDIAN_SWAP_INT16(*(UINT16 *)(CpsSaveReg[0] + MaskAddr[i]));
+	}
+
+	for (INT32 y = nFrom; y < nTo; y++) {
+		UINT16 *pSrc = pLayerBuf + y * nCpsScreenWidth;
+		UINT8 *pDest = pBurnDraw + y * nBurnPitch;
+		INT32 nLeft = nLayerSpan[y][0], nRight = nLayerSpan[y][1];
+
+#define LAYER_SKIP(v) (v == 0 || (bBgHi && (nMask[v >> 11] & (1 << ((v & 15) ^ 15))) == 0))
+		switch (nBurnBpp) {
+			case 2:
+				for (INT32 x = nLeft; x < nRight; x++) {
+					UINT32 v = pSrc[x];
+					if (!LAYER_SKIP(v)) ((UINT16 *)pDest)[x] = (UINT16)CpsPal[v & 0x7ff];
+				}
+				break;
+
+			case 3:
+				pDest += nLeft * 3;
+				for (INT32 x = nLeft; x < nRight; x++, pDest += 3) {
+					UINT32 v = pSrc[x], c;
+					if (LAYER_SKIP(v)) continue;
+					c = CpsPal[v & 0x7ff];
+					pDest[0] = (UINT8)c; pDest[1] = (UINT8)(c >> 8); pDest[2] = (UINT8)(c >> 16);
+				}
+				break;
+
+			case 4:
+				for (INT32 x = nLeft; x < nRight; x++) {
+					UINT32 v = pSrc[x];
+					if (!LAYER_SKIP(v)) ((UINT32 *)pDest)[x] = CpsPal[v & 0x7ff];
+				}
+				break;
+		}
+#undef LAYER_SKIP
+	}
+}
+
+// Draw one of the CPS1 scroll layers (or the BgHi part of it)
+static void Cps1Scroll(INT32 n)
+{
+	if (n == nThreadLayer) {
+		LayerThreadComposite(0, nCpsScreenHeight, nBgHi);
+		return;
+	}
+
+	switch (n) {
+		case 1: DrawScroll1(0); break;
+		case 2: DrawScroll2Do(); break;
+		case 3: DrawScroll3(0); break;
+	}
+}
+
 static void Cps1Layers()
 {
   INT32 Draw[4]={-1,-1,-1,-1};
@@ -266,6 +540,13 @@ static void Cps1Layers()
   CRP(0,1) CRP(0,2) CRP(0,3) CRP(1,2) CRP(1,3) CRP(2,3)
 #undef CRP
 
+  // the worker takes the topmost scroll layer
+  for (i=0;i<4;i++) {
+    if (Draw[i] > 0 && (nDrawMask & (1 << Draw[i]))) break;
+  }
+  bThreadSlice[0] = 1;
+  LayerThreadStart((i < 4) ? Draw[i] : -1, 1);
+
   for (i = 0; i < 2; i++) {
 	  if (LayerCont & CpsLayEn[4 + i]) {
 		  DrawStar(i);
@@ -273,7 +554,7 @@ static void Cps1Layers()
   }
 
   // prepare layer 2
-  DrawScroll2Init(0);
+  if (nThreadLayer != 2) DrawScroll2Init(0);
 
   // draw layers, bottom -> top
   for (i=3;i>=0;i--)
@@ -287,13 +568,13 @@ static void Cps1Layers()
 		nBgHi=1;
 		switch (Draw[i+1]) {
 			case 1:
-				if (nDrawMask & 2) 	DrawScroll1(0);
+				if (nDrawMask & 2) 	Cps1Scroll(1);
 				break;
 			case 2:
-				if (nDrawMask & 4)  DrawScroll2Do();
+				if (nDrawMask & 4)  Cps1Scroll(2);
 				break;
 			case 3:
-				if (nDrawMask & 8)  DrawScroll3(0);
+				if (nDrawMask & 8)  Cps1Scroll(3);
 				break;
 		}
 		nBgHi=0;
@@ -303,13 +584,13 @@ static void Cps1Layers()
     // Then Draw the scroll layer on top
     switch (n) {
 		case 1:
-			if (nDrawMask & 2) DrawScroll1(0);
+			if (nDrawMask & 2) Cps1Scroll(1);
 			break;
 		case 2:
-			if (nDrawMask & 4) DrawScroll2Do();
+			if (nDrawMask & 4) Cps1Scroll(2);
 			break;
 		case 3:
-			if (nDrawMask & 8) DrawScroll3(0);
+			if (nDrawMask & 8) Cps1Scroll(3);
 			break;
 	}
   }
@@ -385,6 +666,22 @@ static void Cps2Layers()
 		nSlice++;
 	} while (nSlice < MAX_RASTER && nRasterline[nSlice]);
 
+	// The worker takes the topmost scroll layer, in every slice it is drawn in
+	INT32 nLayer = -1;
+	for (INT32 i = 3; i >= 0; i--) {
+		if (Draw[0][i] > 0 && (nDrawMask[0] & (1 << Draw[0][i]))) {
+			nLayer = Draw[0][i];
+			break;
+		}
+	}
+	for (INT32 n = 0; n < nSlice; n++) {
+		bThreadSlice[n] = 0;
+		for (INT32 i = 0; i < 4; i++) {
+			if (nLayer > 0 && Draw[n][i] == nLayer && (nDrawMask[n] & (1 << nLayer))) bThreadSlice[n] = 1;
+		}
+	}
+	LayerThreadStart(nLayer, nSlice);
+
 	INT32 nPrevPrio = -1;
 	for (INT32 nCurrPrio = 0; nCurrPrio < 8; nCurrPrio++) {
 
@@ -406,6 +703,11 @@ static void Cps2Layers()
 					}
 
 					// Render layer
+					if (Draw[nSlice][i] == nThreadLayer && bThreadSlice[nSlice]) {
+						LayerThreadComposite(nStartline, nEndline, 0);
+						continue;
+					}
+
 					switch (Draw[nSlice][i]) {
 						case 1:
 							if (nDrawMask[nSlice] & 2) {
@@ -505,6 +807,9 @@ static void DoDraw(INT32 Recalc)
 	CpsClearScreen();
 
 	CpsLayersDoX();
+
+	LayerThreadWait();
+	nThreadLayer = -1;
 }
 
 INT32 CpsDraw()
@@ -200,6 +200,7 @@ INT32 CpsRunInit()
 
 	//Init Draw Function
 	DrawFnInit();
+	CpsSetLayerThreading(bBurnVideoThreading);
 	
 	pBurnDrvPalette = CpsPal;
 	
@@ -219,6 +220,7 @@ INT32 CpsRunExit()
 	if (Cps != 2 && Cps1Qs == 0 && !Cps1DisablePSnd) PsndExit();
 
 	// Graphics exit
+	CpsSetLayerThreading(0);
 	CpsObjExit();
 	CpsPalExit();
 
@@ -12,75 +12,39 @@ INT32 Scroll1TileMask = 0;
 INT32 Scroll2TileMask = 0;
 INT32 Scroll3TileMask = 0;
 
-INT32 Cps1Scr1Draw(UINT8 *Base,INT32 sx,INT32 sy)
+// Plot one scroll tile with the CpstOne functions (into pBurnDraw)
+INT32 CpsScrTile(INT32 nType, INT32 nX, INT32 nY, UINT32 nTile, INT32 nFlip, INT16 *pRows, INT32 nPal, INT32 nAttr)
 {
-  INT32 x,y;
-  INT32 ix,iy;
-  INT32 nKnowBlank=-1; // The tile we know is blank
-  INT32 nXTile = nCpsScreenWidth>>3; // 8x8 tiles
-  INT32 nYTile = nCpsScreenHeight>>3; // ""
-
-  ix=(sx>>3)+1; iy=(sy>>3)+1;
-  sx&=7; sy&=7; sx=8-sx; sy=8-sy;
-
-  for (y=-1; y<nYTile; y++)
-  {
-    for (x=-1; x<nXTile; x++)
-    {
-      INT32 t,a;
-      UINT16 *pst;
-      INT32 fx,fy,p;
-      fx=ix+x; fy=iy+y; // fx/fy= 0 to 63
-
-      // Find tile address
-      p=((fy&0x20)<<8) | ((fx&0x3f)<<7) | ((fy&0x1f)<<2);
-      p&=0x3fff;
-      pst=(UINT16 *)(Base + p);
-
-      t = BURN_ENDIAN_SWAP_INT16(pst[0]);
-      
-      if (Scroll1TileMask) t &= Scroll1TileMask;
-      
-      t = GfxRomBankMapper(GFXTYPE_SCROLL1, t);
-      if (t == -1) continue;
-            
-      t<<=6; // Get real tile address
-
-      t+=nCpsGfxScroll[1]; // add on offset to scroll tiles
-      if (t==nKnowBlank) continue; // Don't draw: we know it's blank
-
-      a = BURN_ENDIAN_SWAP_INT16(pst[1]);
-
-      CpstSetPal(0x20 | (a&0x1f));
-
-      // Don't need to clip except around the border
-      if (x<0 || x>=nXTile-1 || y<0 || y>=nYTile-1)
-        nCpstType=CTT_8X8 | CTT_CARE;
-      else
-        nCpstType=CTT_8X8;
-
-      nCpstX=sx+(x<<3); nCpstY=sy+(y<<3);
-      nCpstTile=t; nCpstFlip=(a>>5)&3;
-
-	  if (nBgHi) {
-		  CpstPmsk = BURN_ENDIAN_SWAP_INT16(*(UINT16*)(CpsSaveReg[0] + MaskAddr[(a & 0x180) >> 7]));
-	  }
-
-	  if(CpstOneDoX[nBgHi]()) nKnowBlank=t;
-
-    }
-  }
-
-  return 0;
+	CpstSetPal(nPal);
+
+	nCpstType = nType;
+	nCpstX = nX;
+	nCpstY = nY;
+	nCpstTile = nTile;
+	nCpstFlip = nFlip;
+	if (pRows) CpstRowShift = pRows;
+
+	if (Cps == 2) {
+		return CpstOneDoX[2]();
+	}
+
+	if (nBgHi) {
+		CpstPmsk = BURN_ENDIAN_SWAP_INT16(*(UINT16*)(CpsSaveReg[0] + MaskAddr[(nAttr & 0x180) >> 7]));
+	}
+
+	return CpstOneDoX[nBgHi]();
 }
 
-INT32 Cps2Scr1Draw(UINT8 *Base, INT32 sx, INT32 sy)
+// Walk the visible Scroll 1 tiles: lines nTop to nBottom - 1 on CPS2 (the raster slice),
+// the whole screen on CPS1
+void CpsScr1Walk(UINT8 *Base, INT32 sx, INT32 sy, INT32 nTop, INT32 nBottom, CpsScrTileFn pTile)
 {
 	INT32 x, y;
 	INT32 ix, iy;
 	INT32 nFirstY, nLastY;
 	INT32 nKnowBlank = -1; // The tile we know is blank
 	INT32 nXTile = nCpsScreenWidth>>3; // 8x8 tiles
+	INT32 nYTile = nCpsScreenHeight>>3;
 
 	ix = (sx >> 3) + 1;
 	sx &= 7;
@@ -89,13 +53,24 @@ INT32 Cps2Scr1Draw(UINT8 *Base, INT32 sx, INT32 sy)
 	iy = (sy >> 3) + 1;
 	sy &= 7;
 
-	nLastY = (nEndline + sy) >> 3;
-	nFirstY = (nStartline + sy) >> 3;
+	if (Cps == 2) {
+		nLastY = (nBottom + sy) >> 3;
+		nFirstY = (nTop + sy) >> 3;
+	} else {
+		nLastY = nYTile;
+		nFirstY = 0;
+	}
 
 	sy = 8 - sy;
 
 	for (y = nFirstY - 1; y < nLastY; y++) {
-		INT32 nClipY = ((y << 3) < nStartline) | (((y << 3) + 8) >= nEndline);
+		INT32 nClipY;
+		if (Cps == 2) {
+			nClipY = ((y << 3) < nTop) | (((y << 3) + 8) >= nBottom);
+		} else {
+			nClipY = (y < 0 || y >= nYTile - 1);
+		}
+
 		for (x = -1; x < nXTile; x++) {
 			INT32 t, a;
 			UINT16 *pst;
@@ -109,103 +84,38 @@ INT32 Cps2Scr1Draw(UINT8 *Base, INT32 sx, INT32 sy)
 			pst = (UINT16 *)(Base + p);
 
 			t = BURN_ENDIAN_SWAP_INT16(pst[0]);
-			t <<= 6;										// Get real tile address
 
-			t += nCpsGfxScroll[1];							// add on offset to scroll tiles
+			if (Cps != 2) {
+				if (Scroll1TileMask) t &= Scroll1TileMask;
 
-			if (t != nKnowBlank) {							// Draw tile
-				a = BURN_ENDIAN_SWAP_INT16(pst[1]);
+				t = GfxRomBankMapper(GFXTYPE_SCROLL1, t);
+				if (t == -1) continue;
+			}
 
-				CpstSetPal(0x20 | (a & 0x1F));
+			t <<= 6;										// Get real tile address
+			t += nCpsGfxScroll[1];							// add on offset to scroll tiles
 
-				nCpstX = sx + (x << 3);
-				nCpstY = sy + (y << 3);
-				nCpstTile = t;
-				nCpstFlip = (a >> 5) & 3;
+			if (t == nKnowBlank) continue;					// Don't draw: we know it's blank
 
-				// Don't need to clip except around the border
-				if (x < 0 || x >= nXTile - 1 || nClipY) {
-					nCpstType = CTT_8X8 | CTT_CARE;
-				} else {
-					nCpstType = CTT_8X8;
-				}
+			a = BURN_ENDIAN_SWAP_INT16(pst[1]);
 
-				if (CpstOneDoX[2]()) {
-					nKnowBlank = t;
-				}
+			// Don't need to clip except around the border
+			if (pTile((x < 0 || x >= nXTile - 1 || nClipY) ? (CTT_8X8 | CTT_CARE) : CTT_8X8, sx + (x << 3), sy + (y << 3), t, (a >> 5) & 3, NULL, 0x20 | (a & 0x1F), a)) {
+				nKnowBlank = t;
 			}
 		}
 	}
-	return 0;
 }
 
-INT32 Cps1Scr3Draw(UINT8 *Base,INT32 sx,INT32 sy)
-{
-  INT32 x,y;
-  INT32 ix,iy;
-  INT32 nKnowBlank=-1; // The tile we know is blank
-  ix=(sx>>5)+1; iy=(sy>>5)+1;
-  sx&=31; sy&=31; sx=32-sx; sy=32-sy;
-  INT32 nXTile = nCpsScreenWidth>>5; // 32x32 tiles
-  INT32 nYTile = nCpsScreenHeight>>5;
-
-  for (y=-1; y<nYTile; y++)
-  {
-    for (x=-1; x<nXTile; x++)
-    {
-      INT32 t,a;
-      UINT16 *pst;
-      INT32 fx,fy,p;
-      fx=ix+x; fy=iy+y; // fx/fy= 0 to 63
-
-      // Find tile address
-      p=((fy&0x38)<<8) | ((fx&0x3f)<<5) | ((fy&0x07)<<2);
-      p&=0x3fff;
-      pst=(UINT16 *)(Base + p);
-
-      t = BURN_ENDIAN_SWAP_INT16(pst[0]);
-      
-      if (Scroll3TileMask) t &= Scroll3TileMask;
-      
-      t = GfxRomBankMapper(GFXTYPE_SCROLL3, t);
-      if (t == -1) continue;
-
-      t<<=9; // Get real tile address
-      t+=nCpsGfxScroll[3]; // add on offset to scroll tiles
-      
-      if (t==nKnowBlank) continue; // Don't draw: we know it's blank
-
-      a = BURN_ENDIAN_SWAP_INT16(pst[1]);
-
-      CpstSetPal(0x60 | (a&0x1f));
-
-      // Don't need to clip except around the border
-      if (x<0 || x>=nXTile-1 || y<0 || y>=nYTile-1)
-        nCpstType=CTT_32X32 | CTT_CARE;
-      else
-        nCpstType=CTT_32X32;
-
-      nCpstX=sx+(x<<5); nCpstY=sy+(y<<5);
-      nCpstTile=t; nCpstFlip=(a>>5)&3;
-
-	  if (nBgHi) {
-		  CpstPmsk = BURN_ENDIAN_SWAP_INT16(*(UINT16*)(CpsSaveReg[0] + MaskAddr[(a & 0x180) >> 7]));
-	  }
-
-      if(CpstOneDoX[nBgHi]()) nKnowBlank=t;
-    }
-  }
-
-  return 0;
-}
-
-INT32 Cps2Scr3Draw(UINT8 *Base, INT32 sx, INT32 sy)
+// Walk the visible Scroll 3 tiles, the same way
+void CpsScr3Walk(UINT8 *Base, INT32 sx, INT32 sy, INT32 nTop, INT32 nBottom, CpsScrTileFn pTile)
 {
 	INT32 x, y;
 	INT32 ix, iy;
 	INT32 nFirstY, nLastY;
 	INT32 nKnowBlank = -1; // The tile we know is blank
 	INT32 nXTile = nCpsScreenWidth>>5; // 32x32 tiles
+	INT32 nYTile = nCpsScreenHeight>>5;
 
 	ix = (sx >> 5) + 1;
 	sx &= 31;
@@ -214,13 +124,24 @@ INT32 Cps2Scr3Draw(UINT8 *Base, INT32 sx, INT32 sy)
 	iy = (sy >> 5) + 1;
 	sy &= 31;
 
-	nLastY = (nEndline + sy) >> 5;
-	nFirstY = (nStartline + sy) >> 5;
+	if (Cps == 2) {
+		nLastY = (nBottom + sy) >> 5;
+		nFirstY = (nTop + sy) >> 5;
+	} else {
+		nLastY = nYTile;
+		nFirstY = 0;
+	}
 
 	sy = 32 - sy;
 
 	for (y = nFirstY - 1; y < nLastY; y++) {
-		INT32 nClipY = ((y << 5) < nStartline) | (((y << 5) + 32) >= nEndline);
+		INT32 nClipY;
+		if (Cps == 2) {
+			nClipY = ((y << 5) < nTop) | (((y << 5) + 32) >= nBottom);
+		} else {
+			nClipY = (y < 0 || y >= nYTile - 1);
+		}
+
 		for (x = -1; x < nXTile; x++) {
 			INT32 t, a;
 			UINT16 *pst;
@@ -235,35 +156,53 @@ INT32 Cps2Scr3Draw(UINT8 *Base, INT32 sx, INT32 sy)
 
 			t = BURN_ENDIAN_SWAP_INT16(pst[0]);
 
-			if(Xmcota && t>=0x5800)      t-=0x4000;
-	        else if(Ssf2t && t<0x5600)   t+=0x4000;
-			t <<= 9;										// Get real tile address
-			if (Cps2Turbo) t &= ~nCpsGfxScroll[3];			// buggy hack
- 			t += nCpsGfxScroll[3];							// add on offset to scroll tiles
+			if (Cps == 2) {
+				if (Xmcota && t >= 0x5800)    t -= 0x4000;
+				else if (Ssf2t && t < 0x5600) t += 0x4000;
+				t <<= 9;									// Get real tile address
+				if (Cps2Turbo) t &= ~nCpsGfxScroll[3];		// buggy hack
+			} else {
+				if (Scroll3TileMask) t &= Scroll3TileMask;
 
-			if (t != nKnowBlank) {							// Draw tile
-				a = BURN_ENDIAN_SWAP_INT16(pst[1]);
+				t = GfxRomBankMapper(GFXTYPE_SCROLL3, t);
+				if (t == -1) continue;
 
-				CpstSetPal(0x60 | (a & 0x1F));
+				t <<= 9;									// Get real tile address
+			}
+			t += nCpsGfxScroll[3];							// add on offset to scroll tiles
 
-				nCpstX = sx + (x << 5);
-				nCpstY = sy + (y << 5);
-				nCpstTile = t;
-				nCpstFlip = (a >> 5) & 3;
+			if (t == nKnowBlank) continue;					// Don't draw: we know it's blank
 
-				// Don't need to clip except around the border
-				if (x < 0 || x >= nXTile - 1 || nClipY) {
-					nCpstType = CTT_32X32 | CTT_CARE;
-				} else {
-					nCpstType = CTT_32X32;
-				}
+			a = BURN_ENDIAN_SWAP_INT16(pst[1]);
 
-				if (CpstOneDoX[2]()) {
-					nKnowBlank = t;
-				}
+			// Don't need to clip except around the border
+			if (pTile((x < 0 || x >= nXTile - 1 || nClipY) ? (CTT_32X32 | CTT_CARE) : CTT_32X32, sx + (x << 5), sy + (y << 5), t, (a >> 5) & 3, NULL, 0x60 | (a & 0x1F), a)) {
+				nKnowBlank = t;
 			}
 		}
 	}
+}
+
+INT32 Cps1Scr1Draw(UINT8 *Base,INT32 sx,INT32 sy)
+{
+	CpsScr1Walk(Base, sx, sy, 0, nCpsScreenHeight, CpsScrTile);
+	return 0;
+}
+
+INT32 Cps2Scr1Draw(UINT8 *Base, INT32 sx, INT32 sy)
+{
+	CpsScr1Walk(Base, sx, sy, nStartline, nEndline, CpsScrTile);
 	return 0;
 }
 
+INT32 Cps1Scr3Draw(UINT8 *Base,INT32 sx,INT32 sy)
+{
+	CpsScr3Walk(Base, sx, sy, 0, nCpsScreenHeight, CpsScrTile);
+	return 0;
+}
+
+INT32 Cps2Scr3Draw(UINT8 *Base, INT32 sx, INT32 sy)
+{
+	CpsScr3Walk(Base, sx, sy, nStartline, nEndline, CpsScrTile);
+	return 0;
+}
@@ -6,22 +6,20 @@ UINT8 *CpsrBase=NULL; // Tile data base
 INT32 nCpsrScrX=0,nCpsrScrY=0; // Basic scroll info
 UINT16 *CpsrRows=NULL; // Row scroll table, 0x400 words long
 int nCpsrRowStart=0; // Start of row scroll (can wrap?)
-static INT32 nShiftY=0;
-static INT32 EndLineInfo=0;
 
 struct CpsrLineInfo CpsrLineInfo[32]; // supports up to 512-y lines
 
-static void GetRowsRange(INT32 *pnStart,INT32 *pnWidth,INT32 nRowFrom,INT32 nRowTo)
+static void GetRowsRange(UINT16 *Rows,INT32 *pnStart,INT32 *pnWidth,INT32 nRowFrom,INT32 nRowTo)
 {
   INT32 i,nStart,nWidth;
 
   // Get the range of scroll values within nRowCount rows
   // Start with zero range
-  nStart = BURN_ENDIAN_SWAP_INT16(CpsrRows[nRowFrom&0x3ff]); nStart&=0x3ff; nWidth=0;
+  nStart = BURN_ENDIAN_SWAP_INT16(Rows[nRowFrom&0x3ff]); nStart&=0x3ff; nWidth=0;
   for (i=nRowFrom;i<nRowTo;i++)
   {
     INT32 nViz; INT32 nDiff;
-    nViz = BURN_ENDIAN_SWAP_INT16(CpsrRows[i&0x3ff]); nViz&=0x3ff;
+    nViz = BURN_ENDIAN_SWAP_INT16(Rows[i&0x3ff]); nViz&=0x3ff;
     // Work out if this is on the left or the right of our
     // start point.
     nDiff=nViz-nStart;
@@ -47,7 +45,7 @@ static void GetRowsRange(INT32 *pnStart,INT32 *pnWidth,INT32 nRowFrom,INT32 nRow
 }
 
 
-static INT32 PrepareRows()
+static INT32 PrepareRows(struct CpsrLineInfo *LineInfo,UINT16 *Rows,INT32 nScrX,INT32 nRowStart,INT32 nShiftY,INT32 nEndY,INT32 EndLineInfo)
 {
   INT32 y; INT32 r;
   struct CpsrLineInfo *pli;
@@ -56,17 +54,17 @@ static INT32 PrepareRows()
   // (x-pli->nTileStart)<<4  -  i.e. 0, 16, ...
 
   r=nShiftY-16;
-  for (y = -1, pli = CpsrLineInfo; y < EndLineInfo; y++, pli++)
+  for (y = -1, pli = LineInfo; y < EndLineInfo; y++, pli++)
   {
     // Maximum row scroll left and right on this line
     INT32 nMaxLeft=0,nMaxRight=0;
     INT32 ty; INT16 *pr;
 
-    if (CpsrRows==NULL)
+    if (Rows==NULL)
     {
       // No row shift - all the same
       INT32 v;
-      v =(pli->nTileStart<<4)-nCpsrScrX;
+      v =(pli->nTileStart<<4)-nScrX;
       nMaxLeft=v; nMaxRight=v;
       for (ty=0,pr=pli->Rows; ty<16; ty++,pr++)
       {
@@ -78,11 +76,11 @@ static INT32 PrepareRows()
       for (ty=0,pr=pli->Rows; ty<16; ty++,pr++,r++)
       {
         // Get the row offset, if it's in range
-        if (r>=0 && r<nEndline)
+        if (r>=0 && r<nEndY)
         {
           INT32 v;
-		  v =(pli->nTileStart<<4)-nCpsrScrX;
-          v -= BURN_ENDIAN_SWAP_INT16(CpsrRows[(nCpsrRowStart+r-nCpsGlobalYOffset)&0x3ff]);
+		  v =(pli->nTileStart<<4)-nScrX;
+          v -= BURN_ENDIAN_SWAP_INT16(Rows[(nRowStart+r-nCpsGlobalYOffset)&0x3ff]);
           // clip to 10-bit signed
           v+=0x200; v&=0x3ff; v-=0x200;
           *pr=(INT16)v;
@@ -115,36 +113,45 @@ INT32 Cps1rPrepare()
 }
 
 INT32 Cps2rPrepare()
+{
+  if (CpsrBase==NULL) return 1;
+
+  return CpsrPrepareLines(CpsrLineInfo, CpsrRows, nCpsrScrX, nCpsrScrY, nCpsrRowStart, nEndline);
+}
+
+// The same for an explicit set of scroll values, so the layer thread in
+// cps_draw.cpp can build its own table without touching the globals above
+INT32 CpsrPrepareLines(struct CpsrLineInfo *LineInfo, UINT16 *Rows, INT32 nScrX, INT32 nScrY, INT32 nRowStart, INT32 nEndY)
 {
   INT32 y;
   struct CpsrLineInfo *pli;
-  if (CpsrBase==NULL) return 1;
+  INT32 nShiftY, EndLineInfo;
 
-  EndLineInfo = ((nEndline + 15) >> 4);
+  EndLineInfo = ((nEndY + 15) >> 4);
 
-  nShiftY=16-(nCpsrScrY&15);
-  for (y = -1, pli = CpsrLineInfo; y < EndLineInfo; y++, pli++)
+  nShiftY=16-(nScrY&15);
+  for (y = -1, pli = LineInfo; y < EndLineInfo; y++, pli++)
   {
     INT32 nStart=0,nWidth=0;
 
-    if (CpsrRows!=NULL)
+    if (Rows!=NULL)
     {
       INT32 nRowFrom,nRowTo;
       // Find out which rows we need to check
       nRowFrom=(y<<4)+nShiftY;
       nRowTo=nRowFrom+16;
       if (nRowFrom < 0) nRowFrom = 0;
-      if (nRowTo > nEndline) nRowTo = nEndline;
+      if (nRowTo > nEndY) nRowTo = nEndY;
 
       // Shift by row table start offset
-      nRowFrom+=nCpsrRowStart;
-      nRowTo  +=nCpsrRowStart;
+      nRowFrom+=nRowStart;
+      nRowTo  +=nRowStart;
 
       // Find out what range of scroll values there are for this line
-      GetRowsRange(&nStart,&nWidth,nRowFrom,nRowTo);
+      GetRowsRange(Rows,&nStart,&nWidth,nRowFrom,nRowTo);
     }
 
-    nStart+=nCpsrScrX;
+    nStart+=nScrX;
     nStart&=0x3ff;
 
     // Save info in CpsrLineInfo table
@@ -155,7 +162,7 @@ INT32 Cps2rPrepare()
     pli->nTileEnd=(nStart+nWidth+nCpsScreenWidth+15)>>4;
   }
 
-  PrepareRows();
+  PrepareRows(LineInfo, Rows, nScrX, nRowStart, nShiftY, nEndY, EndLineInfo);
   return 0;
 }
 
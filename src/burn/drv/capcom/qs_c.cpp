@@ -806,6 +806,26 @@ UINT8 QscRead()
 	return chip.ready_flag;
 }
 
+// the routed samples are collected here and clamped to the output a block at a time
+#define QSC_MIX_LEN		256
+
+static INT32 nQscMix[QSC_MIX_LEN * 2];
+static INT32 nQscMixed;
+
+static inline void QscMixFlush(INT16 **pDest)
+{
+	BurnSoundClampStereo(nQscMix, *pDest, nQscMixed);
+	*pDest += nQscMixed << 1;
+	nQscMixed = 0;
+}
+
+static inline void QscMixSample(INT16 **pDest, INT32 nLeftSample, INT32 nRightSample)
+{
+	nQscMix[(nQscMixed << 1) + 0] = nLeftSample;
+	nQscMix[(nQscMixed << 1) + 1] = nRightSample;
+	if (++nQscMixed == QSC_MIX_LEN) QscMixFlush(pDest);
+}
+
 INT32 QscUpdate(INT32 nEnd)
 {
 	INT32 nLen;
@@ -854,9 +874,9 @@ INT32 QscUpdate(INT32 nEnd)
 				nRightSample += (INT32)(nRightOut * QsndGain[BURN_SND_QSND_OUTPUT_2]);
 			}
 
-			pDest[(i << 1) + 0] = BURN_SND_CLIP(nLeftSample);
-			pDest[(i << 1) + 1] = BURN_SND_CLIP(nRightSample);
+			QscMixSample(&pDest, nLeftSample, nRightSample);
 		}
+		QscMixFlush(&pDest);
 		nPos = nEnd;
 
 		return 0;
@@ -907,9 +927,9 @@ INT32 QscUpdate(INT32 nEnd)
 			nRightSample += (INT32)(nRightOut * QsndGain[BURN_SND_QSND_OUTPUT_2]);
 		}
 
-		pDest[(i << 1) + 0] = BURN_SND_CLIP(nLeftSample);
-		pDest[(i << 1) + 1] = BURN_SND_CLIP(nRightSample);
+		QscMixSample(&pDest, nLeftSample, nRightSample);
 	}
+	QscMixFlush(&pDest);
 	nPos = nEnd;
 
 	return 0;
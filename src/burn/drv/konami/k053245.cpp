@@ -355,21 +355,23 @@ void K053245SpritesRender(INT32 chip)
 				c = ((c & 0x3f) | (code & ~0x3f)) & K053245MaskExp[chip];
 
 				if (shadow) {
-					konami_render_zoom_shadow_sprite(gfxdata, c, nBpp[chip], color, sx >> 12, sy >> 12, fx, fy, 16, 16, zw, zh, pri, 0);
+					konami_sprite_list_add(gfxdata, KONAMI_SPRITE_SHADOW, c, nBpp[chip], color, sx >> 12, sy >> 12, fx, fy, zw, zh, pri, 0);
 					continue;
 				}
 
 				if (zoomx == 0x10000 && zoomy == 0x10000)
 				{
-					konami_draw_16x16_prio_sprite(gfxdata, c, nBpp[chip], color, sx >> 12, sy >> 12, fx, fy, pri);
+					konami_sprite_list_add(gfxdata, KONAMI_SPRITE_PRIO, c, nBpp[chip], color, sx >> 12, sy >> 12, fx, fy, 0, 0, pri, 0);
 				}
 				else
 				{
-					konami_draw_16x16_priozoom_sprite(gfxdata, c, nBpp[chip], color, 0, sx >> 12, sy >> 12, fx, fy, 16, 16, zw, zh, pri);
+					konami_sprite_list_add(gfxdata, KONAMI_SPRITE_ZOOM, c, nBpp[chip], color, sx >> 12, sy >> 12, fx, fy, zw, zh, pri, 0);
 				}
 			}
 		}
 	}
+
+	konami_sprite_list_render();
 }
 
 void K053245Scan(INT32 nAction)
@@ -246,6 +246,7 @@ void K053247SpritesRender()
 	static const INT32 yoffset[8] = { 0, 2, 8, 10, 32, 34, 40, 42 };
 
 	INT32 sortedlist[NUM_SPRITES];
+	UINT8 sortkey[NUM_SPRITES];
 	INT32 offs,zcode;
 	INT32 ox,oy,color,code,size,w,h,x,y,xa,ya,flipx,flipy,mirrorx,mirrory,shadow,zoomx,zoomy,primask;
 	INT32 nozoom,count,temp,shdmask;
@@ -278,12 +279,12 @@ void K053247SpritesRender()
 	if (zcode == -1)
 	{
 		for (; offs<0x800; offs+=8)
-			if (BURN_ENDIAN_SWAP_INT16(SprRam[offs]) & 0x8000) sortedlist[count++] = offs;
+			if (BURN_ENDIAN_SWAP_INT16(SprRam[offs]) & 0x8000) { sortkey[count] = BURN_ENDIAN_SWAP_INT16(SprRam[offs]) & 0xff; sortedlist[count++] = offs; }
 	}
 	else
 	{
 		for (; offs<0x800; offs+=8)
-			if ((BURN_ENDIAN_SWAP_INT16(SprRam[offs]) & 0x8000) && ((BURN_ENDIAN_SWAP_INT16(SprRam[offs]) & 0xff) != zcode)) sortedlist[count++] = offs;
+			if ((BURN_ENDIAN_SWAP_INT16(SprRam[offs]) & 0x8000) && ((BURN_ENDIAN_SWAP_INT16(SprRam[offs]) & 0xff) != zcode)) { sortkey[count] = BURN_ENDIAN_SWAP_INT16(SprRam[offs]) & 0xff; sortedlist[count++] = offs; }
 	}
 
 	w = count;
@@ -297,12 +298,11 @@ void K053247SpritesRender()
 		for (y=0; y<h; y++)
 		{
 			offs = sortedlist[y];
-			zcode = BURN_ENDIAN_SWAP_INT16(SprRam[offs]) & 0xff;
+			zcode = sortkey[y];
 			for (x=y+1; x<w; x++)
 			{
-				temp = sortedlist[x];
-				code = BURN_ENDIAN_SWAP_INT16(SprRam[temp]) & 0xff;
-				if (zcode <= code) { zcode = code; sortedlist[x] = offs; sortedlist[y] = offs = temp; }
+				code = sortkey[x];
+				if (zcode <= code) { temp = sortedlist[x]; sortedlist[x] = offs; sortkey[x] = zcode; zcode = code; sortedlist[y] = offs = temp; sortkey[y] = code; }
 			}
 		}
 	}
@@ -312,12 +312,11 @@ void K053247SpritesRender()
 		for (y=0; y<h; y++)
 		{
 			offs = sortedlist[y];
-			zcode = BURN_ENDIAN_SWAP_INT16(SprRam[offs]) & 0xff;
+			zcode = sortkey[y];
 			for (x=y+1; x<w; x++)
 			{
-				temp = sortedlist[x];
-				code = BURN_ENDIAN_SWAP_INT16(SprRam[temp]) & 0xff;
-				if (zcode >= code) { zcode = code; sortedlist[x] = offs; sortedlist[y] = offs = temp; }
+				code = sortkey[x];
+				if (zcode >= code) { temp = sortedlist[x]; sortedlist[x] = offs; sortkey[x] = zcode; zcode = code; sortedlist[y] = offs = temp; sortkey[y] = code; }
 			}
 		}
 	}
@@ -517,32 +516,18 @@ void K053247SpritesRender()
 
 				c &= K053246MaskExp;
 
-				if (shadow || wtable == stable) {
-					if (mirrory && h == 1)
-						konami_render_zoom_shadow_sprite(gfxbase, c, nBpp, color, sx>>12, sy>>12, fx, !fy, 16, 16, zw, zh, primask, highlight);
-
-					konami_render_zoom_shadow_sprite(gfxbase, c, nBpp, color, sx>>12, sy>>12, fx, fy, 16, 16, zw, zh, primask, highlight);
-					continue;
-				}
+				INT32 type = (shadow || wtable == stable) ? KONAMI_SPRITE_SHADOW : (nozoom ? KONAMI_SPRITE_PRIO : KONAMI_SPRITE_ZOOM);
 
 				if (mirrory && h == 1)
-				{
-					if (nozoom) {
-						konami_draw_16x16_prio_sprite(gfxbase, c, nBpp, color, sx>>12, sy>>12, fx, !fy, primask);
-					} else {
-						konami_draw_16x16_priozoom_sprite(gfxbase, c, nBpp, color, 0, sx>>12, sy>>12, fx, !fy, 16, 16, zw, zh, primask);
-					}
-				}
+					konami_sprite_list_add(gfxbase, type, c, nBpp, color, sx>>12, sy>>12, fx, !fy, zw, zh, primask, highlight);
 
-				if (nozoom) {
-					konami_draw_16x16_prio_sprite(gfxbase, c, nBpp, color, sx>>12, sy>>12, fx, fy, primask);
-				} else {
-					konami_draw_16x16_priozoom_sprite(gfxbase, c, nBpp, color, 0, sx>>12, sy>>12, fx, fy, 16, 16, zw, zh, primask);
-				}
+				konami_sprite_list_add(gfxbase, type, c, nBpp, color, sx>>12, sy>>12, fx, fy, zw, zh, primask, highlight);
 			} // end of X loop
 		} // end of Y loop
 
 	} // end of sprite-list loop
+
+	konami_sprite_list_render();
 #undef NUM_SPRITES
 }
 
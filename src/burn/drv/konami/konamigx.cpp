@@ -405,6 +405,34 @@ static void konamigx_mixer_draw(INT32 sub1, INT32 sub1flags,INT32 sub2, INT32 su
 	}
 }
 
+static struct GX_OBJ *gx_sort_pool;
+
+static int gx_order_cmp(const void *a, const void *b)
+{
+	UINT32 oa = gx_sort_pool[*(const INT32*)a].order;
+	UINT32 ob = gx_sort_pool[*(const INT32*)b].order;
+
+	return (oa < ob) ? 1 : ((oa > ob) ? -1 : 0);
+}
+
+// the selection sort below is not stable, equal orders are left to it so they come out the same way
+static INT32 gx_sort_objects(struct GX_OBJ *objpool, INT32 *objbuf, INT32 nobj)
+{
+	gx_sort_pool = objpool;
+	qsort(objbuf, nobj, sizeof(INT32), gx_order_cmp);
+
+	for (INT32 i = 1; i < nobj; i++)
+	{
+		if (objpool[objbuf[i]].order == objpool[objbuf[i - 1]].order)
+		{
+			for (INT32 j = 0; j < nobj; j++) objbuf[j] = j;
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
 void konamigx_mixer(INT32 sub1 /*extra tilemap 1*/, INT32 sub1flags, INT32 sub2 /*extra tilemap 2*/, INT32 sub2flags, INT32 mixerflags, INT32 extra_bitmap /*extra tilemap 3*/, INT32 rushingheroes_hack)
 {
 	INT32 objbuf[GX_MAX_OBJECTS];
@@ -721,6 +749,8 @@ void konamigx_mixer(INT32 sub1 /*extra tilemap 1*/, INT32 sub1flags, INT32 sub2
 	k = nobj;
 	l = nobj - 1;
 
+	if (gx_sort_objects(objpool, objbuf, nobj)) l = 0;
+
 	for (INT32 j=0; j<l; j++)
 	{
 		INT32 temp1 = objbuf[j];
@@ -305,6 +305,23 @@ void KonamiBlendCopy(UINT32 *pPalette)
 	}
 }
 
+// sprite band clip, rows outside [miny, maxy) are left alone (see konami_sprite_list_render)
+static INT32 sprite_clip_miny = 0;
+static INT32 sprite_clip_maxy = 0x7fffffff;
+
+// clip a zoomed sprite's destination rectangle to the screen and the band, stepping
+// the source indexes by the rows / columns skipped
+static inline void konami_sprite_clip(INT32 &x0, INT32 &y0, INT32 &ex, INT32 &ey, INT32 &x_index, INT32 &y_index, INT32 dx, INT32 dy)
+{
+	INT32 miny = (sprite_clip_miny > 0) ? sprite_clip_miny : 0;
+	INT32 maxy = (sprite_clip_maxy < nScreenHeight) ? sprite_clip_maxy : nScreenHeight;
+
+	if (y0 < miny) { y_index += (miny - y0) * dy; y0 = miny; }
+	if (ey > maxy) ey = maxy;
+	if (x0 < 0) { x_index += -x0 * dx; x0 = 0; }
+	if (ex > nScreenWidth) ex = nScreenWidth;
+}
+
 void konami_draw_16x16_priozoom_sprite(UINT8 *gfx, INT32 code, INT32 bpp, INT32 color, INT32 t, INT32 sx, INT32 sy, INT32 fx, INT32 fy, INT32 width, INT32 height, INT32 zoomx, INT32 zoomy, UINT32 priority)
 {
 	// Based on MAME sources for tile zooming
@@ -335,28 +352,26 @@ void konami_draw_16x16_priozoom_sprite(UINT8 *gfx, INT32 code, INT32 bpp, INT32
 			dy = -dy;
 		}
 
-		for (INT32 y = sy; y < ey; y++)
+		INT32 y = sy, x0 = sx;
+		konami_sprite_clip(x0, y, ex, ey, x_index_base, y_index, dx, dy);
+
+		for (; y < ey; y++)
 		{
-			if (y >= 0 && y < nScreenHeight)
-			{
-				UINT8 *src = gfx_base + (y_index / 0x10000) * width;
-				UINT32 *dst = konami_bitmap32 + y * nScreenWidth;
-				UINT8 *prio = konami_priority_bitmap + y * nScreenWidth;
+			UINT8 *src = gfx_base + (y_index / 0x10000) * width;
+			UINT32 *dst = konami_bitmap32 + y * nScreenWidth;
+			UINT8 *prio = konami_priority_bitmap + y * nScreenWidth;
 
-				for (INT32 x = sx, x_index = x_index_base; x < ex; x++)
-				{
-					if (x >= 0 && x < nScreenWidth) {
-						INT32 pxl = src[x_index>>16];
+			for (INT32 x = x0, x_index = x_index_base; x < ex; x++)
+			{
+				INT32 pxl = src[x_index>>16];
 
-						if (pxl != t) {
-							if ((priority & (1 << (prio[x]&0x1f)))==0) {
-								dst[x] = pal[pxl];
-							}
-							prio[x] |= 0x1f;
-						}
+				if (pxl != t) {
+					if ((priority & (1 << (prio[x]&0x1f)))==0) {
+						dst[x] = pal[pxl];
 					}
-					x_index += dx;
+					prio[x] |= 0x1f;
 				}
+				x_index += dx;
 			}
 
 			y_index += dy;
@@ -417,6 +432,96 @@ void konami_draw_16x16_zoom_tile(UINT8 *gfxbase, INT32 code, INT32 bpp, INT32 co
 	}
 }
 
+// K053245 / K053247 sprite list
+// The chips' renderers decode sprite ram into a list of 16x16 cells (in draw order,
+// with the covered rows worked out), cells that land off-screen are dropped. The
+// list is then drawn one band of lines at a time, so the destination and priority
+// lines being worked on stay in cache however many sprites overlap them.
+
+#define SPRITE_LIST_MAX		4096
+#define SPRITE_LIST_BAND	16
+
+struct konami_sprite_cell {
+	UINT8 *gfx;
+	INT32 type;
+	INT32 code, bpp, color;
+	INT32 sx, sy, fx, fy;
+	INT32 zw, zh;		// 20.12, unused by KONAMI_SPRITE_PRIO
+	UINT32 priority;
+	INT32 highlight;
+	INT32 miny, maxy;	// rows covered, clipped to the screen
+};
+
+static konami_sprite_cell sprite_list[SPRITE_LIST_MAX];
+static INT32 sprite_list_count = 0;
+
+void konami_sprite_list_add(UINT8 *gfx, INT32 type, INT32 code, INT32 bpp, INT32 color, INT32 sx, INT32 sy, INT32 fx, INT32 fy, INT32 zw, INT32 zh, UINT32 priority, INT32 highlight)
+{
+	INT32 w = 16, h = 16;
+
+	if (type != KONAMI_SPRITE_PRIO) {
+		w = (zw * 16 + 0x8000) / 0x10000;
+		h = (zh * 16 + 0x8000) / 0x10000;
+		if (w == 0 || h == 0) return;
+	}
+
+	if (sx >= nScreenWidth || sx + w <= 0 || sy >= nScreenHeight || sy + h <= 0) return;
+
+	if (sprite_list_count == SPRITE_LIST_MAX) konami_sprite_list_render();
+
+	konami_sprite_cell *p = &sprite_list[sprite_list_count++];
+	p->gfx = gfx;
+	p->type = type;
+	p->code = code;
+	p->bpp = bpp;
+	p->color = color;
+	p->sx = sx;
+	p->sy = sy;
+	p->fx = fx;
+	p->fy = fy;
+	p->zw = zw;
+	p->zh = zh;
+	p->priority = priority;
+	p->highlight = highlight;
+	p->miny = (sy > 0) ? sy : 0;
+	p->maxy = (sy + h < nScreenHeight) ? (sy + h) : nScreenHeight;
+}
+
+void konami_sprite_list_render()
+{
+	for (INT32 band = 0; band < nScreenHeight && sprite_list_count; band += SPRITE_LIST_BAND)
+	{
+		sprite_clip_miny = band;
+		sprite_clip_maxy = band + SPRITE_LIST_BAND;
+
+		for (INT32 i = 0; i < sprite_list_count; i++)
+		{
+			konami_sprite_cell *p = &sprite_list[i];
+
+			if (p->maxy <= sprite_clip_miny || p->miny >= sprite_clip_maxy) continue;
+
+			switch (p->type)
+			{
+				case KONAMI_SPRITE_PRIO:
+					konami_draw_16x16_prio_sprite(p->gfx, p->code, p->bpp, p->color, p->sx, p->sy, p->fx, p->fy, p->priority);
+				break;
+
+				case KONAMI_SPRITE_ZOOM:
+					konami_draw_16x16_priozoom_sprite(p->gfx, p->code, p->bpp, p->color, 0, p->sx, p->sy, p->fx, p->fy, 16, 16, p->zw, p->zh, p->priority);
+				break;
+
+				case KONAMI_SPRITE_SHADOW:
+					konami_render_zoom_shadow_sprite(p->gfx, p->code, p->bpp, p->color, p->sx, p->sy, p->fx, p->fy, 16, 16, p->zw, p->zh, p->priority, p->highlight);
+				break;
+			}
+		}
+	}
+
+	sprite_clip_miny = 0;
+	sprite_clip_maxy = 0x7fffffff;
+	sprite_list_count = 0;
+}
+
 void konami_set_highlight_mode(INT32 mode)
 {
 	highlight_mode = mode;
@@ -477,38 +582,33 @@ void konami_draw_16x16_prio_sprite(UINT8 *gfxbase, INT32 code, INT32 bpp, INT32
 
 	UINT8 *gfx = gfxbase + code * 0x100;
 
-	UINT8 *pri = konami_priority_bitmap + (sy * nScreenWidth) + sx;
-	UINT32 *dst = konami_bitmap32 + (sy * nScreenWidth) + sx;
 	UINT32 *pal = konami_palette32 + (color << bpp);
 
 	priority |= 1 << 31; // always on!
 
-	for (INT32 y = 0; y < 16; y++, sy++)
+	INT32 x0 = sx, y0 = sy, ex = sx + 16, ey = sy + 16, xs = 0, ys = 0;
+	konami_sprite_clip(x0, y0, ex, ey, xs, ys, 1, 1);
+
+	for (INT32 y = ys; y0 < ey; y++, y0++)
 	{
-		if (sy >= 0 && sy < nScreenHeight)
+		UINT8 *pri = konami_priority_bitmap + (y0 * nScreenWidth) + sx;
+		UINT32 *dst = konami_bitmap32 + (y0 * nScreenWidth) + sx;
+
+		for (INT32 x = xs; sx + x < ex; x++)
 		{
-			for (INT32 x = 0; x < 16; x++)
-			{
-				if ((sx+x) >= 0 && (sx+x) < nScreenWidth)
-				{
-					INT32 pxl = gfx[((y*16)+x)^flip];
+			INT32 pxl = gfx[((y*16)+x)^flip];
 
-					if (pxl) {
-						if ((priority & (1 << (pri[x]&0x1f)))==0) {
-							if (pri[x] & 0x20) {
-								dst[x] = highlight_mode ? highlight_blend(pal[pxl]) : shadow_blend(pal[pxl]);
-							} else {
-								dst[x] = pal[pxl];
-							}
-						}
-						pri[x] |= 0x1f;
+			if (pxl) {
+				if ((priority & (1 << (pri[x]&0x1f)))==0) {
+					if (pri[x] & 0x20) {
+						dst[x] = highlight_mode ? highlight_blend(pal[pxl]) : shadow_blend(pal[pxl]);
+					} else {
+						dst[x] = pal[pxl];
 					}
 				}
+				pri[x] |= 0x1f;
 			}
 		}
-
-		pri += nScreenWidth;
-		dst += nScreenWidth;
 	}
 }
 
@@ -576,36 +676,34 @@ void konami_render_zoom_shadow_sprite(UINT8 *gfxbase, INT32 code, INT32 bpp, INT
 
 		if (priority == 0xffffffff)
 		{
-			for (INT32 y = sy; y < ey; y++)
+			INT32 y = sy, x0 = sx;
+			konami_sprite_clip(x0, y, ex, ey, x_index_base, y_index, dx, dy);
+
+			for (; y < ey; y++)
 			{
-				if (y >= 0 && y < nScreenHeight)
-				{
-					UINT8 *src = gfx_base + (y_index / 0x10000) * width;
-					UINT32 *dst = konami_bitmap32 + y * nScreenWidth;
-					UINT8 *pri = konami_priority_bitmap + y * nScreenWidth;
+				UINT8 *src = gfx_base + (y_index / 0x10000) * width;
+				UINT32 *dst = konami_bitmap32 + y * nScreenWidth;
+				UINT8 *pri = konami_priority_bitmap + y * nScreenWidth;
 
-					for (INT32 x = sx, x_index = x_index_base; x < ex; x++)
-					{
-						if (x >= 0 && x < nScreenWidth) {
-							INT32 pxl = src[x_index>>16];
+				for (INT32 x = x0, x_index = x_index_base; x < ex; x++)
+				{
+					INT32 pxl = src[x_index>>16];
 
-							if (pxl) {
-								if (pxl == shadow_color) {
-									dst[x] = highlight_mode ? highlight_blend(dst[x]) : shadow_blend(dst[x]);
-									if (highlight_over_sprites_mode)
-										pri[x] |= 0x20;
-								} else {
-									if (pri[x] & 0x20) {
-										dst[x] = highlight_mode ? highlight_blend(pal[pxl]) : shadow_blend(pal[pxl]);
-									} else {
-										dst[x] = pal[pxl];
-									}
-								}
+					if (pxl) {
+						if (pxl == shadow_color) {
+							dst[x] = highlight_mode ? highlight_blend(dst[x]) : shadow_blend(dst[x]);
+							if (highlight_over_sprites_mode)
+								pri[x] |= 0x20;
+						} else {
+							if (pri[x] & 0x20) {
+								dst[x] = highlight_mode ? highlight_blend(pal[pxl]) : shadow_blend(pal[pxl]);
+							} else {
+								dst[x] = pal[pxl];
 							}
 						}
-
-						x_index += dx;
 					}
+
+					x_index += dx;
 				}
 
 				y_index += dy;
@@ -613,51 +711,49 @@ void konami_render_zoom_shadow_sprite(UINT8 *gfxbase, INT32 code, INT32 bpp, INT
 		} else {
 			priority |= 1<<31; // always on!
 
-			for (INT32 y = sy; y < ey; y++)
+			INT32 y = sy, x0 = sx;
+			konami_sprite_clip(x0, y, ex, ey, x_index_base, y_index, dx, dy);
+
+			for (; y < ey; y++)
 			{
-				if (y >= 0 && y < nScreenHeight)
+				UINT8 *src = gfx_base + (y_index / 0x10000) * width;
+				UINT32 *dst = konami_bitmap32 + y * nScreenWidth;
+				UINT8 *pri = konami_priority_bitmap + y * nScreenWidth;
+
+				for (INT32 x = x0, x_index = x_index_base; x < ex; x++)
 				{
-					UINT8 *src = gfx_base + (y_index / 0x10000) * width;
-					UINT32 *dst = konami_bitmap32 + y * nScreenWidth;
-					UINT8 *pri = konami_priority_bitmap + y * nScreenWidth;
-
-					for (INT32 x = sx, x_index = x_index_base; x < ex; x++)
-					{
-						if (x >= 0 && x < nScreenWidth) {
-							INT32 pxl = src[x_index>>16];
-
-							if (pxl) {
-								if (pxl == shadow_color) {
-									if (konamiic_shadow_inhibit_layer) {
-										if ((priority & (1 << (pri[x]&0x1f)))==0 && (pri[x] & 0x80) == 0 && (~pri[x] & konamiic_shadow_inhibit_layer)) {
-											dst[x] = highlight_mode ? highlight_blend(dst[x]) : shadow_blend(dst[x]);
-											pri[x] |= 0x80; // 0x80 - shadow/hilight "drawn here".  Nov.16, 2018, changed to |= to fix player shadow issue @ end of level in The Simpsons
-											if (highlight_over_sprites_mode)
-												pri[x] |= 0x20;
-										}
-									} else {
-										if ((priority & (1 << (pri[x]&0x1f)))==0 && (pri[x] & 0x80) == 0) {
-											dst[x] = highlight_mode ? highlight_blend(dst[x]) : shadow_blend(dst[x]);
-											pri[x] |= 0x80; // 0x80 - shadow/hilight "drawn here".  Nov.16, 2018, changed to |= to fix player shadow issue @ end of level in The Simpsons
-											if (highlight_over_sprites_mode)
-												pri[x] |= 0x20;
-										}
-									}
+					INT32 pxl = src[x_index>>16];
+
+					if (pxl) {
+						if (pxl == shadow_color) {
+							if (konamiic_shadow_inhibit_layer) {
+								if ((priority & (1 << (pri[x]&0x1f)))==0 && (pri[x] & 0x80) == 0 && (~pri[x] & konamiic_shadow_inhibit_layer)) {
+									dst[x] = highlight_mode ? highlight_blend(dst[x]) : shadow_blend(dst[x]);
+									pri[x] |= 0x80; // 0x80 - shadow/hilight "drawn here".  Nov.16, 2018, changed to |= to fix player shadow issue @ end of level in The Simpsons
+									if (highlight_over_sprites_mode)
+										pri[x] |= 0x20;
+								}
+							} else {
+								if ((priority & (1 << (pri[x]&0x1f)))==0 && (pri[x] & 0x80) == 0) {
+									dst[x] = highlight_mode ? highlight_blend(dst[x]) : shadow_blend(dst[x]);
+									pri[x] |= 0x80; // 0x80 - shadow/hilight "drawn here".  Nov.16, 2018, changed to |= to fix player shadow issue @ end of level in The Simpsons
+									if (highlight_over_sprites_mode)
+										pri[x] |= 0x20;
+								}
+							}
+						} else {
+							if ((priority & (1 << (pri[x]&0x1f)))==0) {
+								if (pri[x] & 0x20) {
+									dst[x] = highlight_mode ? highlight_blend(pal[pxl]) : shadow_blend(pal[pxl]);
 								} else {
-									if ((priority & (1 << (pri[x]&0x1f)))==0) {
-										if (pri[x] & 0x20) {
-											dst[x] = highlight_mode ? highlight_blend(pal[pxl]) : shadow_blend(pal[pxl]);
-										} else {
-											dst[x] = pal[pxl];
-										}
-									}
-									pri[x] = (pri[x]&0x80)|0x1f;
+									dst[x] = pal[pxl];
 								}
 							}
+							pri[x] = (pri[x]&0x80)|0x1f;
 						}
-
-						x_index += dx;
 					}
+
+					x_index += dx;
 				}
 
 				y_index += dy;
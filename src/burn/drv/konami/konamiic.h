@@ -44,6 +44,13 @@ void konami_draw_16x16_zoom_tile(UINT8 *gfx, INT32 code, INT32 bpp, INT32 color,
 void konami_draw_16x16_priozoom_sprite(UINT8 *gfx, INT32 code, INT32 bpp, INT32 color, INT32 t, INT32 sx, INT32 sy, INT32 fx, INT32 fy, INT32 width, INT32 height, INT32 zoomx, INT32 zoomy, UINT32 priority);
 void konami_render_zoom_shadow_sprite(UINT8 *gfx, INT32 code, INT32 bpp, INT32 color, INT32 sx, INT32 sy, INT32 fx, INT32 fy, INT32 width, INT32 height, INT32 zoomx, INT32 zoomy, UINT32 priority, INT32 shadow);
 
+// K053245 / K053247 sprite list, cells are queued in draw order then rendered in bands
+#define KONAMI_SPRITE_PRIO		0	// konami_draw_16x16_prio_sprite
+#define KONAMI_SPRITE_ZOOM		1	// konami_draw_16x16_priozoom_sprite
+#define KONAMI_SPRITE_SHADOW	2	// konami_render_zoom_shadow_sprite
+void konami_sprite_list_add(UINT8 *gfx, INT32 type, INT32 code, INT32 bpp, INT32 color, INT32 sx, INT32 sy, INT32 fx, INT32 fy, INT32 zw, INT32 zh, UINT32 priority, INT32 highlight);
+void konami_sprite_list_render();
+
 // game-specific modes
 void konami_set_highlight_mode(INT32 mode);
 void konami_set_highlight_over_sprites_mode(INT32 mode);
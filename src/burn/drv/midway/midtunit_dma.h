@@ -90,6 +90,119 @@ typedef void (*dma_draw_func)(void);
 #define EXTRACTGEN(m)   (((base[o >> 3] | (base[(o >> 3) + 1] << 8)) >> (o & 7)) & (m))
 #endif
 
+/*** unscaled span: source bytes are shifted into a bit buffer and decoded   ***/
+/*** a pixel at a time, zero spans are stepped over a byte at a time when    ***/
+/*** zero pixels are transparent. x never wraps within a span.               ***/
+static inline void dma_draw_span(UINT16 *d, INT32 x, UINT32 o, INT32 count, INT32 bpp, INT32 xflip, INT32 zero, INT32 nonzero, UINT16 pal, UINT16 color)
+{
+    INT32 dx = xflip ? -1 : 1;
+
+    if (zero == PIXEL_COLOR && nonzero == PIXEL_COLOR)
+    {
+        UINT16 fill = BURN_ENDIAN_SWAP_INT16(color);
+
+        for (; count > 0; count--, x += dx)
+            d[x] = fill;
+        return;
+    }
+
+    const UINT8 *src = dma_gfxrom + (o >> 3);
+    UINT32 mask = (1 << bpp) - 1;
+    UINT32 bits = *src++ >> (o & 7);
+    INT32 avail = 8 - (o & 7);
+
+    while (count > 0)
+    {
+        /* run of transparent zero pixels */
+        if (zero == PIXEL_SKIP && bits == 0)
+        {
+            INT32 need = count * bpp;
+            INT32 run;
+
+            while (avail < need && *src == 0)
+            {
+                src++;
+                avail += 8;
+            }
+
+            run = avail / bpp;
+            if (run > count)
+                run = count;
+            if (run)
+            {
+                avail -= run * bpp;
+                count -= run;
+                x += run * dx;
+                continue;
+            }
+        }
+
+        if (avail < bpp)
+        {
+            bits |= *src++ << avail;
+            avail += 8;
+        }
+
+        UINT32 pixel = bits & mask;
+        bits >>= bpp;
+        avail -= bpp;
+
+        if (pixel)
+        {
+            if (nonzero == PIXEL_COLOR)
+                d[x] = BURN_ENDIAN_SWAP_INT16(color);
+            else if (nonzero == PIXEL_COPY)
+                d[x] = BURN_ENDIAN_SWAP_INT16(pixel | pal);
+        }
+        else
+        {
+            if (zero == PIXEL_COLOR)
+                d[x] = BURN_ENDIAN_SWAP_INT16(color);
+            else if (zero == PIXEL_COPY)
+                d[x] = BURN_ENDIAN_SWAP_INT16(pal);
+        }
+
+        x += dx;
+        count--;
+    }
+}
+
+/*** unscaled row: split at the x wrap, clip each piece against the   ***/
+/*** left/right pseudo-registers and hand the visible part to the span ***/
+static inline void dma_draw_row_noscale(UINT16 *d, INT32 sx, UINT32 o, INT32 count, INT32 bpp, INT32 xflip, INT32 zero, INT32 nonzero, UINT16 pal, UINT16 color)
+{
+    while (count > 0)
+    {
+        INT32 seg = xflip ? (sx + 1) : (XPOSMASK + 1 - sx);
+        INT32 first, last;
+
+        if (seg > count)
+            seg = count;
+
+        if (xflip)
+        {
+            first = sx - dma_state->rightclip;
+            last = sx - dma_state->leftclip;
+        }
+        else
+        {
+            first = dma_state->leftclip - sx;
+            last = dma_state->rightclip - sx;
+        }
+        if (first < 0)
+            first = 0;
+        if (last > seg - 1)
+            last = seg - 1;
+
+        if (first <= last)
+            dma_draw_span(d, xflip ? (sx - first) : (sx + first), o + first * bpp, last - first + 1, bpp, xflip, zero, nonzero, pal, color);
+
+        o += seg * bpp;
+        count -= seg;
+        sx = (xflip ? (sx - seg) : (sx + seg)) & XPOSMASK;
+    }
+}
+
 /*** core blitter routine macro ***/
 #define DMA_DRAW_FUNC_BODY(name, bitsperpixel, extractor, xflip, skip, scale, zero, nonzero)    \
 {                                                             \
@@ -154,6 +267,14 @@ typedef void (*dma_draw_func)(void);
         /* determine destination pointer */                   \
         d = &DrvVRAM16[sy * 512];                             \
                                                               \
+        /* unscaled rows are drawn as whole spans */          \
+        if (!scale)                                           \
+        {                                                     \
+            if (ix < width)                                   \
+                dma_draw_row_noscale(d, sx, o, (width - ix) >> 8, bpp, xflip, zero, nonzero, pal, color); \
+            goto clipy;                                       \
+        }                                                     \
+                                                              \
         /* loop until we draw the entire width */             \
         while (ix < width)                                    \
         {                                                     \
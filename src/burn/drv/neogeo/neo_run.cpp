@@ -1464,6 +1464,10 @@ INT32 NeoScan(INT32 nAction, INT32* pnMin)
 		ba.szName	= "Graphics RAM";
 		BurnAcb(&ba);
 
+		if (nAction & ACB_WRITE) {
+			NeoSpriteListInvalidate();
+		}
+
 		if (nNeoSystemType & NEO_SYS_CD) {
 			ba.Data		= NeoSpriteRAM;
 			ba.nLen		= nSpriteSize[0];
@@ -2309,6 +2313,11 @@ static void __fastcall neogeoWriteWordVideo(UINT32 sekAddress, UINT16 wordValue)
 			break;
 		}
 		case 0x02: {
+			// sprite control blocks (SCB2-4) feed the sprite lists
+			if (NeoGraphicsRAMBank != NeoGraphicsRAM && NeoGraphicsRAMPointer < 0x0C00 && *((UINT16*)(NeoGraphicsRAMBank + NeoGraphicsRAMPointer)) != wordValue) {
+				NeoSpriteListInvalidate();
+			}
+
 			*((UINT16*)(NeoGraphicsRAMBank + NeoGraphicsRAMPointer)) = wordValue;
 			NeoGraphicsRAMPointer += nNeoGraphicsModulo;
 
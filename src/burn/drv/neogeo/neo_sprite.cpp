@@ -86,6 +86,162 @@ void NeoSpriteCalcLimit()
 
 static UINT8 nSpriteDisableLut[0x200];
 
+// Sprite lists, used when a frame is drawn in several slices (raster effects).
+// The chain state (position, size, zoom) of every bank is resolved once, and each bank
+// that can be drawn is entered in the mask of every scanline it can cover, so a slice
+// only visits the banks present on its lines. The lists are rebuilt when the sprite
+// control blocks (SCB2-4) change or when the state they were built from changes.
+
+#define SPRITE_LIST_LINES	0x100
+#define SPRITE_LIST_WORDS	((MAX_SPRITEBANK + 31) >> 5)
+
+struct NeoSpriteState {
+	UINT16* pBank;
+	INT32 nXPos, nYPos;
+	INT32 nXZoom, nYZoom;
+	INT32 nSize;
+	INT32 nRender;			// 0 = not drawn, 1 = RenderBank[nXZoom], 2 = RenderBank[nXZoom + 16] (clipped)
+};
+
+static NeoSpriteState SpriteList[MAX_SPRITEBANK];
+static NeoSpriteState SpriteListEnd;		// chain state left behind after the last bank
+static UINT32 nSpriteLineMask[SPRITE_LIST_LINES][SPRITE_LIST_WORDS];
+
+static bool bSpriteListDirty = true;
+static INT32 nSpriteListKey[8];
+
+void NeoSpriteListInvalidate()
+{
+	bSpriteListDirty = true;
+}
+
+static inline void NeoSpriteStateSave(NeoSpriteState* pState)
+{
+	pState->pBank  = pBank;
+	pState->nXPos  = nBankXPos;
+	pState->nYPos  = nBankYPos;
+	pState->nXZoom = nBankXZoom;
+	pState->nYZoom = nBankYZoom;
+	pState->nSize  = nBankSize;
+}
+
+static inline void NeoSpriteStateLoad(NeoSpriteState* pState)
+{
+	pBank      = pState->pBank;
+	nBankXPos  = pState->nXPos;
+	nBankYPos  = pState->nYPos;
+	nBankXZoom = pState->nXZoom;
+	nBankYZoom = pState->nYZoom;
+	nBankSize  = pState->nSize;
+}
+
+static void NeoSpriteListMarkLines(INT32 nBank)
+{
+	INT32 nFirst = nBankYPos;
+	INT32 nLast  = nBankYPos + ((nBankSize >= 0x20) ? 0x01FF : ((nBankSize << 4) - 1));
+	UINT32 nBit  = 1 << (nBank & 31);
+
+	nBank >>= 5;
+
+	// the strip covers lines nFirst - nLast modulo 0x200, visit both windows of the wrap
+	for (INT32 nWrap = 0; nWrap <= 0x200; nWrap += 0x200) {
+		INT32 nStartLine = (nFirst > nWrap) ? nFirst : nWrap;
+		INT32 nEndLine   = (nLast < nWrap + SPRITE_LIST_LINES - 1) ? nLast : (nWrap + SPRITE_LIST_LINES - 1);
+
+		for (INT32 nLine = nStartLine; nLine <= nEndLine; nLine++) {
+			nSpriteLineMask[nLine - nWrap][nBank] |= nBit;
+		}
+	}
+}
+
+// Same chain walk as the full path in NeoRenderSprites(), without drawing
+static void NeoSpriteListBuild(INT32 nStart)
+{
+	memset(nSpriteLineMask, 0, sizeof(nSpriteLineMask));
+
+	for (INT32 nBank = 0; nBank < nMaxSpriteBank; nBank++) {
+		INT32 zBank = (nBank + nStart) % MAX_SPRITEBANK;
+		BankAttrib01 = *((UINT16*)(NeoGraphicsRAM + 0x010000 + (zBank << 1)));
+		BankAttrib02 = *((UINT16*)(NeoGraphicsRAM + 0x010400 + (zBank << 1)));
+		BankAttrib03 = *((UINT16*)(NeoGraphicsRAM + 0x010800 + (zBank << 1)));
+
+		pBank = (UINT16*)(NeoGraphicsRAM + (zBank << 7));
+
+		if (BankAttrib02 & 0x40) {
+			nBankXPos += nBankXZoom + 1;
+		} else {
+			nBankYPos = (0x0200 - (BankAttrib02 >> 7)) & 0x01FF;
+			nBankXPos = (BankAttrib03 >> 7);
+			if (nNeoScreenWidth == 304) {
+				nBankXPos -= 8;
+			}
+
+			nBankYZoom = BankAttrib01 & 0xFF;
+			nBankSize  = BankAttrib02 & 0x3F;
+		}
+
+		SpriteList[nBank].nRender = 0;
+
+		if (nBankSize) {
+			nBankXZoom = (BankAttrib01 >> 8) & 0x0F;
+			if (nBankXPos >= 0x01E0) {
+				nBankXPos -= 0x200;
+			}
+
+			if (nBankXPos >= 0 && nBankXPos < (nNeoScreenWidth - nBankXZoom - 1)) {
+				SpriteList[nBank].nRender = 1;
+			} else {
+				if (nBankXPos >= -nBankXZoom && nBankXPos < nNeoScreenWidth) {
+					SpriteList[nBank].nRender = 2;
+				}
+			}
+		}
+
+		if (SpriteList[nBank].nRender) {
+			NeoSpriteStateSave(&SpriteList[nBank]);
+			NeoSpriteListMarkLines(nBank);
+		}
+	}
+
+	NeoSpriteStateSave(&SpriteListEnd);
+}
+
+static void NeoRenderSpriteList(INT32 nStart)
+{
+	// everything the chain walk depends on, other than the SCBs themselves
+	INT32 nKey[8] = { nStart, nMaxSpriteBank, nNeoScreenWidth, nBankXPos, nBankYPos, nBankXZoom, nBankYZoom, nBankSize };
+
+	if (bSpriteListDirty || memcmp(nKey, nSpriteListKey, sizeof(nKey))) {
+		bSpriteListDirty = false;
+		memcpy(nSpriteListKey, nKey, sizeof(nKey));
+
+		NeoSpriteListBuild(nStart);
+	}
+
+	UINT32 nMask[SPRITE_LIST_WORDS];
+	memset(nMask, 0, sizeof(nMask));
+
+	for (INT32 nLine = nSliceStart; nLine < nSliceEnd; nLine++) {
+		for (INT32 i = 0; i < SPRITE_LIST_WORDS; i++) {
+			nMask[i] |= nSpriteLineMask[nLine][i];
+		}
+	}
+
+	for (INT32 i = 0; i < SPRITE_LIST_WORDS; i++) {
+		INT32 nBank = i << 5;
+
+		for (UINT32 nBits = nMask[i]; nBits; nBits >>= 1, nBank++) {
+			if (nBits & 1) {
+				NeoSpriteStateLoad(&SpriteList[nBank]);
+
+				RenderBank[nBankXZoom + ((SpriteList[nBank].nRender == 2) ? 16 : 0)]();
+			}
+		}
+	}
+
+	NeoSpriteStateLoad(&SpriteListEnd);
+}
+
 INT32 NeoRenderSprites()
 {
 	if (nLastBPP != nBurnBpp ) {
@@ -117,6 +273,11 @@ INT32 NeoRenderSprites()
 		}
 	}
 
+	if ((nSpriteEnable == 0xff) && (nBurnLayer & 0x04) && nSliceStart >= 0 && nSliceEnd <= SPRITE_LIST_LINES) {
+		NeoRenderSpriteList(nStart);
+		return 0;
+	}
+
 	if ((nSpriteEnable != 0xff) || (nBurnLayer & 0x04) == 0)
 	{
 		memset (nSpriteDisableLut, 0xff, sizeof(nSpriteDisableLut));
@@ -336,6 +497,8 @@ INT32 NeoInitSprites(INT32 nSlot)
 
 	nNeoEnforceSpriteLimit[nSlot] = 0; // off by default
 
+	NeoSpriteListInvalidate();
+
 	if (!strcmp(BurnDrvGetTextA(DRV_NAME), "bstars") || !strcmp(BurnDrvGetTextA(DRV_NAME), "bstarsh")) {
 		nNeoEnforceSpriteLimit[nSlot] = 1; // bstars needs this for proper homerun cutscene
 	}
@@ -161,6 +161,7 @@ INT32 NeoInitSprites(INT32 nSlot);
 void NeoExitSprites(INT32 nSlot);
 INT32 NeoRenderSprites();
 void NeoSpriteCalcLimit();
+void NeoSpriteListInvalidate();
 
 // neo_decrypt.cpp
 extern INT32 nNeoProtectionXor;
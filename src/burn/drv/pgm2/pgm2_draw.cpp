@@ -36,13 +36,23 @@ static UINT32 nSprColLen;      // total colour data bytes
 static UINT32 nBgRomLen;       // BG tile ROM length
 
 // ---------------------------------------------------------------------------
-// Pixel output helper (writes directly to pBurnDraw)
+// Compositing: BG / FG are rendered one line at a time into palette index
+// buffers (0 = transparent) and merged with the sprite buffer in one pass.
+// Palettes are converted with BurnHighCol() only when an entry changes.
 // ---------------------------------------------------------------------------
-static inline void pgm2PutPix(INT32 x, INT32 y, UINT32 col)
-{
-	if ((UINT32)x < (UINT32)nScreenWidth && (UINT32)y < (UINT32)nScreenHeight)
-		PutPix(pBurnDraw + y * nBurnPitch + x * nBurnBpp, col);
-}
+#define PGM2_SPPAL_N    0x1000
+#define PGM2_BGPAL_N    0x800
+#define PGM2_TXPAL_N    0x200
+
+static UINT16 BgLine[PGM2_SPRBUF_W];
+static UINT16 FgLine[PGM2_SPRBUF_W];
+static UINT32 CompLine[PGM2_SPRBUF_W];
+
+static UINT32 SpPalRaw[PGM2_SPPAL_N], SpPalCol[PGM2_SPPAL_N];
+static UINT32 BgPalRaw[PGM2_BGPAL_N], BgPalCol[PGM2_BGPAL_N];
+static UINT32 TxPalRaw[PGM2_TXPAL_N], TxPalCol[PGM2_TXPAL_N];
+static INT32  nPalCacheBpp = -1;
+static UINT32 (__cdecl *pPalCacheHighCol)(INT32, INT32, INT32, INT32) = NULL;
 
 // ---------------------------------------------------------------------------
 // Init / Exit
@@ -68,6 +78,8 @@ void pgm2InitDraw()
 	SnapBgScroll = 0;
 	SnapFgScroll = 0;
 	SnapVidMode  = 0;
+
+	nPalCacheBpp = -1;
 }
 
 void pgm2ExitDraw()
@@ -109,6 +121,30 @@ static inline INT32 popcount32(UINT32 x)
 	return (((x + (x >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24;
 }
 
+static inline INT32 clz32(UINT32 x) // x != 0
+{
+#if defined(__GNUC__)
+	return __builtin_clz(x);
+#else
+	INT32 n = 0;
+	if (!(x & 0xFFFF0000)) { n += 16; x <<= 16; }
+	if (!(x & 0xFF000000)) { n +=  8; x <<=  8; }
+	if (!(x & 0xF0000000)) { n +=  4; x <<=  4; }
+	if (!(x & 0xC0000000)) { n +=  2; x <<=  2; }
+	if (!(x & 0x80000000)) { n +=  1; }
+	return n;
+#endif
+}
+
+static inline UINT32 bitrev32(UINT32 v)
+{
+	v = ((v >> 1) & 0x55555555) | ((v & 0x55555555) << 1);
+	v = ((v >> 2) & 0x33333333) | ((v & 0x33333333) << 2);
+	v = ((v >> 4) & 0x0F0F0F0F) | ((v & 0x0F0F0F0F) << 4);
+	v = ((v >> 8) & 0x00FF00FF) | ((v & 0x00FF00FF) << 8);
+	return (v >> 16) | (v << 16);
+}
+
 static inline void pgm2_draw_sprite_pixel(UINT32 colour_base, UINT32 colour_mask,
 	UINT32 palette_offset, INT32 realx, INT32 realy, UINT16 pal)
 {
@@ -173,6 +209,54 @@ static void pgm2_draw_sprite_chunk(UINT32 colour_base, UINT32 colour_mask,
 	}
 }
 
+// Unzoomed chunk: every mask bit is one pixel, so the set bits are expanded
+// into runs and each run is written to the sprite buffer in one go.
+static void pgm2_draw_sprite_span_chunk(UINT32 colour_base, UINT32 colour_mask,
+	UINT32 &palette_offset, INT32 x, UINT16 *row, UINT16 pal,
+	UINT32 maskdata, INT32 &realxdraw, INT32 realdraw_inc, INT32 palette_inc)
+{
+	// walk the bits in draw order, msb first
+	UINT32 m = (palette_inc == -1) ? bitrev32(maskdata) : maskdata;
+	INT32 pos = 0;
+
+	while (m)
+	{
+		INT32 skip = clz32(m);
+		m <<= skip;
+		pos += skip;
+
+		INT32 run = (~m) ? clz32(~m) : 32 - pos;
+		m = (run >= 32) ? 0 : (m << run);
+
+		// clip the run against the buffer
+		INT32 x0 = x + realxdraw + pos * realdraw_inc;
+		INT32 i0 = 0, i1 = run;
+		if (realdraw_inc > 0) {
+			if (x0 < 0) i0 = -x0;
+			if (x0 + run > PGM2_SPRBUF_W) i1 = PGM2_SPRBUF_W - x0;
+		} else {
+			if (x0 >= PGM2_SPRBUF_W) i0 = x0 - (PGM2_SPRBUF_W - 1);
+			if (x0 - run < -1) i1 = x0 + 1;
+		}
+
+		UINT32 po = palette_offset;
+		if (realdraw_inc > 0 && palette_inc > 0 && ((po + i0) & colour_mask) + (i1 - i0) <= colour_mask + 1) {
+			const UINT8 *src = Pgm2SprROM + colour_base + ((po + i0) & colour_mask);
+			UINT16 *dst = row + x0 + i0;
+			for (INT32 i = 0; i < i1 - i0; i++)
+				dst[i] = (UINT16)((src[i] & 0x3F) + pal);
+		} else {
+			for (INT32 i = i0; i < i1; i++)
+				row[x0 + i * realdraw_inc] = (UINT16)((Pgm2SprROM[colour_base + ((po + i * palette_inc) & colour_mask)] & 0x3F) + pal);
+		}
+
+		palette_offset = (po + run * palette_inc) & colour_mask;
+		pos += run;
+	}
+
+	realxdraw += 32 * realdraw_inc;
+}
+
 static void pgm2_draw_sprite_line(UINT32 mask_base, UINT32 mask_mask,
 	UINT32 colour_base, UINT32 colour_mask, UINT32 realspritekey,
 	UINT32 &mask_offset, UINT32 &palette_offset,
@@ -183,6 +267,15 @@ static void pgm2_draw_sprite_line(UINT32 mask_base, UINT32 mask_mask,
 	if (flipx ^ reverse)
 		realxdraw = (popcount32(zoomx_bits) * sizex) - 1;
 
+	// line off the buffer: only the colour offset needs advancing
+	if ((UINT32)realy >= PGM2_SPRBUF_H) zoomybit = 0;
+
+	INT32 realdraw_inc = (flipx ^ reverse) ? -1 : 1;
+	INT32 palette_inc  = reverse ? -1 : 1;
+	INT32 chunk_width  = 32 * xrepeats + popcount32(zoomx_bits);
+	bool unzoomed      = (zoomx_bits == 0xFFFFFFFFu && xrepeats == 0);
+	UINT16 *row        = zoomybit ? (Pgm2SpriteBuf + realy * PGM2_SPRBUF_W) : NULL;
+
 	for (INT32 xdraw = 0; xdraw < sizex; xdraw++)
 	{
 		UINT32 moff = mask_base + (mask_offset & mask_mask);
@@ -198,7 +291,12 @@ static void pgm2_draw_sprite_line(UINT32 mask_base, UINT32 mask_mask,
 		else         mask_offset += 4;
 		mask_offset &= mask_mask;
 
-		if (zoomybit) {
+		if (zoomybit && maskdata == 0) {
+			realxdraw += chunk_width * realdraw_inc;
+		} else if (zoomybit && unzoomed) {
+			pgm2_draw_sprite_span_chunk(colour_base, colour_mask, palette_offset,
+				x, row, pal, maskdata, realxdraw, realdraw_inc, palette_inc);
+		} else if (zoomybit) {
 			if (!flipx) {
 				if (!reverse)
 					pgm2_draw_sprite_chunk(colour_base, colour_mask, palette_offset,
@@ -234,13 +332,7 @@ static void pgm2_draw_sprites()
 	// Sprite mask encryption key (bitswap<32>(key ^ 0x90055555, 0..31))
 	UINT32 realspritekey = 0;
 	if (Pgm2VideoRegs) {
-		UINT32 v = BURN_ENDIAN_SWAP_INT32(Pgm2VideoRegs[0x38 / 4]) ^ 0x90055555;
-		v = ((v >> 1) & 0x55555555) | ((v & 0x55555555) << 1);
-		v = ((v >> 2) & 0x33333333) | ((v & 0x33333333) << 2);
-		v = ((v >> 4) & 0x0F0F0F0F) | ((v & 0x0F0F0F0F) << 4);
-		v = ((v >> 8) & 0x00FF00FF) | ((v & 0x00FF00FF) << 8);
-		v = (v >> 16) | (v << 16);
-		realspritekey = v;
+		realspritekey = bitrev32(BURN_ENDIAN_SWAP_INT32(Pgm2VideoRegs[0x38 / 4]) ^ 0x90055555);
 	}
 
 	// Find end-of-list (w2 bit 31)
@@ -332,30 +424,16 @@ static void pgm2_draw_sprites()
 	}
 }
 
-// Blit one priority layer from sprite buffer to screen (direct RGB)
-static void pgm2_blit_sprites(INT32 w, INT32 h, INT32 pri)
-{
-	if (!Pgm2SpriteBuf || !Pgm2SpPal) return;
-	UINT16 pri_mask = (UINT16)(pri << 12);
-	for (INT32 y = 0; y < h; y++) {
-		UINT16 *src = Pgm2SpriteBuf + y * PGM2_SPRBUF_W;
-		for (INT32 x = 0; x < w; x++) {
-			UINT16 pix = src[x];
-			if (pix != 0x8000 && (pix & 0x1000) == pri_mask) {
-				UINT32 rgb = BURN_ENDIAN_SWAP_INT32(Pgm2SpPal[pix & 0xFFF]);
-				pgm2PutPix(x, y, BurnHighCol((rgb >> 16) & 0xFF, (rgb >> 8) & 0xFF, rgb & 0xFF, 0));
-			}
-		}
-	}
-}
-
 // ---------------------------------------------------------------------------
 // BG tilemap  (32x32 pixel tiles, 64x32 tile map, 7bpp)
 // Tile data: raw bytes in Pgm2SprROM[0..BgROMLen-1], pen = byte & 0x7F
 // VRAM entry: bits 17:0 = tile number, bits 21:18 = colour (×128), bits 24:23 = flipxy
 // ---------------------------------------------------------------------------
-static void pgm2_draw_bg(INT32 w, INT32 h)
+// Renders line py into dst[0..w-1] as BG palette indices, 0 = transparent
+static void pgm2_draw_bg_line(INT32 py, INT32 w, UINT16 *dst)
 {
+	memset(dst, 0, w * sizeof(UINT16));
+
 	if (!Pgm2BgVRAM || !Pgm2SprROM || !Pgm2BgPal) return;
 
 	UINT32 *vram = (UINT32*)Pgm2BgVRAM;
@@ -374,56 +452,52 @@ static void pgm2_draw_bg(INT32 w, INT32 h)
 	const bool tile_count_pow2 = (bg_tile_count & (bg_tile_count - 1)) == 0;
 	UINT32 *lineram = (UINT32*)SnapLineRAM;
 
-	for (INT32 py = 0; py < h; py++)
-	{
-		INT32 src_y = (py + scroll_y) & (VIRT_H - 1);
-		INT32 ty = src_y / TILE_H, ty_off = src_y % TILE_H;
-
-		// Per-line BG scroll (packed: even line = low 16, odd line = high 16)
-		// MAME indexes lineram by screen row (py), not tilemap-space row (src_y)
-		INT32 line_scroll_x = scroll_x;
-		if (lineram) {
-			UINT32 lrval = BURN_ENDIAN_SWAP_INT32(lineram[(py >> 1) & 0xFF]);
-			UINT16 ls16 = (py & 1) ? (UINT16)((lrval >> 16) & 0xFFFF) : (UINT16)(lrval & 0xFFFF);
-			line_scroll_x += (INT32)(INT16)ls16;
-		}
+	INT32 src_y = (py + scroll_y) & (VIRT_H - 1);
+	INT32 ty = src_y / TILE_H, ty_off = src_y % TILE_H;
 
-		INT32 px = 0;
-		while (px < w)
-		{
-			INT32 src_x = (px + line_scroll_x) & (VIRT_W - 1);
-			INT32 tx = src_x / TILE_W;
-			INT32 tx_start = src_x % TILE_W;
-
-			UINT32 entry = BURN_ENDIAN_SWAP_INT32(vram[ty * MAP_W + tx]);
-			UINT32 tileno = entry & 0x3FFFFu;
-			UINT8  colour = (entry >> 18) & 0xFu;
-			UINT8  flipxy = (entry >> 23) & 3u;	// flip bits are 24:23
-
-			if (tile_count_pow2) tileno &= (bg_tile_count - 1);
-			else                 tileno %= bg_tile_count;
-
-			UINT32 tile_base = tileno * BG_TILE_SZ;
-			bool tile_valid = (tile_base + BG_TILE_SZ <= nBgRomLen);
-
-			INT32 fy_base = (flipxy & 2) ? (TILE_H - 1 - ty_off) : ty_off;
-			const UINT8 *tile_row = tile_valid ? (Pgm2SprROM + tile_base + fy_base * TILE_W) : NULL;
-
-			INT32 tx_end = TILE_W;
-			if (px + (tx_end - tx_start) > w) tx_end = tx_start + (w - px);
-
-			if (tile_row) {
-				UINT32 pal_base = colour * 0x80u;
-				for (INT32 tx_off = tx_start; tx_off < tx_end; tx_off++, px++) {
-					INT32 fx = (flipxy & 1) ? (TILE_W - 1 - tx_off) : tx_off;
-					UINT8 pix = tile_row[fx] & 0x7F;
-					if (pix == 0) continue;
-					UINT32 rgb = BURN_ENDIAN_SWAP_INT32(Pgm2BgPal[(pal_base + pix) & 0x7FFu]);
-					pgm2PutPix(px, py, BurnHighCol((rgb >> 16) & 0xFF, (rgb >> 8) & 0xFF, rgb & 0xFF, 0));
-				}
-			} else {
-				px += (tx_end - tx_start);
+	// Per-line BG scroll (packed: even line = low 16, odd line = high 16)
+	// MAME indexes lineram by screen row (py), not tilemap-space row (src_y)
+	INT32 line_scroll_x = scroll_x;
+	if (lineram) {
+		UINT32 lrval = BURN_ENDIAN_SWAP_INT32(lineram[(py >> 1) & 0xFF]);
+		UINT16 ls16 = (py & 1) ? (UINT16)((lrval >> 16) & 0xFFFF) : (UINT16)(lrval & 0xFFFF);
+		line_scroll_x += (INT32)(INT16)ls16;
+	}
+
+	INT32 px = 0;
+	while (px < w)
+	{
+		INT32 src_x = (px + line_scroll_x) & (VIRT_W - 1);
+		INT32 tx = src_x / TILE_W;
+		INT32 tx_start = src_x % TILE_W;
+
+		UINT32 entry = BURN_ENDIAN_SWAP_INT32(vram[ty * MAP_W + tx]);
+		UINT32 tileno = entry & 0x3FFFFu;
+		UINT8  colour = (entry >> 18) & 0xFu;
+		UINT8  flipxy = (entry >> 23) & 3u;	// flip bits are 24:23
+
+		if (tile_count_pow2) tileno &= (bg_tile_count - 1);
+		else                 tileno %= bg_tile_count;
+
+		UINT32 tile_base = tileno * BG_TILE_SZ;
+		bool tile_valid = (tile_base + BG_TILE_SZ <= nBgRomLen);
+
+		INT32 fy_base = (flipxy & 2) ? (TILE_H - 1 - ty_off) : ty_off;
+		const UINT8 *tile_row = tile_valid ? (Pgm2SprROM + tile_base + fy_base * TILE_W) : NULL;
+
+		INT32 tx_end = TILE_W;
+		if (px + (tx_end - tx_start) > w) tx_end = tx_start + (w - px);
+
+		if (tile_row) {
+			// pal_base is a multiple of 0x80, so an opaque pen never gives index 0
+			UINT32 pal_base = colour * 0x80u;
+			for (INT32 tx_off = tx_start; tx_off < tx_end; tx_off++, px++) {
+				INT32 fx = (flipxy & 1) ? (TILE_W - 1 - tx_off) : tx_off;
+				UINT8 pix = tile_row[fx] & 0x7F;
+				if (pix) dst[px] = (UINT16)((pal_base + pix) & 0x7FFu);
 			}
+		} else {
+			px += (tx_end - tx_start);
 		}
 	}
 }
@@ -433,8 +507,11 @@ static void pgm2_draw_bg(INT32 w, INT32 h)
 // gfx_8x8x4_packed_lsb: even pixel = low nibble, odd pixel = high nibble
 // VRAM entry: bits 17:0 = tile number, bits 22:18 = colour (×16), bits 24:23 = flipxy
 // ---------------------------------------------------------------------------
-static void pgm2_draw_fg(INT32 w, INT32 h)
+// Renders line py into dst[0..w-1] as TX palette indices, 0 = transparent
+static void pgm2_draw_fg_line(INT32 py, INT32 w, UINT16 *dst)
 {
+	memset(dst, 0, w * sizeof(UINT16));
+
 	if (!Pgm2FgVRAM || !Pgm2TileROM || !Pgm2TxPal) return;
 
 	UINT32 *vram = (UINT32*)Pgm2FgVRAM;
@@ -453,50 +530,80 @@ static void pgm2_draw_fg(INT32 w, INT32 h)
 
 	const bool tile_count_pow2 = (fg_tile_count & (fg_tile_count - 1)) == 0;
 
-	for (INT32 py = 0; py < h; py++)
-	{
-		INT32 src_y = ((py + scroll_y) % VIRT_H + VIRT_H) % VIRT_H;
-		INT32 ty = src_y / TILE_H, ty_off = src_y % TILE_H;
+	INT32 src_y = ((py + scroll_y) % VIRT_H + VIRT_H) % VIRT_H;
+	INT32 ty = src_y / TILE_H, ty_off = src_y % TILE_H;
 
-		INT32 px = 0;
-		while (px < w)
-		{
-			INT32 src_x = ((px + scroll_x) % VIRT_W + VIRT_W) % VIRT_W;
-			INT32 tx = src_x / TILE_W;
-			INT32 tx_start = src_x % TILE_W;
-
-			UINT32 entry = BURN_ENDIAN_SWAP_INT32(vram[ty * MAP_W + tx]);
-			UINT32 tileno = entry & 0x3FFFFu;
-			UINT8  colour = (entry >> 18) & 0x1Fu;
-			UINT8  flipxy = (entry >> 23) & 3u;	// flip bits are 24:23
-
-			if (tile_count_pow2) tileno &= (fg_tile_count - 1);
-			else                 tileno %= fg_tile_count;
-
-			INT32 fy = (flipxy & 2) ? (TILE_H - 1 - ty_off) : ty_off;
-			UINT32 tile_row_base = tileno * FG_TILE_SZ + fy * (TILE_W / 2);
-			bool tile_valid = (tile_row_base + (TILE_W / 2) <= fg_rom_len);
-
-			INT32 tx_end = TILE_W;
-			if (px + (tx_end - tx_start) > w) tx_end = tx_start + (w - px);
-
-			if (tile_valid) {
-				UINT32 pal_base = colour * 0x10u;
-				for (INT32 tx_off = tx_start; tx_off < tx_end; tx_off++, px++) {
-					INT32 fx = (flipxy & 1) ? (TILE_W - 1 - tx_off) : tx_off;
-					UINT8 byte_val = Pgm2TileROM[tile_row_base + fx / 2];
-					UINT8 pix = (fx & 1) ? (byte_val >> 4) : (byte_val & 0x0F);
-					if (pix == 0) continue;
-					UINT32 rgb = BURN_ENDIAN_SWAP_INT32(Pgm2TxPal[(pal_base + pix) & 0x1FFu]);
-					pgm2PutPix(px, py, BurnHighCol((rgb >> 16) & 0xFF, (rgb >> 8) & 0xFF, rgb & 0xFF, 0));
-				}
-			} else {
-				px += (tx_end - tx_start);
+	INT32 px = 0;
+	while (px < w)
+	{
+		INT32 src_x = ((px + scroll_x) % VIRT_W + VIRT_W) % VIRT_W;
+		INT32 tx = src_x / TILE_W;
+		INT32 tx_start = src_x % TILE_W;
+
+		UINT32 entry = BURN_ENDIAN_SWAP_INT32(vram[ty * MAP_W + tx]);
+		UINT32 tileno = entry & 0x3FFFFu;
+		UINT8  colour = (entry >> 18) & 0x1Fu;
+		UINT8  flipxy = (entry >> 23) & 3u;	// flip bits are 24:23
+
+		if (tile_count_pow2) tileno &= (fg_tile_count - 1);
+		else                 tileno %= fg_tile_count;
+
+		INT32 fy = (flipxy & 2) ? (TILE_H - 1 - ty_off) : ty_off;
+		UINT32 tile_row_base = tileno * FG_TILE_SZ + fy * (TILE_W / 2);
+		bool tile_valid = (tile_row_base + (TILE_W / 2) <= fg_rom_len);
+
+		INT32 tx_end = TILE_W;
+		if (px + (tx_end - tx_start) > w) tx_end = tx_start + (w - px);
+
+		if (tile_valid) {
+			UINT32 pal_base = colour * 0x10u;
+			for (INT32 tx_off = tx_start; tx_off < tx_end; tx_off++, px++) {
+				INT32 fx = (flipxy & 1) ? (TILE_W - 1 - tx_off) : tx_off;
+				UINT8 byte_val = Pgm2TileROM[tile_row_base + fx / 2];
+				UINT8 pix = (fx & 1) ? (byte_val >> 4) : (byte_val & 0x0F);
+				if (pix) dst[px] = (UINT16)((pal_base + pix) & 0x1FFu);
 			}
+		} else {
+			px += (tx_end - tx_start);
+		}
+	}
+}
+
+// ---------------------------------------------------------------------------
+// Palette cache / line output
+// ---------------------------------------------------------------------------
+
+static void pgm2_update_palette(const UINT32 *src, UINT32 *raw, UINT32 *col, INT32 n, bool force)
+{
+	for (INT32 i = 0; i < n; i++) {
+		UINT32 v = src[i];
+		if (force || v != raw[i]) {
+			UINT32 rgb = BURN_ENDIAN_SWAP_INT32(v);
+			raw[i] = v;
+			col[i] = BurnHighCol((rgb >> 16) & 0xFF, (rgb >> 8) & 0xFF, rgb & 0xFF, 0);
 		}
 	}
 }
 
+static void pgm2_put_line(INT32 y, const UINT32 *src, INT32 w)
+{
+	UINT8 *dst = pBurnDraw + y * nBurnPitch;
+
+	switch (nBurnBpp) {
+		case 4:
+			memcpy(dst, src, w * sizeof(UINT32));
+			break;
+		case 2: {
+			UINT16 *d = (UINT16*)dst;
+			for (INT32 x = 0; x < w; x++) d[x] = (UINT16)src[x];
+			break;
+		}
+		default:
+			for (INT32 x = 0; x < w; x++) PutPix(dst + x * nBurnBpp, src[x]);
+			break;
+	}
+}
+
 // ---------------------------------------------------------------------------
 // Main draw function (called from pgm2Frame after all scanlines)
 // ---------------------------------------------------------------------------
@@ -517,26 +624,51 @@ INT32 pgm2DoDraw()
 	if (w > nScreenWidth) w = nScreenWidth;
 	if (h > nScreenHeight) h = nScreenHeight;
 
-	// Fill entire output with BG palette entry 0
-	UINT32 bg_col = 0;
-	if (Pgm2BgPal) {
-		UINT32 rgb = BURN_ENDIAN_SWAP_INT32(Pgm2BgPal[0]);
-		bg_col = BurnHighCol((rgb >> 16) & 0xFF, (rgb >> 8) & 0xFF, rgb & 0xFF, 0);
-	}
-	for (INT32 y = 0; y < nScreenHeight; y++)
-		for (INT32 x = 0; x < nScreenWidth; x++)
-			pgm2PutPix(x, y, bg_col);
-
-	// Layer compositing (matches MAME screen_update):
-	//   1. hi-pri sprites (behind BG)
-	//   2. BG tilemap (32×32 tiles, 7bpp)
-	//   3. lo-pri sprites (above BG, below FG)
-	//   4. FG text tilemap (8×8 tiles, 4bpp)
+	bool force = (nPalCacheBpp != nBurnBpp || pPalCacheHighCol != BurnHighCol);
+	nPalCacheBpp = nBurnBpp;
+	pPalCacheHighCol = BurnHighCol;
+
+	if (Pgm2SpPal) pgm2_update_palette(Pgm2SpPal, SpPalRaw, SpPalCol, PGM2_SPPAL_N, force);
+	if (Pgm2BgPal) pgm2_update_palette(Pgm2BgPal, BgPalRaw, BgPalCol, PGM2_BGPAL_N, force);
+	if (Pgm2TxPal) pgm2_update_palette(Pgm2TxPal, TxPalRaw, TxPalCol, PGM2_TXPAL_N, force);
+
+	// Backdrop is BG palette entry 0
+	UINT32 bg_col = Pgm2BgPal ? BgPalCol[0] : 0;
+
 	pgm2_draw_sprites();
-	pgm2_blit_sprites(w, h, 1);
-	pgm2_draw_bg(w, h);
-	pgm2_blit_sprites(w, h, 0);
-	pgm2_draw_fg(w, h);
+	bool sprites = (Pgm2SpriteBuf && Pgm2SprROM && nSprMaskLen && nSprColLen && Pgm2SpPal);
+
+	// Layer order (matches MAME screen_update), back to front:
+	//   backdrop, hi-pri sprites (behind BG), BG tilemap (32×32, 7bpp),
+	//   lo-pri sprites, FG text tilemap (8×8, 4bpp)
+	INT32 sw = (nScreenWidth < PGM2_SPRBUF_W) ? nScreenWidth : PGM2_SPRBUF_W;
+
+	for (INT32 y = 0; y < nScreenHeight; y++)
+	{
+		INT32 x = 0;
+
+		if (y < h) {
+			const UINT16 *spr = sprites ? (Pgm2SpriteBuf + y * PGM2_SPRBUF_W) : NULL;
+
+			pgm2_draw_bg_line(y, w, BgLine);
+			pgm2_draw_fg_line(y, w, FgLine);
+
+			for (; x < w; x++) {
+				UINT32 c = bg_col;
+				UINT16 sp = spr ? spr[x] : 0x8000;
+				if ((sp & 0x9000) == 0x1000) c = SpPalCol[sp & 0xFFF];
+				if (BgLine[x])               c = BgPalCol[BgLine[x]];
+				if ((sp & 0x9000) == 0)      c = SpPalCol[sp & 0xFFF];
+				if (FgLine[x])               c = TxPalCol[FgLine[x]];
+				CompLine[x] = c;
+			}
+		}
+
+		for (; x < sw; x++)
+			CompLine[x] = bg_col;
+
+		pgm2_put_line(y, CompLine, sw);
+	}
 
 	return 0;
 }
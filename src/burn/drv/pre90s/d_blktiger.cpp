@@ -465,6 +465,7 @@ static INT32 DrvGfxDecode()
 	memcpy (tmp, DrvGfxROM2, 0x40000);
 
 	GfxDecode(0x0800, 4, 16, 16, Plane + 0, XOffs, YOffs, 0x200, tmp, DrvGfxROM2);
+	GenericTilesSetGfxOpacity(DrvGfxROM2, 16, 16, 0x80000);
 
 	BurnFree (tmp);
 	
@@ -527,6 +527,7 @@ static INT32 DrvGfxDecode()
 	memcpy (tmp, DrvGfxROM2, 0x080000);
 
 	GfxDecode(0x1000, 4, 16, 16, Plane1, XOffs2, YOffs2, 0x400, tmp, DrvGfxROM2);
+	GenericTilesSetGfxOpacity(DrvGfxROM2, 16, 16, 0x100000);
 
 	BurnFree (tmp);
 
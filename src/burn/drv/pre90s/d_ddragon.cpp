@@ -1167,6 +1167,7 @@ static INT32 RomLoader(bool bLoad)
 
 				memcpy(temp, DrvSprites, gLen[1]);
 				GfxDecode(gfx_count[1], 4, 16, 16, SpritePlaneOffsets, TileXOffsets, TileYOffsets, 0x200, temp, DrvSprites);
+				GenericTilesSetGfxOpacity(DrvSprites, 16, 16, gfx_count[1] * 16 * 16);
 
 				memcpy(temp, DrvTiles, gLen[2]);
 				GfxDecode(gfx_count[2], 4, 16, 16, TilePlaneOffsets, TileXOffsets, TileYOffsets, 0x200, temp, DrvTiles);
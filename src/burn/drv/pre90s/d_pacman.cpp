@@ -3002,6 +3002,8 @@ static void DrvDrawEnd()
 
 static INT32 DrvDraw()
 {
+	if (BurnVideoUnchanged()) return 0;
+
 	DrvDrawBegin();
 
 	DrawBackground();
@@ -3123,6 +3125,19 @@ static INT32 DrvScan(INT32 nAction, INT32 *pnMin)
 		*pnMin = 0x029693;
 	}
 
+	if (nAction & ACB_VIDEO) {
+		ScanVar(DrvVidRAM, 0x400, "Video RAM");
+		ScanVar(DrvColRAM, 0x400, "Color RAM");
+		ScanVar(DrvSprRAM, 0x010, "Sprite RAM");
+		ScanVar(DrvSprRAM2, 0x010, "Sprite RAM 2");
+		ScanVar(flipscreen, 0x001, "flipscreen");
+
+		SCAN_VAR(colortablebank);
+		SCAN_VAR(palettebank);
+		SCAN_VAR(spritebank);
+		SCAN_VAR(charbank);
+	}
+
 	if (nAction & ACB_VOLATILE) {
 		memset(&ba, 0, sizeof(ba));
 		ba.Data	  = AllRam;
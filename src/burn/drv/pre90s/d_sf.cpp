@@ -651,6 +651,7 @@ static INT32 DrvGfxDecode()
 	memcpy (tmp, Gfx2, 0x1c0000);
 
 	GfxDecode(0x3800, 4, 16, 16, Gfx2Planes, GfxXOffsets, GfxYOffsets, 0x200, tmp, Gfx2);
+	GenericTilesSetGfxOpacity(Gfx2, 16, 16, 0x380000);
 
 	memcpy (tmp, Gfx3, 0x004000);
 
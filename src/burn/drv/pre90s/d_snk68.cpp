@@ -1009,6 +1009,7 @@ static INT32 DrvGfxDecode(INT32 *spriPlanes, INT32 *spriXOffs, INT32 *spriYOffs,
 	memcpy (tmp, DrvGfx1, 0x300000);
 
 	GfxDecode(0x6000, 4, 16, 16, spriPlanes, spriXOffs, spriYOffs, modulo, tmp, DrvGfx1);
+	GenericTilesSetGfxOpacity(DrvGfx1, 16, 16, 0x600000);
 
 	BurnFree (tmp);
 
@@ -609,6 +609,7 @@ static INT32 TerracreInit()
 	GenericTilesSetGfx(0, DrvGfxROM[0], 4,  8,  8, 0x04000, 0x1100, 0x00);
 	GenericTilesSetGfx(1, DrvGfxROM[1], 4, 16, 16, 0x20000, 0x1000, 0x0f);
 	GenericTilesSetGfx(2, DrvGfxROM[2], 4, 16, 16, 0x20000, 0x0000, 0xff);
+	GenericTilesSetGfxOpacity(DrvGfxROM[2], 16, 16, 0x20000);
 	GenericTilemapInit(0, TILEMAP_SCAN_COLS, tx_map_callback,  8,  8, 64, 32);
 	GenericTilemapInit(1, TILEMAP_SCAN_COLS, bg_map_callback, 16, 16, 64, 32);
 	GenericTilemapInit(2, TILEMAP_SCAN_COLS, bgX_map_callback, 16, 16, 128, 64);
@@ -644,6 +645,7 @@ static INT32 AmazonInit()
 	GenericTilesSetGfx(0, DrvGfxROM[0], 4,  8,  8, 0x04000, 0x1100, 0x00);
 	GenericTilesSetGfx(1, DrvGfxROM[1], 4, 16, 16, 0x40000, 0x1000, 0x0f);
 	GenericTilesSetGfx(2, DrvGfxROM[2], 4, 16, 16, (is_horekid) ? 0x40000 : 0x20000, 0x0000, 0xff);
+	GenericTilesSetGfxOpacity(DrvGfxROM[2], 16, 16, (is_horekid) ? 0x40000 : 0x20000);
 	GenericTilemapInit(0, TILEMAP_SCAN_COLS, tx_map_callback,  8,  8, 64, 32);
 	GenericTilemapInit(1, TILEMAP_SCAN_COLS, bg_map_callback, 16, 16, 64, 32);
 	GenericTilemapInit(2, TILEMAP_SCAN_COLS, bgX_map_callback, 16, 16, 128, 64);
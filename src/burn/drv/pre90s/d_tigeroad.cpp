@@ -574,6 +574,7 @@ static INT32 DrvGfxDecode()
 	memcpy (tmp, DrvGfxROM2, 0x080000);
 
 	GfxDecode(0x1000, 4, 16, 16, Plane1 + 0, XOffs1, YOffs1, 0x100, tmp, DrvGfxROM2);
+	GenericTilesSetGfxOpacity(DrvGfxROM2, 16, 16, 0x100000);
 
 	for (INT32 i = 0; i < 16; i++) {
 		DrvTransMask[i] = (0xfe00 >> i) & 1;
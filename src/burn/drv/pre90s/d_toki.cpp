@@ -576,6 +576,7 @@ static INT32 TokibGfxDecode()
 	memcpy (tmp, DrvGfxROM1, 0x100000);
 
 	GfxDecode(8192, 4, 16, 16, Plane1, XOffs0, YOffs0, 0x100, tmp, DrvGfxROM1);
+	GenericTilesSetGfxOpacity(DrvGfxROM1, 16, 16, 0x200000);
 
 	memcpy (tmp, DrvGfxROM2, 0x080000);
 
@@ -611,6 +612,7 @@ static INT32 DrvGfxDecode()
 	memcpy (tmp, DrvGfxROM1, 0x100000);
 
 	GfxDecode(8192, 4, 16, 16, Plane1, XOffs1, YOffs1, 0x400, tmp, DrvGfxROM1);
+	GenericTilesSetGfxOpacity(DrvGfxROM1, 16, 16, 0x200000);
 
 	memcpy (tmp, DrvGfxROM2, 0x080000);
 
@@ -2336,6 +2336,10 @@ static INT32 DrvScan(INT32 nAction, INT32 *pnMin)
 
 		i386Scan(nAction);
 
+		if (nAction & ACB_WRITE) {
+			i386InvalidateCode(0x00000000, 0x0003ffff);	// main ram (and any code in it) was just restored
+		}
+
 		if (sound_system == 0) MSM6295Scan(nAction, pnMin);
 
 		if (sound_system == 1) ZetScan(nAction);
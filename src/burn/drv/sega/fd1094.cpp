@@ -283,10 +283,30 @@ static const UINT16 masked_opcodes[] =
 static UINT8 masked_opcodes_lookup[2][65536/8/2];
 static UINT8 masked_opcodes_created = FALSE;
 
-static INT32 final_decrypt(INT32 i,INT32 moreffff)
+static void create_masked_opcodes()
 {
 	UINT32 j;
 
+	if (masked_opcodes_created)
+		return;
+
+	for (j = 0; j < ARRAY_LENGTH(masked_opcodes); j++)
+	{
+		UINT16 opcode = masked_opcodes[j];
+		masked_opcodes_lookup[0][opcode >> 4] |= 1 << ((opcode >> 1) & 7);
+		masked_opcodes_lookup[1][opcode >> 4] |= 1 << ((opcode >> 1) & 7);
+	}
+	for (j = 0; j < 65536; j += 2)
+	{
+		if ((j & 0xff80) == 0x4e80 || (j & 0xf0f8) == 0x50c8 || (j & 0xf000) == 0x6000)
+			masked_opcodes_lookup[1][j >> 4] |= 1 << ((j >> 1) & 7);
+	}
+
+	masked_opcodes_created = TRUE;
+}
+
+static INT32 final_decrypt(INT32 i,INT32 moreffff)
+{
 	/* final "obfuscation": invert bits 7 and 14 following a fixed pattern */
 	INT32 dec = i;
 	if ((i & 0xf080) == 0x8000) dec ^= 0x0080;
@@ -295,21 +315,7 @@ static INT32 final_decrypt(INT32 i,INT32 moreffff)
 	if ((i & 0xb100) == 0x0000) dec ^= 0x4000;
 
 	/* mask out opcodes doing PC-relative addressing, replace them with FFFF */
-	if (!masked_opcodes_created)
-	{
-		masked_opcodes_created = TRUE;
-		for (j = 0; j < ARRAY_LENGTH(masked_opcodes); j++)
-		{
-			UINT16 opcode = masked_opcodes[j];
-			masked_opcodes_lookup[0][opcode >> 4] |= 1 << ((opcode >> 1) & 7);
-			masked_opcodes_lookup[1][opcode >> 4] |= 1 << ((opcode >> 1) & 7);
-		}
-		for (j = 0; j < 65536; j += 2)
-		{
-			if ((j & 0xff80) == 0x4e80 || (j & 0xf0f8) == 0x50c8 || (j & 0xf000) == 0x6000)
-				masked_opcodes_lookup[1][j >> 4] |= 1 << ((j >> 1) & 7);
-		}
-	}
+	create_masked_opcodes();
 
 	if ((masked_opcodes_lookup[moreffff][dec >> 4] >> ((dec >> 1) & 7)) & 1)
 		dec = 0xffff;
@@ -477,57 +483,78 @@ INT32 fd1094_set_state(UINT8 *key,INT32 state)
 	else
 		state = selected_state;
 
-	global_key1 = key[1];
-	global_key2 = key[2];
-	global_key3 = key[3];
+	INT32 gkey[3];
+	fd1094_get_keys(key, state, gkey);
+	global_key1 = gkey[0];
+	global_key2 = gkey[1];
+	global_key3 = gkey[2];
+
+	return state & 0xff;
+}
+
+/* global keys for a decoded state (the value fd1094_set_state() returns), touches no globals
+   so it can be used to decrypt a state other than the current one, from another thread */
+void fd1094_get_keys(UINT8 *key, INT32 state, INT32 *gkey)
+{
+	create_masked_opcodes(); // first use from the calling thread, not from decode()
+
+	gkey[0] = key[1];
+	gkey[1] = key[2];
+	gkey[2] = key[3];
 
 	if (state & 0x0001)
 	{
-		global_key1 ^= 0x04;	// global_xor1
-		global_key2 ^= 0x80;	// key_1a invert
-		global_key3 ^= 0x80;	// key_2a invert
+		gkey[0] ^= 0x04;	// global_xor1
+		gkey[1] ^= 0x80;	// key_1a invert
+		gkey[2] ^= 0x80;	// key_2a invert
 	}
 	if (state & 0x0002)
 	{
-		global_key1 ^= 0x01;	// global_swap2
-		global_key2 ^= 0x10;	// key_7a invert
-		global_key3 ^= 0x01;	// key_4b invert
+		gkey[0] ^= 0x01;	// global_swap2
+		gkey[1] ^= 0x10;	// key_7a invert
+		gkey[2] ^= 0x01;	// key_4b invert
 	}
 	if (state & 0x0004)
 	{
-		global_key1 ^= 0x80;	// key_0b invert - could be 0x20
-		global_key2 ^= 0x40;	// key_6b invert
-		global_key3 ^= 0x04;	// global_swap4
+		gkey[0] ^= 0x80;	// key_0b invert - could be 0x20
+		gkey[1] ^= 0x40;	// key_6b invert
+		gkey[2] ^= 0x04;	// global_swap4
 	}
 	if (state & 0x0008)
 	{
-		global_key1 ^= 0x20;	// global_xor0   - could be 0x80
-		global_key2 ^= 0x02;	// key_6a invert
-		global_key3 ^= 0x20;	// key_5a invert
+		gkey[0] ^= 0x20;	// global_xor0   - could be 0x80
+		gkey[1] ^= 0x02;	// key_6a invert
+		gkey[2] ^= 0x20;	// key_5a invert
 	}
 	if (state & 0x0010)
 	{
-		global_key1 ^= 0x02;	// key_0c invert
-		global_key1 ^= 0x40;	// key_5b invert
-		global_key2 ^= 0x08;	// key_4a invert
+		gkey[0] ^= 0x02;	// key_0c invert
+		gkey[0] ^= 0x40;	// key_5b invert
+		gkey[1] ^= 0x08;	// key_4a invert
 	}
 	if (state & 0x0020)
 	{
-		global_key1 ^= 0x08;	// key_1b invert
-		global_key3 ^= 0x08;	// key_3b invert
-		global_key3 ^= 0x10;	// global_swap1
+		gkey[0] ^= 0x08;	// key_1b invert
+		gkey[2] ^= 0x08;	// key_3b invert
+		gkey[2] ^= 0x10;	// global_swap1
 	}
 	if (state & 0x0040)
 	{
-		global_key1 ^= 0x10;	// key_2b invert
-		global_key2 ^= 0x20;	// global_swap0a
-		global_key2 ^= 0x04;	// global_swap0b
+		gkey[0] ^= 0x10;	// key_2b invert
+		gkey[1] ^= 0x20;	// global_swap0a
+		gkey[1] ^= 0x04;	// global_swap0b
 	}
 	if (state & 0x0080)
 	{
-		global_key2 ^= 0x01;	// key_3a invert
-		global_key3 ^= 0x02;	// key_0a invert
-		global_key3 ^= 0x40;	// global_swap3
+		gkey[1] ^= 0x01;	// key_3a invert
+		gkey[2] ^= 0x02;	// key_0a invert
+		gkey[2] ^= 0x40;	// global_swap3
 	}
-	return state & 0xff;
+}
+
+INT32 fd1094_decode_keys(INT32 address,INT32 val,UINT8 *key,const INT32 *gkey,INT32 vector_fetch)
+{
+	if (!key) return 0;
+
+	return decode(address,BURN_ENDIAN_SWAP_INT16(val),key,gkey[0],gkey[1],gkey[2],vector_fetch);
 }
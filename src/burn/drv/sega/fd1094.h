@@ -4,3 +4,7 @@
 
 INT32 fd1094_set_state(UINT8 *key, INT32 state);
 INT32 fd1094_decode(INT32 address, INT32 val, UINT8 *key, INT32 vector_fetch);
+
+// reentrant versions, for decrypting a state other than the current one
+void fd1094_get_keys(UINT8 *key, INT32 state, INT32 *gkey);
+INT32 fd1094_decode_keys(INT32 address, INT32 val, UINT8 *key, const INT32 *gkey, INT32 vector_fetch);
@@ -0,0 +1,346 @@
+// FD1094 decrypted state cache
+//
+// A state's decrypted image only depends on the key and the 8-bit state number, so
+// images are kept per state, as many as the caller asked for.  In background mode
+// every state the game uses stays cached, new states are queued to a worker thread
+// which decrypts them one page at a time.  When the cpu switches to a state that is
+// not finished yet, the emulation thread decrypts the pages the worker has not
+// claimed and waits for the rest, so the result is always the complete image.  The
+// states a game used are written to <nvram path>/<game>.fd1094 on exit and queued
+// again right after init next time.
+
+#include "burnint.h"
+#include "fd1094.h"
+#include "fd1094_cache.h"
+
+#if (defined _MSC_VER) || (defined WIN32)
+#define FD1094_THREADS_WIN32
+#include <windows.h>
+#elif defined(__linux__) || defined(__ANDROID__) || defined(__APPLE__)
+#define FD1094_THREADS_PTHREAD
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#define FD1094_STATES		0x100
+#define FD1094_PAGE_WORDS	0x1000		// 8KB
+
+enum { PAGE_TODO = 0, PAGE_BUSY, PAGE_DONE };
+
+struct fd1094_slot
+{
+	INT32 state;
+	INT32 gkey[3];
+	UINT16 *data;
+	volatile INT32 *page;		// PAGE_* for each page
+	volatile INT32 done;		// all pages decrypted
+};
+
+static UINT8 *cache_key;
+static UINT16 *cache_region;
+static UINT32 cache_words;
+static INT32 cache_pages;
+
+static fd1094_slot cache_slot[FD1094_STATES];
+static INT32 cache_slots;			// slots allowed
+static INT32 cache_slots_used;
+static INT32 cache_next;			// round robin position when full
+static INT32 state_slot[FD1094_STATES];
+static UINT8 state_seen[FD1094_STATES];
+static INT32 cache_background;
+
+static INT32 compare_exchange32(volatile INT32 *ptr, INT32 compare, INT32 exchange)
+{
+#if defined(_MSC_VER)
+	return InterlockedCompareExchange((volatile LONG *)ptr, exchange, compare);
+#elif defined(__GNUC__)
+	return __sync_val_compare_and_swap(ptr, compare, exchange);
+#else
+	INT32 prev = *ptr;
+	if (*ptr == compare)
+		*ptr = exchange;
+	return prev;
+#endif
+}
+
+// decrypt one page if nobody else has claimed it yet
+static void decrypt_page(fd1094_slot *slot, INT32 page)
+{
+	if (compare_exchange32(&slot->page[page], PAGE_TODO, PAGE_BUSY) != PAGE_TODO)
+		return;
+
+	UINT32 start = page * FD1094_PAGE_WORDS;
+	UINT32 end = start + FD1094_PAGE_WORDS;
+	if (end > cache_words) end = cache_words;
+
+	for (UINT32 addr = start; addr < end; addr++)
+		slot->data[addr] = fd1094_decode_keys(addr, cache_region[addr], cache_key, slot->gkey, 0);
+
+	compare_exchange32(&slot->page[page], PAGE_BUSY, PAGE_DONE);
+}
+
+//-----------------------------------------------------------------------------
+// worker thread
+
+#if defined(FD1094_THREADS_WIN32) || defined(FD1094_THREADS_PTHREAD)
+
+static INT32 worker_ok;
+static volatile INT32 worker_exit;
+static INT32 worker_queue[FD1094_STATES];	// slots waiting for the worker
+static INT32 worker_head, worker_tail;
+
+#if defined(FD1094_THREADS_WIN32)
+static HANDLE worker_thread;
+static HANDLE worker_wake;					// manual-reset
+static CRITICAL_SECTION worker_lock;
+#define worker_enter()		EnterCriticalSection(&worker_lock)
+#define worker_leave()		LeaveCriticalSection(&worker_lock)
+#define worker_signal()		SetEvent(worker_wake)
+#define worker_sleep()		do { ResetEvent(worker_wake); LeaveCriticalSection(&worker_lock); WaitForSingleObject(worker_wake, INFINITE); EnterCriticalSection(&worker_lock); } while (0)
+#define worker_yield()		SwitchToThread()
+#define worker_barrier()	MemoryBarrier()
+#else
+static pthread_t worker_thread;
+static pthread_cond_t worker_wake;
+static pthread_mutex_t worker_lock;
+#define worker_enter()		pthread_mutex_lock(&worker_lock)
+#define worker_leave()		pthread_mutex_unlock(&worker_lock)
+#define worker_signal()		pthread_cond_signal(&worker_wake)
+#define worker_sleep()		pthread_cond_wait(&worker_wake, &worker_lock)
+#define worker_yield()		sched_yield()
+#define worker_barrier()	__sync_synchronize()
+#endif
+
+static void worker_run()
+{
+	worker_enter();
+	while (!worker_exit)
+	{
+		if (worker_head == worker_tail) {
+			worker_sleep();
+			continue;
+		}
+
+		fd1094_slot *slot = &cache_slot[worker_queue[worker_head++ % FD1094_STATES]];
+		worker_leave();
+
+		for (INT32 i = 0; i < cache_pages && !worker_exit; i++)
+			decrypt_page(slot, i);
+
+		worker_enter();
+	}
+	worker_leave();
+}
+
+#if defined(FD1094_THREADS_WIN32)
+static DWORD WINAPI worker_proc(LPVOID) { worker_run(); return 0; }
+#else
+static void *worker_proc(void *) { worker_run(); return NULL; }
+#endif
+
+static void worker_init()
+{
+	worker_exit = 0;
+	worker_head = worker_tail = 0;
+
+#if defined(FD1094_THREADS_WIN32)
+	InitializeCriticalSection(&worker_lock);
+	worker_wake = CreateEvent(NULL, TRUE, FALSE, NULL);
+	worker_thread = (worker_wake) ? CreateThread(NULL, 0, worker_proc, NULL, 0, NULL) : NULL;
+	worker_ok = (worker_thread != NULL);
+	if (!worker_ok) {
+		if (worker_wake) CloseHandle(worker_wake);
+		DeleteCriticalSection(&worker_lock);
+	}
+#else
+	pthread_mutex_init(&worker_lock, NULL);
+	pthread_cond_init(&worker_wake, NULL);
+	worker_ok = (pthread_create(&worker_thread, NULL, worker_proc, NULL) == 0);
+	if (!worker_ok) {
+		pthread_cond_destroy(&worker_wake);
+		pthread_mutex_destroy(&worker_lock);
+	}
+#endif
+
+	if (!worker_ok)
+		bprintf(PRINT_ERROR, _T("FD1094: failure to create worker thread, decrypting on demand\n"));
+}
+
+static void worker_shutdown()
+{
+	if (!worker_ok)
+		return;
+
+	worker_enter();
+	worker_exit = 1;
+	worker_leave();
+	worker_signal();
+
+#if defined(FD1094_THREADS_WIN32)
+	WaitForSingleObject(worker_thread, INFINITE);
+	CloseHandle(worker_thread);
+	CloseHandle(worker_wake);
+	DeleteCriticalSection(&worker_lock);
+#else
+	pthread_join(worker_thread, NULL);
+	pthread_cond_destroy(&worker_wake);
+	pthread_mutex_destroy(&worker_lock);
+#endif
+
+	worker_ok = 0;
+}
+
+static void worker_push(INT32 n)
+{
+	if (!worker_ok)
+		return;
+
+	worker_enter();
+	worker_queue[worker_tail++ % FD1094_STATES] = n;
+	worker_leave();
+	worker_signal();
+}
+
+#else
+
+// no threads on this platform: states are decrypted when the cpu switches to them
+#define worker_ok		0
+#define worker_yield()
+#define worker_barrier()
+static void worker_init() { }
+static void worker_shutdown() { }
+static void worker_push(INT32) { }
+
+#endif
+
+//-----------------------------------------------------------------------------
+
+static INT32 slot_alloc(INT32 state)
+{
+	INT32 n;
+
+	if (cache_slots_used < cache_slots) {
+		n = cache_slots_used++;
+		cache_slot[n].data = (UINT16*)BurnMalloc(cache_words * sizeof(UINT16));
+		cache_slot[n].page = (volatile INT32*)BurnMalloc(cache_pages * sizeof(INT32));
+	} else {
+		// full (only without the worker thread) - reuse the oldest one
+		n = cache_next;
+		cache_next = (cache_next + 1) % cache_slots;
+		state_slot[cache_slot[n].state] = -1;
+#if 1 && defined FBNEO_DEBUG
+		bprintf(PRINT_NORMAL, _T("FD1094: out of cache, performance may suffer, increase the cache size!\n"));
+#endif
+	}
+
+	fd1094_slot *slot = &cache_slot[n];
+	slot->state = state;
+	fd1094_get_keys(cache_key, state, slot->gkey);
+	for (INT32 i = 0; i < cache_pages; i++) slot->page[i] = PAGE_TODO;
+	slot->done = 0;
+	state_slot[state] = n;
+
+	return n;
+}
+
+// queue a state for the worker (background mode only)
+static void cache_prefetch(INT32 state)
+{
+	if (!worker_ok || state_slot[state] >= 0)
+		return;
+
+	worker_push(slot_alloc(state));
+}
+
+static void states_load_save(INT32 save)
+{
+	TCHAR szFilename[MAX_PATH];
+	_stprintf(szFilename, _T("%s%s.fd1094"), szAppEEPROMPath, BurnDrvGetText(DRV_NAME));
+
+	if (save) {
+		FILE *fp = _tfopen(szFilename, _T("wt"));
+		if (!fp) return;
+
+		for (INT32 i = 0; i < FD1094_STATES; i++) {
+			if (state_seen[i]) fprintf(fp, "%02x\n", i);
+		}
+		fclose(fp);
+	} else {
+		FILE *fp = _tfopen(szFilename, _T("rt"));
+		if (!fp) return;
+
+		UINT32 state;
+		while (fscanf(fp, "%x", &state) == 1) {
+			if (state < FD1094_STATES) {
+				state_seen[state] = 1;
+				cache_prefetch(state);
+			}
+		}
+		fclose(fp);
+	}
+}
+
+UINT16 *fd1094_cache_get(INT32 state)
+{
+	state &= 0xff;
+	state_seen[state] = 1;
+
+	INT32 n = state_slot[state];
+	if (n < 0) n = slot_alloc(state);
+
+	fd1094_slot *slot = &cache_slot[n];
+	if (!slot->done) {
+		// help out with the pages the worker hasn't got to, then wait for its current one
+		for (INT32 i = 0; i < cache_pages; i++)
+			decrypt_page(slot, i);
+		for (INT32 i = 0; i < cache_pages; i++) {
+			while (slot->page[i] != PAGE_DONE)
+				worker_yield();
+		}
+		worker_barrier();
+		slot->done = 1;
+	}
+
+	return slot->data;
+}
+
+void fd1094_cache_init(UINT8 *key, UINT16 *region, UINT32 region_size, INT32 max_states, INT32 background)
+{
+	cache_key = key;
+	cache_region = region;
+	cache_words = region_size / 2;
+	cache_pages = (cache_words + FD1094_PAGE_WORDS - 1) / FD1094_PAGE_WORDS;
+
+	cache_slots = (max_states <= 0 || max_states > FD1094_STATES) ? FD1094_STATES : max_states;
+	cache_slots_used = 0;
+	cache_next = 0;
+	for (INT32 i = 0; i < FD1094_STATES; i++) state_slot[i] = -1;
+	memset(state_seen, 0, sizeof(state_seen));
+
+	// the worker decrypts into slots that must stay put, so it needs every state kept
+	cache_background = (background && cache_slots == FD1094_STATES);
+	if (!cache_background)
+		return;
+
+	worker_init();
+
+	// the irq state is always needed, then whatever this game used last time
+	cache_prefetch(key[0]);
+	states_load_save(0);
+}
+
+void fd1094_cache_exit()
+{
+	if (cache_background) {
+		worker_shutdown();
+		states_load_save(1);
+		cache_background = 0;
+	}
+
+	for (INT32 i = 0; i < cache_slots_used; i++) {
+		BurnFree(cache_slot[i].data);
+		_BurnFree((void*)cache_slot[i].page);
+		cache_slot[i].page = NULL;
+	}
+	cache_slots_used = 0;
+}
@@ -0,0 +1,10 @@
+// FD1094 decrypted state cache, shared by the System 16/18 and System 24 interfaces
+
+// max_states: number of decrypted copies to keep, reused round robin when full (0: all).
+// background: decrypt new states on a worker thread and warm up the states seen in
+// earlier sessions - only with max_states 0 and only for code in rom, not in ram.
+void fd1094_cache_init(UINT8 *key, UINT16 *region, UINT32 region_size, INT32 max_states, INT32 background);
+void fd1094_cache_exit();
+
+// decrypted copy of the region for a state returned by fd1094_set_state()
+UINT16 *fd1094_cache_get(INT32 state);
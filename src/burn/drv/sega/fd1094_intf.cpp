@@ -1,16 +1,12 @@
 #include "sys16.h"
 #include "fd1094.h"
-
-#define S16_NUMCACHE 8
+#include "fd1094_cache.h"
 
 static UINT8 *fd1094_key; // the memory region containing key
 static UINT16 *fd1094_cpuregion; // the CPU region with encrypted code
 static UINT32  fd1094_cpuregionsize; // the size of this region in bytes
 
 UINT16* s24_fd1094_userregion; // a user region where the current decrypted state is put and executed from
-static UINT16* fd1094_cacheregion[S16_NUMCACHE]; // a cache region where S16_NUMCACHE states are stored to improve performance
-static INT32 fd1094_cached_states[S16_NUMCACHE]; // array of cached state numbers
-static INT32 fd1094_current_cacheposition; // current position in cache array
 
 static INT32 fd1094_state;
 static INT32 fd1094_selected_state;
@@ -19,10 +15,8 @@ static void (*fd1094_callback)(UINT8 *);
 
 static INT32 nFD1094CPU = 0;
 
-/* this function checks the cache to see if the current state is cached,
-   if it is then it copies the cached data to the user region where code is
-   executed from, if its not cached then it gets decrypted to the current
-   cache position using the functions in fd1094.c */
+/* this function gets the decrypted copy of the new state from the cache
+   (fd1094_cache.cpp) and hands it to the driver's memory mapper */
 static void fd1094_setstate_and_decrypt(INT32 state)
 {
 	switch (state & 0x300) {
@@ -42,47 +36,12 @@ static void fd1094_setstate_and_decrypt(INT32 state)
 	/* set the FD1094 state ready to decrypt.. */
 	state = fd1094_set_state(fd1094_key, state);
 
-	/* first check the cache, if its cached we don't need to decrypt it, just copy */
-	for (INT32 i = 0; i < S16_NUMCACHE; i++)
-	{
-		if (fd1094_cached_states[i] == state)
-		{
-			/* copy cached state */
-			s24_fd1094_userregion = fd1094_cacheregion[i];
-
-			SekCPUPush(nFD1094CPU);
-			fd1094_callback((UINT8*)s24_fd1094_userregion);
-			SekCPUPop();
-
-			return;
-		}
-	}
-
-	/* mark it as cached (because it will be once we decrypt it) */
-	fd1094_cached_states[fd1094_current_cacheposition]=state;
-
-	for (UINT32 addr = 0; addr < fd1094_cpuregionsize / 2; addr++)
-	{
-		UINT16 dat = fd1094_decode(addr,fd1094_cpuregion[addr], fd1094_key, 0);
-		fd1094_cacheregion[fd1094_current_cacheposition][addr] = dat;
-	}
-
-	/* copy newly decrypted data to user region */
-	s24_fd1094_userregion = fd1094_cacheregion[fd1094_current_cacheposition];
+	/* get the decrypted copy of this state */
+	s24_fd1094_userregion = fd1094_cache_get(state);
 
 	SekCPUPush(nFD1094CPU);
 	fd1094_callback((UINT8*)s24_fd1094_userregion);
 	SekCPUPop();
-
-	fd1094_current_cacheposition++;
-
-	if (fd1094_current_cacheposition>=S16_NUMCACHE)
-	{
-#if 1 && defined FBA_DEBUG
-		bprintf(PRINT_NORMAL, _T("out of cache, performance may suffer, increase S16_NUMCACHE!\n"));
-#endif
-		fd1094_current_cacheposition=0;
-	}
 }
 
 /* Callback for CMP.L instructions (state change) */
@@ -139,10 +98,8 @@ void s24_fd1094_machine_init(void)
 }
 
 /* startup function, to be called from DRIVER_INIT (once on startup) */
-void s24_fd1094_driver_init(INT32 nCPU, INT32 /*cachesize*/, UINT8 *keybase, UINT8 *codebase, INT32 codebase_len, void (*cb)(UINT8*))
+void s24_fd1094_driver_init(INT32 nCPU, INT32 cachesize, UINT8 *keybase, UINT8 *codebase, INT32 codebase_len, void (*cb)(UINT8*))
 {
-	INT32 i;
-
 	nFD1094CPU = nCPU;
 
 	fd1094_cpuregion = (UINT16*)codebase;
@@ -159,15 +116,10 @@ void s24_fd1094_driver_init(INT32 nCPU, INT32 /*cachesize*/, UINT8 *keybase, UIN
 	if (!fd1094_key)
 		return;
 
-	for (i = 0; i < S16_NUMCACHE; i++)
-	{
-		fd1094_cacheregion[i] = (UINT16*)BurnMalloc(fd1094_cpuregionsize);
-	}
-
-	/* flush the cached state array */
-	for (i = 0; i < S16_NUMCACHE; i++) fd1094_cached_states[i] = -1;
+	/* the code is loaded into ram at runtime, so states are decrypted when they are
+	   switched to (never ahead of time) and only cachesize of them are kept */
+	fd1094_cache_init(fd1094_key, fd1094_cpuregion, fd1094_cpuregionsize, cachesize, 0);
 
-	fd1094_current_cacheposition = 0;
 	fd1094_state = -1;
 }
 
@@ -178,11 +130,7 @@ void s24_fd1094_exit()
 
 	nFD1094CPU = 0;
 
-	for (INT32 i = 0; i < S16_NUMCACHE; i++) {
-		BurnFree(fd1094_cacheregion[i]);
-	}
-
-	fd1094_current_cacheposition = 0;
+	fd1094_cache_exit();
 }
 
 void s24_fd1094_scan(INT32 nAction)
@@ -1,7 +1,7 @@
 void s24_fd1094_machine_init();
 
 // cpu # 0 or 1
-// cachesize is 8 for sys16, 16 for s24
+// cachesize: number of decrypted states kept (0: all)
 // fd1094 key
 // code base (68k rom/ram)
 // code base length (68k rom/ram) length
@@ -132,6 +132,9 @@ extern INT32 System16YM2413IRQInterval;
 
 extern bool System16HasGears;
 
+extern INT32 System16FD1094CacheSize;		// fd1094_driver_init() options, set before System16Init()
+extern INT32 System16FD1094Background;
+
 extern INT32 s16a_update_after_vblank;
 
 extern INT32 nSystem16CyclesDone[4]; 
@@ -333,7 +336,9 @@ void FD1089Decrypt();
 // sys16_fd1094.cpp
 extern UINT16* fd1094_userregion;
 
-void fd1094_driver_init(INT32 nCPU);
+// cachesize: number of decrypted states kept (0: all)
+// background: decrypt new states on a worker thread (needs cachesize 0)
+void fd1094_driver_init(INT32 nCPU, INT32 cachesize, INT32 background);
 void fd1094_machine_init();
 void fd1094_exit();
 void fd1094_scan(INT32 nAction);
@@ -1,7 +1,6 @@
 #include "sys16.h"
 #include "fd1094.h"
-
-#define S16_NUMCACHE 8
+#include "fd1094_cache.h"
 
 static UINT8 *fd1094_key; // the memory region containing key
 static UINT16 *fd1094_cpuregion; // the CPU region with encrypted code
@@ -9,9 +8,6 @@ static UINT32  fd1094_cpuregionsize; // the size of this region in bytes
 static UINT32  fd1094_cpuregionmask;
 
 UINT16* fd1094_userregion; // a user region where the current decrypted state is put and executed from
-static UINT16* fd1094_cacheregion[S16_NUMCACHE]; // a cache region where S16_NUMCACHE states are stored to improve performance
-static INT32 fd1094_cached_states[S16_NUMCACHE]; // array of cached state numbers
-static INT32 fd1094_current_cacheposition; // current position in cache array
 
 static INT32 fd1094_state;
 static INT32 fd1094_selected_state;
@@ -27,15 +23,10 @@ static void *fd1094_get_decrypted_base(void)
 	return fd1094_userregion;
 }*/
 
-/* this function checks the cache to see if the current state is cached,
-   if it is then it copies the cached data to the user region where code is
-   executed from, if its not cached then it gets decrypted to the current
-   cache position using the functions in fd1094.c */
+/* this function gets the decrypted copy of the new state from the cache
+   (fd1094_cache.cpp) and maps it as the region code is executed from */
 static void fd1094_setstate_and_decrypt(INT32 state)
 {
-	INT32 i;
-	UINT32 addr;
-	
 	switch (state & 0x300) {
 		case 0x000:
 		case FD1094_STATE_RESET:
@@ -51,49 +42,9 @@ static void fd1094_setstate_and_decrypt(INT32 state)
 	/* set the FD1094 state ready to decrypt.. */
 	state = fd1094_set_state(fd1094_key,state);
 
-	/* first check the cache, if its cached we don't need to decrypt it, just copy */
-	for (i=0;i<S16_NUMCACHE;i++)
-	{
-		if (fd1094_cached_states[i] == state)
-		{
-			/* copy cached state */
-			fd1094_userregion=fd1094_cacheregion[i];
-			INT32 nActiveCPU = SekGetActive();
-			if (nActiveCPU == -1) {
-				SekOpen(nFD1094CPU);
-				SekMapMemory((UINT8*)fd1094_userregion, 0x000000, fd1094_cpuregionmask, MAP_FETCH);
-//				if (System18Banking) SekMapMemory((UINT8*)fd1094_userregion + 0x200000, 0x200000, 0x27ffff, MAP_FETCH);
-				SekClose();
-			} else {
-				if (nActiveCPU == nFD1094CPU) {
-					SekMapMemory((UINT8*)fd1094_userregion, 0x000000, fd1094_cpuregionmask, MAP_FETCH);
-//					if (System18Banking) SekMapMemory((UINT8*)fd1094_userregion + 0x200000, 0x200000, 0x27ffff, MAP_FETCH);
-				} else {
-					SekClose();
-					SekOpen(nFD1094CPU);
-					SekMapMemory((UINT8*)fd1094_userregion, 0x000000, fd1094_cpuregionmask, MAP_FETCH);
-//					if (System18Banking) SekMapMemory((UINT8*)fd1094_userregion + 0x200000, 0x200000, 0x27ffff, MAP_FETCH);
-					SekClose();
-					SekOpen(nActiveCPU);
-				}
-			}
-
-			return;
-		}
-	}
-
-	/* mark it as cached (because it will be once we decrypt it) */
-	fd1094_cached_states[fd1094_current_cacheposition]=state;
-
-	for (addr=0;addr<fd1094_cpuregionsize/2;addr++)
-	{
-		UINT16 dat;
-		dat = fd1094_decode(addr,fd1094_cpuregion[addr],fd1094_key,0);
-		fd1094_cacheregion[fd1094_current_cacheposition][addr]=dat;
-	}
+	/* get the decrypted copy of this state */
+	fd1094_userregion = fd1094_cache_get(state);
 
-	/* copy newly decrypted data to user region */
-	fd1094_userregion=fd1094_cacheregion[fd1094_current_cacheposition];
 	INT32 nActiveCPU = SekGetActive();
 	if (nActiveCPU == -1) {
 		SekOpen(nFD1094CPU);
@@ -113,16 +64,6 @@ static void fd1094_setstate_and_decrypt(INT32 state)
 			SekOpen(nActiveCPU);
 		}
 	}
-	
-	fd1094_current_cacheposition++;
-
-	if (fd1094_current_cacheposition>=S16_NUMCACHE)
-	{
-#if 1 && defined FBNEO_DEBUG
-		bprintf(PRINT_NORMAL, _T("out of cache, performance may suffer, increase S16_NUMCACHE!\n"));
-#endif
-		fd1094_current_cacheposition=0;
-	}
 }
 
 /* Callback for CMP.L instructions (state change) */
@@ -179,10 +120,8 @@ void fd1094_machine_init(void)
 }
 
 /* startup function, to be called from DRIVER_INIT (once on startup) */
-void fd1094_driver_init(INT32 nCPU)
+void fd1094_driver_init(INT32 nCPU, INT32 cachesize, INT32 background)
 {
-	INT32 i;
-	
 	nFD1094CPU = nCPU;
 
 	if (nFD1094CPU == 0) {
@@ -216,15 +155,10 @@ void fd1094_driver_init(INT32 nCPU)
 	if (!fd1094_key)
 		return;
 		
-	for (i=0;i<S16_NUMCACHE;i++)
-	{
-		fd1094_cacheregion[i]=(UINT16*)BurnMalloc(fd1094_cpuregionsize);
-	}
+	/* the code is in rom, so with cachesize 0 every state can be kept and new ones
+	   decrypted in the background */
+	fd1094_cache_init(fd1094_key, fd1094_cpuregion, fd1094_cpuregionsize, cachesize, background);
 
-	/* flush the cached state array */
-	for (i=0;i<S16_NUMCACHE;i++) fd1094_cached_states[i] = -1;
-	
-	fd1094_current_cacheposition = 0;
 	fd1094_state = -1;
 	
 //	if (System16RomSize > 0x0fffff) System18Banking = true;
@@ -235,11 +169,9 @@ void fd1094_exit()
 	System18Banking = false;
 	nFD1094CPU = 0;
 	
-	for (INT32 i = 0; i < S16_NUMCACHE; i++) {
-		BurnFree(fd1094_cacheregion[i]);
+	if (fd1094_key) {
+		fd1094_cache_exit();
 	}
-	
-	fd1094_current_cacheposition = 0;
 }
 
 void fd1094_scan(INT32 nAction)
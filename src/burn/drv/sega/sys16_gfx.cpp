@@ -1,5 +1,13 @@
 #include "sys16.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SYS16_ROTATE_SSE2	1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define SYS16_ROTATE_NEON	1
+#endif
+
 INT32 System16SpriteBanks[16];
 INT32 System16TileBanks[8];
 INT32 System16OldTileBanks[8];
@@ -2985,6 +2993,69 @@ static void HangonRenderRoadLayer(INT32 priority)
 Rotation Layer Rendering
 ====================================================*/
 
+/* Y-Board rotation: each line is gathered into a buffer of source pixels first (a plain
+   copy when the transform is a translation, a single source row when it doesn't rotate),
+   the colour/priority conversion then runs over the whole line, 8 pixels per step */
+
+static void System16RotateConvertLine(const UINT16 *pSrc, const UINT16 *pBack, INT32 nCount, UINT16 *pPixel, UINT8 *pPri)
+{
+	UINT16 nMask = System16PaletteEntries - 1;
+	INT32 x = 0;
+
+#if defined SYS16_ROTATE_SSE2
+	const __m128i vMask = _mm_set1_epi16(nMask);
+	const __m128i vOnes = _mm_set1_epi16(-1);
+
+	for (; x + 8 <= nCount; x += 8)
+	{
+		__m128i pix = _mm_loadu_si128((const __m128i*)(pSrc + x));
+		__m128i col = _mm_and_si128(pix, _mm_set1_epi16(0x1ff));
+		col = _mm_or_si128(col, _mm_and_si128(_mm_srli_epi16(pix, 6), _mm_set1_epi16(0x200)));
+		col = _mm_or_si128(col, _mm_and_si128(_mm_srli_epi16(pix, 3), _mm_set1_epi16(0xc00)));
+		col = _mm_and_si128(_mm_or_si128(col, _mm_set1_epi16(0x1000)), vMask);
+
+		__m128i trans = _mm_cmpeq_epi16(pix, vOnes);
+		__m128i back = _mm_loadu_si128((const __m128i*)(pBack + x));
+		_mm_storeu_si128((__m128i*)(pPixel + x), _mm_or_si128(_mm_and_si128(trans, back), _mm_andnot_si128(trans, col)));
+
+		// (0xffff >> 8) | 1 is the 0xff used for transparent pixels
+		__m128i pri = _mm_or_si128(_mm_srli_epi16(pix, 8), _mm_set1_epi16(1));
+		_mm_storel_epi64((__m128i*)(pPri + x), _mm_packus_epi16(pri, pri));
+	}
+#elif defined SYS16_ROTATE_NEON
+	const uint16x8_t vMask = vdupq_n_u16(nMask);
+
+	for (; x + 8 <= nCount; x += 8)
+	{
+		uint16x8_t pix = vld1q_u16(pSrc + x);
+		uint16x8_t col = vandq_u16(pix, vdupq_n_u16(0x1ff));
+		col = vorrq_u16(col, vandq_u16(vshrq_n_u16(pix, 6), vdupq_n_u16(0x200)));
+		col = vorrq_u16(col, vandq_u16(vshrq_n_u16(pix, 3), vdupq_n_u16(0xc00)));
+		col = vandq_u16(vorrq_u16(col, vdupq_n_u16(0x1000)), vMask);
+
+		uint16x8_t trans = vceqq_u16(pix, vdupq_n_u16(0xffff));
+		vst1q_u16(pPixel + x, vbslq_u16(trans, vld1q_u16(pBack + x), col));
+		vst1_u8(pPri + x, vmovn_u16(vorrq_u16(vshrq_n_u16(pix, 8), vdupq_n_u16(1))));
+	}
+#endif
+
+	for (; x < nCount; x++)
+	{
+		INT32 pix = pSrc[x];
+
+		if (pix != 0xffff)
+		{
+			pPixel[x] = ((pix & 0x1ff) | ((pix >> 6) & 0x200) | ((pix >> 3) & 0xc00) | 0x1000) & nMask;
+			pPri[x] = (pix >> 8) | 1;
+		}
+		else
+		{
+			pPixel[x] = pBack[x];
+			pPri[x] = 0xff;
+		}
+	}
+}
+
 void System16RotateDraw()
 {
 	UINT16 *pRotateBuff = (UINT16*)System16RotateRamBuff;
@@ -2997,6 +3068,9 @@ void System16RotateDraw()
 	INT32 dyx = (BURN_ENDIAN_SWAP_INT16(pRotateBuff[0x3fa]) << 16) | BURN_ENDIAN_SWAP_INT16(pRotateBuff[0x3fb]);
 	INT32 x, y;
 
+	UINT16 LineSrc[320];
+	UINT16 LineBack[320];
+
 	/* advance forward based on the clip rect */
 	currx += dxx * (0 + 27) + dxy * 0;
 	curry += dyx * (0 + 27) + dyy * 0;
@@ -3005,34 +3079,86 @@ void System16RotateDraw()
 	for (y = 0; y <= 223; y++)
 	{
 		UINT16* pPixel = pTransDraw + (y * 320);
-		UINT16* pSrc = pTempDraw;
 		UINT8* pPri = System16PriorityMap + (y * 320);
 		INT32 tx = currx;
 		INT32 ty = curry;
 
-		/* loop over screen X coordinates */
-		for (x = 0; x <= 319; x++)
+		if (dyx == 0)
 		{
-			/* fetch the pixel from the source bitmap */
-			INT32 sx = (tx >> 14) & 0x1ff;
+			/* the line stays on one source row, transparent pixels all get its scanline color */
 			INT32 sy = (ty >> 14) & 0x1ff;
-			INT32 pix = pSrc[sy * 512 + (sx & 0x1ff)];
+			UINT16* pSrc = pTempDraw + sy * 512;
 
-			/* non-zero pixels get written; everything else is the scanline color */
-			if (pix != 0xffff)
+			for (x = 0; x <= 319; x++) LineBack[x] = sy;
+
+			if (dxx == 0x4000)
 			{
-				*pPixel++ = ((pix & 0x1ff) | ((pix >> 6) & 0x200) | ((pix >> 3) & 0xc00) | 0x1000) & (System16PaletteEntries - 1);
-				*pPri++ = (pix >> 8) | 1;
+				/* pure translation: at most two runs of the source row */
+				INT32 sx = (tx >> 14) & 0x1ff;
+				INT32 nRun = 512 - sx;
+				if (nRun > 320) nRun = 320;
+
+				System16RotateConvertLine(pSrc + sx, LineBack, nRun, pPixel, pPri);
+				if (nRun < 320) System16RotateConvertLine(pSrc, LineBack, 320 - nRun, pPixel + nRun, pPri + nRun);
 			}
 			else
 			{
-				*pPixel++ = /*info->colorbase +*/ sy;
-				*pPri++ = 0xff;
+				for (x = 0; x <= 319; x++)
+				{
+					LineSrc[x] = pSrc[(tx >> 14) & 0x1ff];
+					tx += dxx;
+				}
+
+				System16RotateConvertLine(LineSrc, LineBack, 320, pPixel, pPri);
+			}
+		}
+		else
+		{
+			x = 0;
+
+#if defined SYS16_ROTATE_SSE2
+			/* source addresses 4 at a time, the fetches stay scalar */
+			const __m128i vMask = _mm_set1_epi32(0x1ff);
+			__m128i vtx = _mm_setr_epi32(tx, tx + dxx, tx + dxx * 2, tx + dxx * 3);
+			__m128i vty = _mm_setr_epi32(ty, ty + dyx, ty + dyx * 2, ty + dyx * 3);
+			const __m128i vdx = _mm_set1_epi32(dxx * 4);
+			const __m128i vdy = _mm_set1_epi32(dyx * 4);
+
+			for (; x + 4 <= 320; x += 4)
+			{
+				__m128i sx = _mm_and_si128(_mm_srai_epi32(vtx, 14), vMask);
+				__m128i sy = _mm_and_si128(_mm_srai_epi32(vty, 14), vMask);
+				INT32 nOffs[4], nRow[4];
+
+				_mm_storeu_si128((__m128i*)nOffs, _mm_add_epi32(_mm_slli_epi32(sy, 9), sx));
+				_mm_storeu_si128((__m128i*)nRow, sy);
+
+				LineSrc[x + 0] = pTempDraw[nOffs[0]]; LineBack[x + 0] = nRow[0];
+				LineSrc[x + 1] = pTempDraw[nOffs[1]]; LineBack[x + 1] = nRow[1];
+				LineSrc[x + 2] = pTempDraw[nOffs[2]]; LineBack[x + 2] = nRow[2];
+				LineSrc[x + 3] = pTempDraw[nOffs[3]]; LineBack[x + 3] = nRow[3];
+
+				vtx = _mm_add_epi32(vtx, vdx);
+				vty = _mm_add_epi32(vty, vdy);
+			}
+			tx += dxx * x;
+			ty += dyx * x;
+#endif
+
+			for (; x <= 319; x++)
+			{
+				INT32 sx = (tx >> 14) & 0x1ff;
+				INT32 sy = (ty >> 14) & 0x1ff;
+
+				LineSrc[x] = pTempDraw[sy * 512 + sx];
+				LineBack[x] = sy;
+
+				/* advance the source X/Y pointers */
+				tx += dxx;
+				ty += dyx;
 			}
 
-			/* advance the source X/Y pointers */
-			tx += dxx;
-			ty += dyx;
+			System16RotateConvertLine(LineSrc, LineBack, 320, pPixel, pPri);
 		}
 
 		/* advance the source X/Y pointers */
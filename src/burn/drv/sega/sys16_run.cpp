@@ -129,6 +129,8 @@ UINT32 System16BackupRamSize = 0;
 UINT32 System16BackupRam2Size = 0;
 
 bool System16HasGears = false;
+INT32 System16FD1094CacheSize = 8;	// the previous fixed cache, drivers can ask for more (0: all)
+INT32 System16FD1094Background = 0;
 INT32 s16a_update_after_vblank = 0;
 
 UINT8 System16VideoControl;
@@ -1944,8 +1946,8 @@ INT32 System16Init()
 		}
 #endif
 		
-		if (BurnDrvGetHardwareCode() & HARDWARE_SEGA_FD1094_ENC) fd1094_driver_init(0);
-		if (BurnDrvGetHardwareCode() & HARDWARE_SEGA_FD1094_ENC_CPU2) fd1094_driver_init(1);
+		if (BurnDrvGetHardwareCode() & HARDWARE_SEGA_FD1094_ENC) fd1094_driver_init(0, System16FD1094CacheSize, System16FD1094Background);
+		if (BurnDrvGetHardwareCode() & HARDWARE_SEGA_FD1094_ENC_CPU2) fd1094_driver_init(1, System16FD1094CacheSize, System16FD1094Background);
 	}	
 	
 	if (BurnDrvGetHardwareCode() & HARDWARE_SEGA_MC8123_ENC) {
@@ -2814,6 +2816,9 @@ INT32 System16Exit()
  	if ((BurnDrvGetHardwareCode() & HARDWARE_SEGA_FD1094_ENC) || (BurnDrvGetHardwareCode() & HARDWARE_SEGA_FD1094_ENC_CPU2)) {
 		fd1094_exit();
 		
+		System16FD1094CacheSize = 8;
+		System16FD1094Background = 0;
+		
 #ifdef BUILD_A68K
 		// Switch back CPU core if needed
 		if (bUseAsm68KCoreOldValue) {
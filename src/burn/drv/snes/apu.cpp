@@ -24,6 +24,7 @@ static const double apuCyclesPerMaster = (32040 * 32) / (1364 * 262 * 60.0);
 static const double apuCyclesPerMasterPal = (32040 * 32) / (1364 * 312 * 50.0);
 
 static void apu_cycle(Apu* apu);
+static void apu_syncTimers(Apu* apu);
 
 static uint8_t ipl_lfsr(uint32_t posTo, int32_t arrayPos) {
   uint32_t seed = 0xa5; // it's magic! (tm)
@@ -82,9 +83,11 @@ void apu_reset(Apu* apu) {
     apu->timer[i].counter = 0;
     apu->timer[i].enabled = false;
   }
+  apu->timerSync = 0;
 }
 
 void apu_handleState(Apu* apu, StateHandler* sh) {
+  apu_syncTimers(apu);
   sh_handleBools(sh, &apu->romReadable, NULL);
   sh_handleBytes(sh,
     &apu->dspAdr, &apu->inPorts[0], &apu->inPorts[1], &apu->inPorts[2], &apu->inPorts[3], &apu->inPorts[4],
@@ -99,6 +102,7 @@ void apu_handleState(Apu* apu, StateHandler* sh) {
   // components
   spc_handleState(apu->spc, sh);
   dsp_handleState(apu->dsp, sh);
+  apu->timerSync = apu->cycles;
 }
 
 void apu_runCycles(Apu* apu) {
@@ -114,23 +118,45 @@ static void apu_cycle(Apu* apu) {
     dsp_cycle(apu->dsp);
   }
 
-  // handle timers
+  // timers are stepped lazily, see apu_syncTimers()
+  apu->cycles++;
+}
+
+// Bring the timers up to apu->cycles in one step. Per cycle, a timer whose
+// prescaler (cycles) is 0 reloads it with 128 (16 for timer 2) and, when enabled,
+// ticks the divider; the divider wraps at 8 bits and bumps the 4-bit counter
+// when it reaches target (target 0 == 256). Only the SPC reads or writes the
+// timer registers, so syncing before those accesses gives the same values as
+// stepping them every cycle.
+static void apu_syncTimers(Apu* apu) {
+  uint64_t steps = apu->cycles - apu->timerSync;
+  apu->timerSync = apu->cycles;
+  if(steps == 0) return;
+
   for(int i = 0; i < 3; i++) {
-    if(apu->timer[i].cycles == 0) {
-      apu->timer[i].cycles = i == 2 ? 16 : 128;
-      if(apu->timer[i].enabled) {
-        apu->timer[i].divider++;
-        if(apu->timer[i].divider == apu->timer[i].target) {
-          apu->timer[i].divider = 0;
-          apu->timer[i].counter++;
-          apu->timer[i].counter &= 0xf;
-        }
-      }
+    Timer* timer = &apu->timer[i];
+    const uint32_t period = i == 2 ? 16 : 128;
+    uint64_t ticks = 0;
+    if(steps > timer->cycles) {
+      uint64_t past = steps - timer->cycles - 1;
+      ticks = past / period + 1;
+      timer->cycles = period - 1 - (past % period);
+    } else {
+      timer->cycles -= steps;
     }
-    apu->timer[i].cycles--;
-  }
+    if(!timer->enabled || ticks == 0) continue;
 
-  apu->cycles++;
+    uint32_t first = (uint8_t)(timer->target - timer->divider);
+    if(first == 0) first = 256;
+    if(ticks < first) {
+      timer->divider += ticks;
+    } else {
+      const uint32_t wrap = timer->target ? timer->target : 256;
+      ticks -= first;
+      timer->counter = (timer->counter + 1 + ticks / wrap) & 0xf;
+      timer->divider = ticks % wrap;
+    }
+  }
 }
 
 uint8_t apu_read(Apu* apu, uint16_t adr) {
@@ -159,6 +185,7 @@ uint8_t apu_read(Apu* apu, uint16_t adr) {
     case 0xfd:
     case 0xfe:
     case 0xff: {
+      apu_syncTimers(apu);
       uint8_t ret = apu->timer[adr - 0xfd].counter;
       apu->timer[adr - 0xfd].counter = 0;
       return ret;
@@ -176,6 +203,7 @@ void apu_write(Apu* apu, uint16_t adr, uint8_t val) {
       break; // test register
     }
     case 0xf1: {
+      apu_syncTimers(apu);
       for(int i = 0; i < 3; i++) {
         if(!apu->timer[i].enabled && (val & (1 << i))) {
           apu->timer[i].divider = 0;
@@ -217,6 +245,7 @@ void apu_write(Apu* apu, uint16_t adr, uint8_t val) {
     case 0xfa:
     case 0xfb:
     case 0xfc: {
+      apu_syncTimers(apu);
       apu->timer[adr - 0xfa].target = val;
       break;
     }
@@ -32,6 +32,7 @@ struct Apu {
   uint8_t inPorts[6]; // includes 2 bytes of ram
   uint8_t outPorts[4];
   Timer timer[3];
+  uint64_t timerSync; // apu cycle the timers were last brought up to
 };
 
 Apu* apu_init(Snes* snes);
@@ -9,6 +9,14 @@
 #include "apu.h"
 #include "statehandler.h"
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DSP_FIR_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define DSP_FIR_NEON
+#endif
+
 static const int rateValues[32] = {
   0, 2048, 1536, 1280, 1024, 768, 640, 512,
   384, 320, 256, 192, 160, 128, 96, 80,
@@ -65,6 +73,7 @@ static void dsp_handleGain(Dsp* dsp, int ch);
 static void dsp_decodeBrr(Dsp* dsp, int ch);
 static int16_t dsp_getSample(Dsp* dsp, int ch);
 static void dsp_handleNoise(Dsp* dsp);
+static void dsp_updateFirCoef(Dsp* dsp);
 
 Dsp* dsp_init(Apu* apu) {
   Dsp* dsp = (Dsp*)BurnMalloc(sizeof(Dsp));
@@ -131,6 +140,7 @@ void dsp_reset(Dsp* dsp) {
   dsp->echoBufferIndex = 0;
   dsp->firBufferIndex = 0;
   memset(dsp->firValues, 0, sizeof(dsp->firValues));
+  memset(dsp->firCoef, 0, sizeof(dsp->firCoef));
   memset(dsp->firBufferL, 0, sizeof(dsp->firBufferL));
   memset(dsp->firBufferR, 0, sizeof(dsp->firBufferR));
   memset(dsp->sampleBuffer, 0, sizeof(dsp->sampleBuffer));
@@ -201,6 +211,13 @@ void dsp_handleState(Dsp* dsp, StateHandler* sh) {
   sh_handleByteArray(sh, (uint8_t*)&dsp->audioQue, sizeof(dsp->audioQue));
 //  sh_handleByteArray(sh, (UINT8*)&dsp->sampleBuffer[0], 0x800*2*2);
   sh_handleInts(sh, &dsp->sampleCount, NULL);
+  dsp_updateFirCoef(dsp);
+}
+
+static void dsp_updateFirCoef(Dsp* dsp) {
+  for(int i = 0; i < 16; i++) {
+    dsp->firCoef[i] = dsp->firValues[i & 7];
+  }
 }
 
 void dsp_cycle(Dsp* dsp) {
@@ -252,6 +269,40 @@ static void dsp_handleEcho(Dsp* dsp) {
   dsp->firBufferR[dsp->firBufferIndex] = ramSample >> 1;
   // calculate FIR-sum
   int sumL = 0, sumR = 0;
+#if defined(DSP_FIR_SSE2) || defined(DSP_FIR_NEON)
+  // tap i reads buffer slot (index + i + 1) & 7, so slot j is weighted by
+  // firValues[(j + 7 - index) & 7]: a contiguous window of firCoef. The newest
+  // sample (slot == index) is the last tap and is added after the 16-bit clip.
+  const int16_t* coef = &dsp->firCoef[7 - dsp->firBufferIndex];
+  int32_t prodL[8], prodR[8];
+#if defined(DSP_FIR_SSE2)
+  __m128i c = _mm_loadu_si128((const __m128i*)coef);
+  __m128i l = _mm_loadu_si128((const __m128i*)dsp->firBufferL);
+  __m128i r = _mm_loadu_si128((const __m128i*)dsp->firBufferR);
+  __m128i lo = _mm_mullo_epi16(l, c), hi = _mm_mulhi_epi16(l, c);
+  _mm_storeu_si128((__m128i*)&prodL[0], _mm_srai_epi32(_mm_unpacklo_epi16(lo, hi), 6));
+  _mm_storeu_si128((__m128i*)&prodL[4], _mm_srai_epi32(_mm_unpackhi_epi16(lo, hi), 6));
+  lo = _mm_mullo_epi16(r, c); hi = _mm_mulhi_epi16(r, c);
+  _mm_storeu_si128((__m128i*)&prodR[0], _mm_srai_epi32(_mm_unpacklo_epi16(lo, hi), 6));
+  _mm_storeu_si128((__m128i*)&prodR[4], _mm_srai_epi32(_mm_unpackhi_epi16(lo, hi), 6));
+#else
+  int16x8_t c = vld1q_s16(coef);
+  int16x8_t l = vld1q_s16(dsp->firBufferL);
+  int16x8_t r = vld1q_s16(dsp->firBufferR);
+  vst1q_s32(&prodL[0], vshrq_n_s32(vmull_s16(vget_low_s16(l), vget_low_s16(c)), 6));
+  vst1q_s32(&prodL[4], vshrq_n_s32(vmull_s16(vget_high_s16(l), vget_high_s16(c)), 6));
+  vst1q_s32(&prodR[0], vshrq_n_s32(vmull_s16(vget_low_s16(r), vget_low_s16(c)), 6));
+  vst1q_s32(&prodR[4], vshrq_n_s32(vmull_s16(vget_high_s16(r), vget_high_s16(c)), 6));
+#endif
+  for(int i = 0; i < 8; i++) {
+    sumL += prodL[i];
+    sumR += prodR[i];
+  }
+  const int lastL = prodL[dsp->firBufferIndex], lastR = prodR[dsp->firBufferIndex];
+  // clip to 16-bit before last addition
+  sumL = clip16(sumL - lastL) + lastL;
+  sumR = clip16(sumR - lastR) + lastR;
+#else
   for(int i = 0; i < 8; i++) {
     sumL += (dsp->firBufferL[(dsp->firBufferIndex + i + 1) & 0x7] * dsp->firValues[i]) >> 6;
     sumR += (dsp->firBufferR[(dsp->firBufferIndex + i + 1) & 0x7] * dsp->firValues[i]) >> 6;
@@ -261,6 +312,7 @@ static void dsp_handleEcho(Dsp* dsp) {
       sumR = clip16(sumR);
     }
   }
+#endif
   sumL = clamp16(sumL) & ~1;
   sumR = clamp16(sumR) & ~1;
   // apply master volume and modify output with sum
@@ -442,29 +494,41 @@ static void dsp_decodeBrr(Dsp* dsp, int ch) {
   int bOff = dsp->channel[ch].bufferOffset;
   int old = dsp->channel[ch].decodeBuffer[bOff == 0 ? 11 : bOff - 1] >> 1;
   int older = dsp->channel[ch].decodeBuffer[bOff == 0 ? 10 : bOff - 2] >> 1;
-  uint8_t curByte = 0;
+  int16_t* out = &dsp->channel[ch].decodeBuffer[bOff];
+  // unpack and scale the group of 4 nibbles up front, the shift is fixed per block
+  uint16_t adr = dsp->channel[ch].decodeOffset + dsp->channel[ch].blockOffset;
+  uint8_t byte0 = dsp->apu->ram[adr];
+  uint8_t byte1 = dsp->apu->ram[(adr + 1) & 0xffff];
+  int s[4] = { byte0 >> 4, byte0 & 0xf, byte1 >> 4, byte1 & 0xf };
   for(int i = 0; i < 4; i++) {
-    int s = 0;
-    if(i & 1) {
-      s = curByte & 0xf;
-    } else {
-      curByte = dsp->apu->ram[(dsp->channel[ch].decodeOffset + dsp->channel[ch].blockOffset + (i >> 1)) & 0xffff];
-      s = curByte >> 4;
-    }
-    if(s > 7) s -= 16;
-    if(shift <= 0xc) {
-      s = (s << shift) >> 1;
-    } else {
-      s = (s >> 3) << 12;
-    }
-    switch(filter) {
-      case 1: s += old + (-old >> 4); break;
-      case 2: s += 2 * old + ((3 * -old) >> 5) - older + (older >> 4); break;
-      case 3: s += 2 * old + ((13 * -old) >> 6) - older + ((3 * older) >> 4); break;
-    }
-    dsp->channel[ch].decodeBuffer[bOff + i] = clamp16(s) * 2; // cuts off bit 15
-    older = old;
-    old = dsp->channel[ch].decodeBuffer[bOff + i] >> 1;
+    s[i] = (s[i] ^ 8) - 8;
+    s[i] = (shift <= 0xc) ? (s[i] << shift) >> 1 : (s[i] >> 3) << 12;
+  }
+  // the prediction filter is serial, but it only needs choosing once per block
+  switch(filter) {
+    case 0:
+      for(int i = 0; i < 4; i++) out[i] = clamp16(s[i]) * 2; // cuts off bit 15
+      break;
+    case 1:
+      for(int i = 0; i < 4; i++) {
+        out[i] = clamp16(s[i] + old + (-old >> 4)) * 2;
+        old = out[i] >> 1;
+      }
+      break;
+    case 2:
+      for(int i = 0; i < 4; i++) {
+        out[i] = clamp16(s[i] + 2 * old + ((3 * -old) >> 5) - older + (older >> 4)) * 2;
+        older = old;
+        old = out[i] >> 1;
+      }
+      break;
+    case 3:
+      for(int i = 0; i < 4; i++) {
+        out[i] = clamp16(s[i] + 2 * old + ((13 * -old) >> 6) - older + ((3 * older) >> 4)) * 2;
+        older = old;
+        old = out[i] >> 1;
+      }
+      break;
   }
   dsp->channel[ch].bufferOffset += 4;
   if(dsp->channel[ch].bufferOffset >= 12) dsp->channel[ch].bufferOffset = 0;
@@ -598,6 +662,7 @@ void dsp_write(Dsp* dsp, uint8_t adr, uint8_t val) {
     }
     case 0x0f: case 0x1f: case 0x2f: case 0x3f: case 0x4f: case 0x5f: case 0x6f: case 0x7f: {
       dsp->firValues[ch] = val;
+      dsp->firCoef[ch] = dsp->firCoef[ch + 8] = dsp->firValues[ch];
       break;
     }
   }
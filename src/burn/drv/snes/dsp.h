@@ -85,6 +85,7 @@ struct Dsp {
   uint16_t echoBufferIndex;
   uint8_t firBufferIndex;
   int8_t firValues[8];
+  int16_t firCoef[16]; // firValues twice over, so any rotation is one contiguous load
   int16_t firBufferL[8];
   int16_t firBufferR[8];
   // sample ring buffer (4096 samples, *2 for stereo)
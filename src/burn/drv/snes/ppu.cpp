@@ -69,6 +69,16 @@ static uint16_t bg_line_buf[4];
 static uint8_t bg_prio_buf[4];
 static bool bg_window_state[6]; // 0-3 (bg) 4 (spr) 5 (colorwind)
 
+// span renderer: whole-line buffers, filled before the composite pass
+static bool win_line[6][256]; // window state per layer, same layout as bg_window_state
+static uint16_t bg_line_pix[2][4][256]; // [0] main, [1] sub (only differs in hires modes 5 & 6)
+static uint8_t bg_line_prio[2][4][256];
+
+#ifndef PPU_RENDER_MODE
+#define PPU_RENDER_MODE PPU_RENDER_SPAN
+#endif
+static const int renderMode = PPU_RENDER_MODE;
+
 static Snes* snes;
 // vram access
 static uint16_t vram[0x8000];
@@ -178,12 +188,14 @@ bool ppu_evenFrame() {
 }
 
 static inline void ppu_handlePixel(int x, int y);
-static inline int ppu_getPixel(int x, int y, bool sub, int* r, int* g, int* b);
+static inline void ppu_composePixel(int x, int y, bool span);
+static inline int ppu_getPixel(int x, int y, bool sub, bool span, int* r, int* g, int* b);
 static uint16_t ppu_getOffsetValue(int col, int row);
 static inline void ppu_getPixelForBgLayer(int x, int y, int nlayer); //, bool priority, uint16_t *pixelCache, uint8_t *pixelCachePriority);
 static void ppu_handleOPT(int nlayer, int* lx, int* ly);
 static void ppu_calculateMode7Starts(int y);
 static int ppu_getPixelForMode7(int x, int nlayer, bool priority);
+static inline uint8_t ppu_getMode7Pixel(int x);
 static inline bool ppu_getWindowState(int nlayer, int x);
 static void ppu_evaluateSprites(int line);
 static uint16_t ppu_getVramRemap();
@@ -399,6 +411,9 @@ void ppu_latchMode7(int line) {
   if(mode == 7) ppu_calculateMode7Starts(line);
 }
 
+static void ppu_runLinePixel(int line);
+static void ppu_runLineSpan(int line);
+
 void ppu_runLine(int line) {
   // called for lines 1-224/239
   // evaluate sprites
@@ -407,6 +422,30 @@ void ppu_runLine(int line) {
   if (!pBurnDraw) { return;} /// super speeeeeeeeeeeeeeeeeeeeeeeeeeeeed!!!!
   // actual line
   //  if(mode == 7) ppu_calculateMode7Starts(line); // note: latched at hPos == 22!
+  // offset-per-tile modes (2, 4, 6) always use the per-pixel path
+  if(renderMode == PPU_RENDER_PIXEL || mode == 2 || mode == 4 || mode == 6) {
+    ppu_runLinePixel(line);
+    return;
+  }
+  ppu_runLineSpan(line);
+  if(renderMode == PPU_RENDER_VERIFY) {
+    // render the line again with the per-pixel path, that one is kept
+    uint8_t *dest = &pixelBuffer[((line - 1) + (evenFrame ? 0 : 239)) * 2048];
+    static uint8_t spanLine[2048];
+    memcpy(spanLine, dest, sizeof(spanLine));
+    ppu_runLinePixel(line);
+    if(memcmp(spanLine, dest, sizeof(spanLine))) {
+      for(int x = 0; x < 256; x++) {
+        if(memcmp(&spanLine[x * 8], &dest[x * 8], 8)) {
+          bprintf(PRINT_ERROR, _T("ppu: span renderer mismatch at line %d, x %d (mode %d)\n"), line, x, mode);
+          break;
+        }
+      }
+    }
+  }
+}
+
+static void ppu_runLinePixel(int line) {
   layerCache[0] = layerCache[1] = layerCache[2] = layerCache[3] = -1;
 #if 0
   for(int x = 0; x < 256; x++) {
@@ -428,22 +467,27 @@ void ppu_runLine(int line) {
 }
 
 static inline void ppu_handlePixel(int x, int y) {
-  int r = 0, r2 = 0;
-  int g = 0, g2 = 0;
-  int b = 0, b2 = 0;
-  bool bhalfColor = halfColor;
-
   bg_window_state[0] = ppu_getWindowState(0, x);
   bg_window_state[1] = ppu_getWindowState(1, x);
   bg_window_state[2] = ppu_getWindowState(2, x);
   bg_window_state[3] = ppu_getWindowState(3, x);
   bg_window_state[4] = ppu_getWindowState(4, x);
   bg_window_state[5] = ppu_getWindowState(5, x);
- 
+
+  ppu_composePixel(x, y, false);
+}
+
+static inline void ppu_composePixel(int x, int y, bool span) {
+  // span: window states and bg pixels come from the line buffers (ppu_runLineSpan)
+  int r = 0, r2 = 0;
+  int g = 0, g2 = 0;
+  int b = 0, b2 = 0;
+  bool bhalfColor = halfColor;
+
   if(!forcedBlank) {
-    int mainLayer = ppu_getPixel(x, y, false, &r, &g, &b);
+    int mainLayer = ppu_getPixel(x, y, false, span, &r, &g, &b);
 	//    bool colorWindowState = ppu_getWindowState(5, x);
-	bool colorWindowState = bg_window_state[5];
+	bool colorWindowState = span ? win_line[5][x] : bg_window_state[5];
 	bool bClipIfHires = false;
     if(
       clipMode == 3 ||
@@ -464,7 +508,7 @@ static inline void ppu_handlePixel(int x, int y) {
     );
 	bool bHighRes = pseudoHires || mode == 5 || mode == 6;
 	if((bmathEnabled && addSubscreen) || bHighRes) {
-      secondLayer = ppu_getPixel(x, y, true, &r2, &g2, &b2);
+      secondLayer = ppu_getPixel(x, y, true, span, &r2, &g2, &b2);
 	  if (bHighRes && bClipIfHires) { r2 = g2 = b2 = 0; } // jpark hires odd pixels border clipping
 	}
     // TODO: subscreen pixels can be clipped to black as well (done, line above -dink)
@@ -530,7 +574,7 @@ static inline void ppu_handlePixel(int x, int y) {
 			(UINT8)((((r << 3) | (r >> 2)) * bright_lut[brightness]) >> 16) << 16;
 }
 
-static inline int ppu_getPixel(int x, int y, bool sub, int* r, int* g, int* b) {
+static inline int ppu_getPixel(int x, int y, bool sub, bool span, int* r, int* g, int* b) {
   // figure out which color is on this location on main- or subscreen, sets it in r, g, b
   // returns which layer it is: 0-3 for bg layer, 4 or 6 for sprites (depending on palette), 5 for backdrop
   uint32_t actMode = mode == 1 && bg3priority ? 8 : mode;
@@ -542,13 +586,14 @@ static inline int ppu_getPixel(int x, int y, bool sub, int* r, int* g, int* b) {
     uint32_t curLayer = layersPerMode[actMode][i];
     uint32_t curPriority = prioritysPerMode[actMode][i];
     bool layerActive = false;
+    bool windowState = span ? win_line[curLayer][x] : bg_window_state[curLayer];
     if(!sub) {
       layerActive = layer[curLayer].mainScreenEnabled && (
-        !layer[curLayer].mainScreenWindowed || !bg_window_state[curLayer] //!ppu_getWindowState(curLayer, x)
+        !layer[curLayer].mainScreenWindowed || !windowState //!ppu_getWindowState(curLayer, x)
       );
     } else {
       layerActive = layer[curLayer].subScreenEnabled && (
-        !layer[curLayer].subScreenWindowed || !bg_window_state[curLayer] //!ppu_getWindowState(curLayer, x)
+        !layer[curLayer].subScreenWindowed || !windowState //!ppu_getWindowState(curLayer, x)
       );
     }
 	if(layerActive) {
@@ -557,7 +602,16 @@ static inline int ppu_getPixel(int x, int y, bool sub, int* r, int* g, int* b) {
 			bprintf(0, _T("Layer  %x    Prio  %x    i  %x\n"), curLayer, curPriority, i);
 		}
 #endif
-      if(curLayer < 4) {
+      if(curLayer < 4 && span) {
+        // bg layer, decoded by ppu_renderBgLine() / ppu_renderMode7Line()
+        if(mode == 7) {
+          pixel = bg_line_pix[0][curLayer][x];
+          if(curLayer == 1) pixel = (((bool) (pixel & 0x80)) != (bool) curPriority) ? 0 : pixel & 0x7f;
+        } else {
+          int s = sub && (mode == 5 || mode == 6);
+          pixel = (bg_line_prio[s][curLayer][x] == curPriority) ? bg_line_pix[s][curLayer][x] : 0;
+        }
+      } else if(curLayer < 4) {
         // bg layer
         int lx = x;
         int ly = y;
@@ -770,6 +824,15 @@ static void ppu_calculateMode7Starts(int y) {
 }
 
 static int ppu_getPixelForMode7(int x, int nlayer, bool priority) {
+  uint8_t pixel = ppu_getMode7Pixel(x);
+  if(nlayer == 1) {
+    if(((bool) (pixel & 0x80)) != priority) return 0;
+    return pixel & 0x7f;
+  }
+  return pixel;
+}
+
+static inline uint8_t ppu_getMode7Pixel(int x) {
   uint8_t rx = m7xFlip ? 255 - x : x;
   int xPos = (m7startX + m7matrix[0] * rx) >> 8;
   int yPos = (m7startY + m7matrix[2] * rx) >> 8;
@@ -778,12 +841,7 @@ static int ppu_getPixelForMode7(int x, int nlayer, bool priority) {
   yPos &= 0x3ff;
   if(!m7largeField) outsideMap = false;
   uint8_t tile = outsideMap ? 0 : vram[(yPos >> 3) * 128 + (xPos >> 3)] & 0xff;
-  uint8_t pixel = outsideMap && !m7charFill ? 0 : vram[tile * 64 + (yPos & 7) * 8 + (xPos & 7)] >> 8;
-  if(nlayer == 1) {
-    if(((bool) (pixel & 0x80)) != priority) return 0;
-    return pixel & 0x7f;
-  }
-  return pixel;
+  return outsideMap && !m7charFill ? 0 : vram[tile * 64 + (yPos & 7) * 8 + (xPos & 7)] >> 8;
 }
 
 static inline bool ppu_getWindowState(int nlayer, int x) {
@@ -811,6 +869,141 @@ static inline bool ppu_getWindowState(int nlayer, int x) {
   return false;
 }
 
+// span renderer
+// windows are resolved as spans, each bg layer is decoded into a line buffer one tile row
+// (8 pixels) at a time, then ppu_composePixel() does the priority / color math pass.
+
+static void ppu_renderWindowLine(int nlayer) {
+  bool *dest = win_line[nlayer];
+  // the window state can only change at these points
+  int edges[6] = { 0, window1left, window1right + 1, window2left, window2right + 1, 256 };
+  for(int i = 1; i < 5; i++) { // sort 1-4, 0 and 256 are fixed ends
+    for(int j = i; j > 1 && edges[j] < edges[j - 1]; j--) {
+      int t = edges[j]; edges[j] = edges[j - 1]; edges[j - 1] = t;
+    }
+  }
+  for(int i = 0; i < 5; i++) {
+    if(edges[i + 1] > edges[i]) {
+      memset(dest + edges[i], ppu_getWindowState(nlayer, edges[i]), edges[i + 1] - edges[i]);
+    }
+  }
+}
+
+static void ppu_decodeBgTileRow(int x, int y, int nlayer, uint16_t* pixels, uint8_t* prio) {
+  // same fetch as ppu_getPixelForBgLayer(), for the 8 pixels at x & ~7
+  bool wideTiles = bgLayer[nlayer].bigTiles || mode == 5 || mode == 6;
+  int tileBitsX = wideTiles ? 4 : 3;
+  int tileHighBitX = wideTiles ? 0x200 : 0x100;
+  int tileBitsY = bgLayer[nlayer].bigTiles ? 4 : 3;
+  int tileHighBitY = bgLayer[nlayer].bigTiles ? 0x200 : 0x100;
+  uint16_t tilemapAdr = bgLayer[nlayer].tilemapAdr + (((y >> tileBitsY) & 0x1f) << 5 | ((x >> tileBitsX) & 0x1f));
+  if((x & tileHighBitX) && bgLayer[nlayer].tilemapWider) tilemapAdr += 0x400;
+  if((y & tileHighBitY) && bgLayer[nlayer].tilemapHigher) tilemapAdr += bgLayer[nlayer].tilemapWider ? 0x800 : 0x400;
+  uint16_t tile = vram[tilemapAdr & 0x7fff];
+  int paletteNum = (tile & 0x1c00) >> 10;
+  int row = (tile & 0x8000) ? (y & 0x7)^7 : (y & 0x7);
+  int tileNum = tile & 0x3ff;
+  if(wideTiles) {
+    if(((bool) (x & 8)) ^ ((bool) (tile & 0x4000))) tileNum += 1;
+  }
+  if(bgLayer[nlayer].bigTiles) {
+    if(((bool) (y & 8)) ^ ((bool) (tile & 0x8000))) tileNum += 0x10;
+  }
+  const int bitDepth = bitDepthsPerMode[mode][nlayer];
+  if(mode == 0) paletteNum += 8 * nlayer;
+  const uint16_t base_addr = bgLayer[nlayer].tileAdr + ((tileNum & 0x3ff) * 4 * bitDepth);
+  uint16_t planes[4] = { 0, 0, 0, 0 };
+  int planeCount = (bitDepth == 2 || bitDepth == 4 || bitDepth == 8) ? bitDepth >> 1 : 0;
+  for(int p = 0; p < planeCount; p++) {
+    planes[p] = vram[(base_addr + p * 8 + row) & 0x7fff];
+  }
+  for(int i = 0; i < 8; i++) {
+    int col = (tile & 0x4000) ? i : i ^ 7;
+    uint16_t pixel = 0;
+    for(int p = 0; p < planeCount; p++) {
+      pixel |= ((planes[p] >> col) & 1) << (p * 2);
+      pixel |= ((planes[p] >> (8 + col)) & 1) << (p * 2 + 1);
+    }
+    pixels[i] = (pixel == 0) ? 0 : (paletteNum << bitDepth) + pixel;
+  }
+  *prio = (tile >> 13) & 1;
+}
+
+static void ppu_renderBgLine(int y, int nlayer, bool sub) {
+  // lx / ly as in ppu_getPixel(), without offset-per-tile
+  uint16_t *destPix = bg_line_pix[sub][nlayer];
+  uint8_t *destPrio = bg_line_prio[sub][nlayer];
+  bool mosaic = bgLayer[nlayer].mosaicEnabled && mosaicSize > 1;
+  bool hires = mode == 5 || mode == 6;
+  int ly = y;
+  if(mosaic) ly -= (ly - mosaicStartLine) % mosaicSize;
+  if(hires && interlace) {
+    ly *= 2;
+    ly += (evenFrame || bgLayer[nlayer].mosaicEnabled) ? 0 : 1;
+  }
+  ly = (ly + bgLayer[nlayer].vScroll) & 0x3ff;
+
+  uint16_t tilePix[8];
+  uint8_t tilePrio = 0;
+  int tileX = -1;
+  for(int x = 0; x < 256; x++) {
+    int lx = x;
+    if(mosaic) lx -= lx % mosaicSize;
+    lx += bgLayer[nlayer].hScroll;
+    if(hires) {
+      lx *= 2;
+      lx += (sub || bgLayer[nlayer].mosaicEnabled) ? 0 : 1;
+    }
+    lx &= 0x3ff;
+    if((lx >> 3) != tileX) {
+      tileX = lx >> 3;
+      ppu_decodeBgTileRow(lx, ly, nlayer, tilePix, &tilePrio);
+    }
+    destPix[x] = tilePix[lx & 7];
+    destPrio[x] = tilePrio;
+  }
+}
+
+static void ppu_renderMode7Line(int nlayer) {
+  uint16_t *dest = bg_line_pix[0][nlayer];
+  bool mosaic = bgLayer[nlayer].mosaicEnabled && mosaicSize > 1;
+  for(int x = 0; x < 256; x++) {
+    dest[x] = ppu_getMode7Pixel(mosaic ? x - x % mosaicSize : x);
+  }
+}
+
+static void ppu_runLineSpan(int line) {
+  if(!forcedBlank) {
+    uint32_t actMode = mode == 1 && bg3priority ? 8 : mode;
+    actMode = mode == 7 && m7extBg ? 9 : actMode;
+    bool hires = mode == 5 || mode == 6;
+    bool done[4] = { false, false, false, false };
+
+    for(int i = 0; i < 6; i++) {
+      ppu_renderWindowLine(i);
+    }
+    for(int i = 0; i < layerCountPerMode[actMode]; i++) {
+      int curLayer = layersPerMode[actMode][i];
+      if(curLayer >= 4 || done[curLayer]) continue;
+      done[curLayer] = true;
+      bool onMain = layer[curLayer].mainScreenEnabled;
+      bool onSub = layer[curLayer].subScreenEnabled;
+      if(!onMain && !onSub) continue;
+      if(mode == 7) {
+        ppu_renderMode7Line(curLayer);
+      } else if(hires) {
+        if(onMain) ppu_renderBgLine(line, curLayer, false);
+        if(onSub) ppu_renderBgLine(line, curLayer, true);
+      } else {
+        ppu_renderBgLine(line, curLayer, false);
+      }
+    }
+  }
+  for(int x = 0; x < 256; x++) {
+    ppu_composePixel(x, line, true);
+  }
+}
+
 static void ppu_evaluateSprites(int line) {
   // TODO: rectangular sprites
   uint8_t index = objPriority ? (oamAdr & 0xfe) : 0;
@@ -34,6 +34,11 @@ typedef struct WindowLayer {
   uint8_t maskLogic;
 } WindowLayer;
 
+// PPU_RENDER_MODE, build time only (e.g. -DPPU_RENDER_MODE=2 to check the span path)
+#define PPU_RENDER_PIXEL	0	// per-pixel path
+#define PPU_RENDER_SPAN		1	// line buffers + composite pass (default)
+#define PPU_RENDER_VERIFY	2	// span path checked against the per-pixel one, which is kept
+
 void ppu_init(Snes* ssnes);
 void ppu_free();
 void ppu_reset();
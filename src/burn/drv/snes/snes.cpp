@@ -173,35 +173,61 @@ void snes_runFrame(Snes* snes) {
   snes_runFrame_internal(snes);
 }
 
+static inline int snes_quietSteps(Snes* snes, int steps) {
+  // how many of the next (2-cycle) steps are guaranteed to do nothing but advance
+  // cycles / hPos: no pending h/v timer irq, no change of the irq condition and no
+  // horizontal event.  the step landing on an event always runs through snes_runCycle()
+  // carts with a coprocessor (SA-1, GSU, ST018) are caught up every step: the SA-1
+  // checks its h/hv timers against hPos as it runs, so hPos can't jump ahead of it
+  if(snes->cart->heavySync) return 0;
+  if(snes->hvTimer > 0) return 0;
+  const bool condition = (
+    (snes->vIrqEnabled || snes->hIrqEnabled) &&
+    (snes->vPos == snes->vTimer || !snes->vIrqEnabled) &&
+    (snes->hPos == snes->hTimer || !snes->hIrqEnabled)
+  );
+  if(condition != snes->irqCondition) return 0;
+
+  int quiet = ((snes->nextHoriEvent - snes->hPos) >> 1) - 1;
+  if(snes->hIrqEnabled && snes->hTimer >= snes->hPos) {
+    // stop before the step that compares hPos == hTimer
+    const int toTimer = (snes->hTimer - snes->hPos) >> 1;
+    if(toTimer < quiet) quiet = toTimer;
+  }
+  return (quiet < steps) ? quiet : steps;
+}
+
 void snes_runCycles(Snes* snes, int cycles) {
-  for(int i = 0; i < cycles; i += 2) {
-    snes_runCycle(snes);
+  int steps = (cycles + 1) >> 1;
+  while(steps > 0) {
+    const int quiet = snes_quietSteps(snes, steps);
+    if(quiet > 0) {
+      // jump to the next event in one go
+      snes->cycles += quiet * 2;
+      snes->hPos += quiet * 2;
+      steps -= quiet;
+    } else {
+      snes_runCycle(snes);
+      steps--;
+    }
   }
 }
 
 void snes_runCyclesDma(Snes* snes, int cycles) {
-  for(int i = 0; i < cycles; i += 2) {
-    snes_runCycle(snes);
-  }
+  snes_runCycles(snes, cycles);
   snes->syncCycle += cycles;
 }
 
 void snes_runCycles4(Snes* snes) {
-  snes_runCycle(snes);
-  snes_runCycle(snes);
+  snes_runCycles(snes, 4);
 }
 
 void snes_runCycles6(Snes* snes) {
-  snes_runCycle(snes);
-  snes_runCycle(snes);
-  snes_runCycle(snes);
+  snes_runCycles(snes, 6);
 }
 
 void snes_runCycles8(Snes* snes) {
-  snes_runCycle(snes);
-  snes_runCycle(snes);
-  snes_runCycle(snes);
-  snes_runCycle(snes);
+  snes_runCycles(snes, 8);
 }
 
 void snes_syncCycles(Snes* snes, bool start, int syncCycles) {
@@ -271,10 +297,7 @@ static void snes_runCycle(Snes* snes) {
         snes->nextHoriEvent = 1104;
 		// +40cycle dram refresh
 		snes->inRefresh = true;
-		snes_runCycle(snes); snes_runCycle(snes); snes_runCycle(snes); snes_runCycle(snes); snes_runCycle(snes);
-		snes_runCycle(snes); snes_runCycle(snes); snes_runCycle(snes); snes_runCycle(snes); snes_runCycle(snes);
-		snes_runCycle(snes); snes_runCycle(snes); snes_runCycle(snes); snes_runCycle(snes); snes_runCycle(snes);
-		snes_runCycle(snes); snes_runCycle(snes); snes_runCycle(snes); snes_runCycle(snes); snes_runCycle(snes);
+		snes_runCycles(snes, 40);
 		snes->inRefresh = false;
 	  } break;
       case 1104: {
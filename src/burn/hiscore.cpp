@@ -29,15 +29,34 @@ static INT32 WriteCheck1;
 static INT32 LetsTryToApply = 0;
 static INT32 nLoadingFrameDelay = 0;
 
+static INT32 HiscoresSettled = 0; // every range applied & confirmed (or verified), HiscoreApply() has nothing left to do
+
+static INT32 nHiscorePersistSlot = -1;
+
 static cheat_core *cheat_ptr;
 static cpu_core_config *cheat_subptr;
+static INT32 nOpenCpu = -1;
 extern cheat_core *GetCpuCheatRegister(INT32 nCPU);
 
+// ranges are usually all on the same cpu, keep it open until cpu_close()
+static inline void cpu_close()
+{
+	if (nOpenCpu != -1) {
+		cheat_subptr->close();
+		nOpenCpu = -1;
+	}
+}
+
 static inline void cpu_open(INT32 nCpu)
 {
+	if (nOpenCpu == nCpu) return;
+
+	cpu_close();
+
 	cheat_ptr = GetCpuCheatRegister(nCpu);
 	cheat_subptr = cheat_ptr->cpuconfig;
 	cheat_subptr->open(cheat_ptr->nCPU);
+	nOpenCpu = nCpu;
 }
 
 static UINT32 hexstr2num (const char **pString)
@@ -380,6 +399,133 @@ static game_replace_entry replace_table[] = {
 	{ "\0", 			"\0"			}
 };
 
+// hiscore.dat index - offset of the first line starting with "<name>:" for every name in the file.
+// Built on the first lookup and kept for the session (relaunching games, clone -> parent fallback),
+// rebuilt when the size of the file changes or a stored offset no longer points at its name.
+struct hiscore_index_entry {
+	char name[MAX_CONFIG_LINE_SIZE];
+	long offset;
+};
+
+static hiscore_index_entry *HiscoreIndex = NULL;
+static INT32 nHiscoreIndexCount = 0;
+static long nHiscoreIndexFileSize = -1;
+
+static int HiscoreIndexCompare(const void *a, const void *b)
+{
+	const hiscore_index_entry *x = (const hiscore_index_entry*)a;
+	const hiscore_index_entry *y = (const hiscore_index_entry*)b;
+
+	INT32 r = strcmp(x->name, y->name);
+	if (r) return r;
+
+	return (x->offset < y->offset) ? -1 : (x->offset > y->offset);
+}
+
+void HiscoreIndexExit()
+{
+	if (HiscoreIndex) {
+		free(HiscoreIndex);
+		HiscoreIndex = NULL;
+	}
+	nHiscoreIndexCount = 0;
+	nHiscoreIndexFileSize = -1;
+}
+
+static void HiscoreIndexBuild(FILE *fp, long nFileSize)
+{
+	char buffer[MAX_CONFIG_LINE_SIZE];
+	INT32 nAlloc = 0;
+
+	HiscoreIndexExit();
+
+	fseek(fp, 0, SEEK_SET);
+
+	// same line splitting as HiscoreSearch_internal(), so the stored offsets land on the lines it would match
+	for (;;) {
+		long offset = ftell(fp);
+		if (!fgets(buffer, MAX_CONFIG_LINE_SIZE, fp)) break;
+
+		char *colon = strchr(buffer, ':');
+		if (colon == NULL || colon == buffer) continue;
+		if (buffer[0] == '@' || buffer[0] == ';') continue;
+
+		char *sep = strpbrk(buffer, ", \t");
+		if (sep && sep < colon) continue; // never a set name
+
+		if (nHiscoreIndexCount == nAlloc) {
+			nAlloc = nAlloc ? nAlloc * 2 : 1024;
+			hiscore_index_entry *p = (hiscore_index_entry*)realloc(HiscoreIndex, nAlloc * sizeof(hiscore_index_entry));
+			if (p == NULL) {
+				HiscoreIndexExit();
+				return;
+			}
+			HiscoreIndex = p;
+		}
+
+		*colon = '\0';
+		strcpy(HiscoreIndex[nHiscoreIndexCount].name, buffer);
+		HiscoreIndex[nHiscoreIndexCount].offset = offset;
+		nHiscoreIndexCount++;
+	}
+
+	qsort(HiscoreIndex, nHiscoreIndexCount, sizeof(hiscore_index_entry), HiscoreIndexCompare);
+
+	nHiscoreIndexFileSize = nFileSize;
+}
+
+// first entry for name (lowest offset), -1 if the game isn't in the file
+static long HiscoreIndexFind(const char *name)
+{
+	INT32 lo = 0, hi = nHiscoreIndexCount;
+
+	while (lo < hi) {
+		INT32 mid = (lo + hi) / 2;
+		if (strcmp(HiscoreIndex[mid].name, name) < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	if (lo < nHiscoreIndexCount && !strcmp(HiscoreIndex[lo].name, name)) {
+		return HiscoreIndex[lo].offset;
+	}
+
+	return -1;
+}
+
+static void HiscoreIndexSearch(FILE *fp, const char *name)
+{
+	char buffer[MAX_CONFIG_LINE_SIZE];
+
+	fseek(fp, 0, SEEK_END);
+	long nFileSize = ftell(fp);
+
+	for (INT32 nTry = 0; nTry < 2; nTry++) {
+		if (HiscoreIndex == NULL || nHiscoreIndexFileSize != nFileSize || nTry) {
+			HiscoreIndexBuild(fp, nFileSize);
+		}
+
+		if (HiscoreIndex == NULL) { // out of memory, fall back to scanning the file
+			fseek(fp, 0, SEEK_SET);
+			HiscoreSearch_internal(fp, name);
+			return;
+		}
+
+		long offset = HiscoreIndexFind(name);
+		if (offset < 0) return;
+
+		fseek(fp, offset, SEEK_SET);
+		if (fgets(buffer, MAX_CONFIG_LINE_SIZE, fp) && matching_game_name(buffer, name)) {
+			fseek(fp, offset, SEEK_SET);
+			HiscoreSearch_internal(fp, name);
+			return;
+		}
+		// file was edited behind our back, rebuild and try again
+	}
+}
+
 void HiscoreSearch(FILE *fp, const char *name)
 {
 	const char *game = name; // default to passed name
@@ -392,7 +538,36 @@ void HiscoreSearch(FILE *fp, const char *name)
 		}
 	}
 
-	HiscoreSearch_internal(fp, game);
+	HiscoreIndexSearch(fp, game);
+}
+
+static INT32 HiscoreDataLen()
+{
+	INT32 nLen = 0;
+
+	for (UINT32 i = 0; i < nHiscoreNumRanges; i++) {
+		nLen += HiscoreMemRange[i].NumBytes;
+	}
+
+	return nLen;
+}
+
+static INT32 HiscoreCheckWrite(INT32 bVerbose);
+
+// periodic / exit snapshot for burn_persist, the ranges are read back through the cheat cpu-registry
+static INT32 HiscorePersistSnapshot(UINT8 *pDest, INT32 nLen)
+{
+	if (nLen != HiscoreDataLen() || !HiscoreCheckWrite(0)) return 1;
+
+	for (UINT32 i = 0; i < nHiscoreNumRanges; i++) {
+		cpu_open(HiscoreMemRange[i].nCpu);
+		for (UINT32 j = 0; j < HiscoreMemRange[i].NumBytes; j++) {
+			*pDest++ = cheat_subptr->read(HiscoreMemRange[i].Address + j);
+		}
+	}
+	cpu_close();
+
+	return 0;
 }
 
 void HiscoreInit()
@@ -402,6 +577,7 @@ void HiscoreInit()
 	if (!CheckHiscoreAllowed()) return;
 
 	HiscoresInUse = 0;
+	HiscoresSettled = 0;
 
 	TCHAR szDatFilename[MAX_PATH];
 	_stprintf(szDatFilename, _T("%shiscore.dat"), szAppHiscorePath);
@@ -414,7 +590,6 @@ void HiscoreInit()
 		// no hiscore entry for this game in hiscore.dat, and the game is a clone (probably a hack)
 		// let's try using parent entry as a fallback, the success rate seems reasonably good
 		if ((BurnDrvGetFlags() & BDF_CLONE) && BurnDrvGetTextA(DRV_PARENT) && HiscoresInUse == 0) {
-			fseek(fp, 0, SEEK_SET);
 			HiscoreSearch(fp, BurnDrvGetTextA(DRV_PARENT));
 			if (nHiscoreNumRanges) HiscoresInUse = 1;
 		}
@@ -429,21 +604,12 @@ void HiscoreInit()
 	_stprintf(szFilename, _T("%s%s.hi"), szAppEEPROMPath, BurnDrvGetText(DRV_NAME));
 #endif
 
-	fp = _tfopen(szFilename, _T("rb"));
-	INT32 Offset = 0;
-	if (fp) {
-		UINT32 nSize = 0;
-		
-		while (!feof(fp)) {
-			fgetc(fp);
-			nSize++;
-		}
-		
-		UINT8 *Buffer = (UINT8*)BurnMalloc(nSize);
-		fseek(fp, 0, SEEK_SET);
-
-		fread((char *)Buffer, 1, nSize, fp);
+	INT32 nSize = HiscoreDataLen();
+	UINT8 *Buffer = (UINT8*)BurnMalloc(nSize + 1);
+	memset(Buffer, 0, nSize + 1);
 
+	INT32 Offset = 0;
+	if (HiscoresInUse && BurnPersistLoad(szFilename, Buffer, nSize) >= 0) {
 		for (UINT32 i = 0; i < nHiscoreNumRanges; i++) {
 			for (UINT32 j = 0; j < HiscoreMemRange[i].NumBytes; j++) {
 				HiscoreMemRange[i].Data[j] = Buffer[j + Offset];
@@ -456,13 +622,15 @@ void HiscoreInit()
 			bprintf(PRINT_IMPORTANT, _T("Hi Score Memory Range %i Loaded from file\n"), i);
 #endif
 		}
-		
-		BurnFree(Buffer);
-
-		fclose(fp);
 	}
 
+	BurnFree(Buffer);
+
 	WriteCheck1 = 0;
+
+	if (HiscoresInUse) {
+		nHiscorePersistSlot = BurnPersistAdd(szFilename, nSize, HiscorePersistSnapshot);
+	}
 }
 
 void HiscoreReset(INT32 nHiscoreOptions)
@@ -476,6 +644,7 @@ void HiscoreReset(INT32 nHiscoreOptions)
 	WriteCheck1 = 0;
 
 	LetsTryToApply = 0;
+	HiscoresSettled = 0;
 
 	for (UINT32 i = 0; i < nHiscoreNumRanges; i++) {
 		HiscoreMemRange[i].ApplyNextFrame = 0;
@@ -493,16 +662,16 @@ void HiscoreReset(INT32 nHiscoreOptions)
 				cheat_subptr->write(HiscoreMemRange[i].Address, (UINT8)~HiscoreMemRange[i].StartValue);
 				if (HiscoreMemRange[i].NumBytes > 1) cheat_subptr->write(HiscoreMemRange[i].Address + HiscoreMemRange[i].NumBytes - 1, (UINT8)~HiscoreMemRange[i].EndValue);
 			}
-			cheat_subptr->close();
 
 #if 1 && defined FBNEO_DEBUG
 			bprintf(PRINT_IMPORTANT, _T("Hi Score Memory Range %i Initted\n"), i);
 #endif
 		}
 	}
+	cpu_close();
 }
 
-INT32 HiscoreOkToWrite()
+static INT32 HiscoreCheckWrite(INT32 bVerbose)
 { // Check if it is ok to write the hiscore data aka. did we apply it at least?
 	INT32 Ok = 1;
 
@@ -513,7 +682,7 @@ INT32 HiscoreOkToWrite()
 	}
 
 #if 1 && defined FBNEO_DEBUG
-	bprintf(0, _T("Hiscore Write-Check #1 - Applied data: %X\n"), Ok);
+	if (bVerbose) bprintf(0, _T("Hiscore Write-Check #1 - Applied data: %X\n"), Ok);
 #endif
 
 	if (Ok)
@@ -521,12 +690,17 @@ INT32 HiscoreOkToWrite()
 
 	// Check #2 - didn't apply high score, but verified the memory locations
 #if 1 && defined FBNEO_DEBUG
-	bprintf(0, _T("Hiscore Write-Check #2 - Memory verified: %X\n"), WriteCheck1);
+	if (bVerbose) bprintf(0, _T("Hiscore Write-Check #2 - Memory verified: %X\n"), WriteCheck1);
 #endif
 
 	return WriteCheck1;
 }
 
+INT32 HiscoreOkToWrite()
+{
+	return HiscoreCheckWrite(1);
+}
+
 INT32 HiscoreOkToApply(INT32 i)
 {
 	if (!(HiscoreMemRange[i].Loaded && HiscoreMemRange[i].Applied == APPLIED_STATE_NONE && HiscoreMemRange[i].ApplyNextFrame)) {
@@ -555,7 +729,7 @@ void HiscoreApply()
 	if (!Debug_HiscoreInitted) bprintf(PRINT_ERROR, _T("HiscoreApply called without init\n"));
 #endif
 
-	if (!CheckHiscoreAllowed() || !HiscoresInUse || bBurnRunAheadFrame) return;
+	if (!CheckHiscoreAllowed() || !HiscoresInUse || bBurnRunAheadFrame || HiscoresSettled) return;
 
 	UINT8 WriteCheckOk = 0;
 	
@@ -570,7 +744,6 @@ void HiscoreApply()
 					Confirmed = 0;
 				}
 			}
-			cheat_subptr->close();
 			
 			if (Confirmed == 1 || HiscoreMemRange[i].NoConfirm) {
 				HiscoreMemRange[i].Applied = APPLIED_STATE_CONFIRMED;
@@ -592,7 +765,7 @@ void HiscoreApply()
 		bprintf(0, _T("cpu: %x\n"), HiscoreMemRange[i].nCpu);
 		bprintf(0, _T("start: addr %x   %x  %x\n"), HiscoreMemRange[i].Address, cheat_subptr->read(HiscoreMemRange[i].Address), HiscoreMemRange[i].StartValue);
 		bprintf(0, _T(" end : addr %x   %x  %x\n"), HiscoreMemRange[i].Address + HiscoreMemRange[i].NumBytes - 1, cheat_subptr->read(HiscoreMemRange[i].Address + HiscoreMemRange[i].NumBytes - 1), HiscoreMemRange[i].EndValue);
-		cheat_subptr->close();
+		cpu_close();
 #endif
 		if (HiscoreMemRange[i].Loaded && HiscoreMemRange[i].Applied == APPLIED_STATE_NONE) {
 			cpu_open(HiscoreMemRange[i].nCpu);
@@ -602,7 +775,6 @@ void HiscoreApply()
 			} else {
 				HiscoreMemRange[i].ApplyNextFrame = 0;
 			}
-			cheat_subptr->close();
 		}
 
 		if (!HiscoreMemRange[i].Loaded && !WriteCheck1) {
@@ -610,7 +782,6 @@ void HiscoreApply()
 			if (cheat_subptr->read(HiscoreMemRange[i].Address) == HiscoreMemRange[i].StartValue && cheat_subptr->read(HiscoreMemRange[i].Address + HiscoreMemRange[i].NumBytes - 1) == HiscoreMemRange[i].EndValue) {
 				WriteCheckOk++;
 			}
-			cheat_subptr->close();
 		}
 	}
 
@@ -637,12 +808,21 @@ void HiscoreApply()
 			for (UINT32 j = 0; j < HiscoreMemRange[i].NumBytes; j++) {
 				cheat_subptr->write(HiscoreMemRange[i].Address + j, HiscoreMemRange[i].Data[j]);
 			}
-			cheat_subptr->close();
 
 			HiscoreMemRange[i].Applied = APPLIED_STATE_ATTEMPTED;
 			HiscoreMemRange[i].ApplyNextFrame = 0;
 		}
 	}
+	cpu_close();
+
+	// once nothing is pending the loops above are no-ops, skip them until the next reset / state load
+	HiscoresSettled = 1;
+	for (UINT32 i = 0; i < nHiscoreNumRanges; i++) {
+		if (HiscoreMemRange[i].Loaded ? (HiscoreMemRange[i].Applied != APPLIED_STATE_CONFIRMED) : !WriteCheck1) {
+			HiscoresSettled = 0;
+			break;
+		}
+	}
 }
 
 void HiscoreScan(INT32 nAction, INT32* pnMin)
@@ -653,6 +833,8 @@ void HiscoreScan(INT32 nAction, INT32* pnMin)
 	for (UINT32 i = 0; i < nHiscoreNumRanges; i++) {
 		SCAN_VAR(HiscoreMemRange[i]);
 	}
+
+	HiscoresSettled = 0;
 }
 
 void HiscoreExit()
@@ -666,40 +848,18 @@ void HiscoreExit()
 		return;
 	}
 
-	if (HiscoreOkToWrite()) {
-		TCHAR szFilename[MAX_PATH];
-#ifndef __LIBRETRO__
- 		_stprintf(szFilename, _T("%s%s.hi"), szAppHiscorePath, BurnDrvGetText(DRV_NAME));
-#else
-		_stprintf(szFilename, _T("%s%s.hi"), szAppEEPROMPath, BurnDrvGetText(DRV_NAME));
-#endif
-
-		FILE *fp = _tfopen(szFilename, _T("wb"));
-		if (fp) {
-			for (UINT32 i = 0; i < nHiscoreNumRanges; i++) {
-				UINT8 *Buffer = (UINT8*)BurnMalloc(HiscoreMemRange[i].NumBytes + 10);
-				memset(Buffer, 0, HiscoreMemRange[i].NumBytes + 10);
+	INT32 bWrite = HiscoreOkToWrite();
 
-				cpu_open(HiscoreMemRange[i].nCpu);
-				for (UINT32 j = 0; j < HiscoreMemRange[i].NumBytes; j++) {
-					Buffer[j] = cheat_subptr->read(HiscoreMemRange[i].Address + j);
-				}
-				cheat_subptr->close();
-
-				fwrite(Buffer, 1, HiscoreMemRange[i].NumBytes, fp);
-
-				BurnFree(Buffer);
-			}
-			fclose(fp);
-		}
-	} else {
 #if 1 && defined FBNEO_DEBUG
-		bprintf(0, _T("HiscoreExit(): -NOT- ok to write Hiscore data!\n"));
+	if (!bWrite) bprintf(0, _T("HiscoreExit(): -NOT- ok to write Hiscore data!\n"));
 #endif
-	}
+
+	BurnPersistRemove(nHiscorePersistSlot, bWrite);
+	nHiscorePersistSlot = -1;
 
 	nHiscoreNumRanges = 0;
 	WriteCheck1 = 0;
+	HiscoresSettled = 0;
 
 	for (UINT32 i = 0; i < HISCORE_MAX_RANGES; i++) {
 		HiscoreMemRange[i].Loaded = 0;
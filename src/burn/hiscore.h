@@ -16,3 +16,4 @@ void HiscoreReset(INT32 nHiscoreOptions = 0);
 void HiscoreApply();
 void HiscoreScan(INT32 nAction, INT32* pnMin);
 void HiscoreExit();
+void HiscoreIndexExit();
@@ -19,6 +19,9 @@ static INT16* pYM2151Buffer[4];
 
 static INT32 bYM2151AddSignal;
 
+#define YM2151_MIX_LEN	256
+static INT32 nYM2151Mix[YM2151_MIX_LEN * 2]; // routed samples, clamped to pSoundBuf a block at a time
+
 static INT32 nYM2151Position;
 static UINT32 nSampleSize;
 static INT32 nFractionalPosition;
@@ -127,7 +130,9 @@ void BurnYM2151Render(INT16* pSoundBuf, INT32 nSegmentEnd)
 		pYM2151Buffer[3] = pBuffer + 3 * 4096 + 4;
 	}
 
-	for (INT32 i = (nFractionalPosition & 0xFFFF0000) >> 15; i < nSegmentLength; i += 2, nFractionalPosition += nSampleSize) {
+	INT32 nMixStart = (nFractionalPosition & 0xFFFF0000) >> 15;
+
+	for (INT32 i = nMixStart; i < nSegmentLength; i += 2, nFractionalPosition += nSampleSize) {
 		INT32 nLeftSample[2][4] = { {0, 0, 0, 0}, {0, 0, 0, 0} };
 		INT32 nRightSample[2][4] = { {0, 0, 0, 0}, {0, 0, 0, 0} };
 		INT32 nTotalLeftSample[2] = { 0, 0 }, nTotalRightSample[2] = { 0, 0 };
@@ -152,12 +157,16 @@ void BurnYM2151Render(INT16* pSoundBuf, INT32 nSegmentEnd)
 			nTotalRightSample[chip] = BURN_SND_CLIP(nTotalRightSample[chip] * YM2151Volumes[chip][BURN_SND_YM2151_YM2151_ROUTE_2]);
 		}
 
-		if (bYM2151AddSignal) {
-			pSoundBuf[i + 0] = BURN_SND_CLIP(pSoundBuf[i + 0] + nTotalLeftSample[0] + nTotalLeftSample[1]);
-			pSoundBuf[i + 1] = BURN_SND_CLIP(pSoundBuf[i + 1] + nTotalRightSample[0] + nTotalRightSample[1]);
-		} else {
-			pSoundBuf[i + 0] = nTotalLeftSample[0] + nTotalLeftSample[1];
-			pSoundBuf[i + 1] = nTotalRightSample[0] + nTotalRightSample[1];
+		nYM2151Mix[i - nMixStart + 0] = nTotalLeftSample[0] + nTotalLeftSample[1];
+		nYM2151Mix[i - nMixStart + 1] = nTotalRightSample[0] + nTotalRightSample[1];
+
+		if (i - nMixStart == (YM2151_MIX_LEN - 1) * 2 || i + 2 >= nSegmentLength) {
+			if (bYM2151AddSignal) {
+				BurnSoundClampStereo_Add(nYM2151Mix, pSoundBuf + nMixStart, (i - nMixStart) / 2 + 1);
+			} else {
+				BurnSoundClampStereo(nYM2151Mix, pSoundBuf + nMixStart, (i - nMixStart) / 2 + 1);
+			}
+			nMixStart = i + 2;
 		}
 	}
 
@@ -22,6 +22,9 @@ static INT32 nNumChips = 0;
 
 static INT32 bYM2203AddSignal;
 
+#define YM2203_MIX_LEN	256
+static INT32 nYM2203Mix[YM2203_MIX_LEN * 2]; // routed samples, clamped to pSoundBuf a block at a time
+
 static double YM2203Volumes[4 * MAX_YM2203];
 static INT32 YM2203RouteDirs[4 * MAX_YM2203];
 
@@ -182,7 +185,9 @@ static void YM2203UpdateResample(INT16* pSoundBuf, INT32 nSegmentEnd)
 		pYM2203Buffer[11] = pBuffer + 11 * 4096 + 4;
 	}
 
-	for (INT32 i = (nFractionalPosition & 0xFFFF0000) >> 15; i < nSegmentLength; i += 2, nFractionalPosition += nSampleSize) {
+	INT32 nMixStart = (nFractionalPosition & 0xFFFF0000) >> 15;
+
+	for (INT32 i = nMixStart; i < nSegmentLength; i += 2, nFractionalPosition += nSampleSize) {
 		INT32 nLeftSample[4] = {0, 0, 0, 0};
 		INT32 nRightSample[4] = {0, 0, 0, 0};
 		INT32 nTotalLeftSample, nTotalRightSample;
@@ -257,15 +262,16 @@ static void YM2203UpdateResample(INT16* pSoundBuf, INT32 nSegmentEnd)
 		nTotalLeftSample = INTERPOLATE4PS_CUSTOM((nFractionalPosition >> 4) & 0x0fff, nLeftSample[0], nLeftSample[1], nLeftSample[2], nLeftSample[3], 16384.0);
 		nTotalRightSample = INTERPOLATE4PS_CUSTOM((nFractionalPosition >> 4) & 0x0fff, nRightSample[0], nRightSample[1], nRightSample[2], nRightSample[3], 16384.0);
 		
-		nTotalLeftSample = BURN_SND_CLIP(nTotalLeftSample);
-		nTotalRightSample = BURN_SND_CLIP(nTotalRightSample);
-			
-		if (bYM2203AddSignal) {
-			pSoundBuf[i + 0] = BURN_SND_CLIP(pSoundBuf[i + 0] + nTotalLeftSample);
-			pSoundBuf[i + 1] = BURN_SND_CLIP(pSoundBuf[i + 1] + nTotalRightSample);
-		} else {
-			pSoundBuf[i + 0] = nTotalLeftSample;
-			pSoundBuf[i + 1] = nTotalRightSample;
+		nYM2203Mix[i - nMixStart + 0] = nTotalLeftSample;
+		nYM2203Mix[i - nMixStart + 1] = nTotalRightSample;
+
+		if (i - nMixStart == (YM2203_MIX_LEN - 1) * 2 || i + 2 >= nSegmentLength) {
+			if (bYM2203AddSignal) {
+				BurnSoundClampStereo_Add(nYM2203Mix, pSoundBuf + nMixStart, (i - nMixStart) / 2 + 1);
+			} else {
+				BurnSoundClampStereo(nYM2203Mix, pSoundBuf + nMixStart, (i - nMixStart) / 2 + 1);
+			}
+			nMixStart = i + 2;
 		}
 		
 	}
@@ -345,6 +351,8 @@ static void YM2203UpdateNormal(INT16* pSoundBuf, INT32 nSegmentEnd)
 		pYM2203Buffer[11] = pBuffer + 4 + 11 * 4096;
 	}
 
+	INT32 nMixStart = nFractionalPosition;
+
 	for (INT32 n = nFractionalPosition; n < nSegmentLength; n++) {
 		INT32 nLeftSample = 0, nRightSample = 0;
 		
@@ -472,17 +480,16 @@ static void YM2203UpdateNormal(INT16* pSoundBuf, INT32 nSegmentEnd)
 			}
 		}
 		
-		nLeftSample = BURN_SND_CLIP(nLeftSample);
-		nRightSample = BURN_SND_CLIP(nRightSample);
-			
-		if (bYM2203AddSignal) {
-			//pSoundBuf[(n << 1) + 0] += nLeftSample;
-			//pSoundBuf[(n << 1) + 1] += nRightSample;
-			pSoundBuf[(n << 1) + 0] = BURN_SND_CLIP(pSoundBuf[(n << 1) + 0] + nLeftSample);
-			pSoundBuf[(n << 1) + 1] = BURN_SND_CLIP(pSoundBuf[(n << 1) + 1] + nRightSample);
-		} else {
-			pSoundBuf[(n << 1) + 0] = nLeftSample;
-			pSoundBuf[(n << 1) + 1] = nRightSample;
+		nYM2203Mix[((n - nMixStart) << 1) + 0] = nLeftSample;
+		nYM2203Mix[((n - nMixStart) << 1) + 1] = nRightSample;
+
+		if (n - nMixStart == YM2203_MIX_LEN - 1 || n == nSegmentLength - 1) {
+			if (bYM2203AddSignal) {
+				BurnSoundClampStereo_Add(nYM2203Mix, pSoundBuf + (nMixStart << 1), n - nMixStart + 1);
+			} else {
+				BurnSoundClampStereo(nYM2203Mix, pSoundBuf + (nMixStart << 1), n - nMixStart + 1);
+			}
+			nMixStart = n + 1;
 		}
 	}
 
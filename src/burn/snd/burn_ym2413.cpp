@@ -9,6 +9,9 @@ static INT16* pBuffer;
 static INT16* pYM2413Buffer[2];
 
 static INT32 nAddSound;
+
+#define YM2413_MIX_LEN	256
+static INT32 nYM2413Mix[YM2413_MIX_LEN * 2]; // routed samples, clamped to pSoundBuf a block at a time
 static INT32 nBurnPosition;
 static UINT32 nSampleSize;
 static INT32 nFractionalPosition;
@@ -41,6 +44,8 @@ static void YM2413RenderNormal(INT16* pSoundBuf, INT32 nSegmentLength)
 
 	YM2413UpdateOne(0, pYM2413Buffer, nSegmentLength);
 	
+	INT32 nMixStart = 0;
+
 	for (INT32 n = 0; n < nSegmentLength; n++) {
 		INT32 nLeftSample = 0, nRightSample = 0;
 		
@@ -58,15 +63,16 @@ static void YM2413RenderNormal(INT16* pSoundBuf, INT32 nSegmentLength)
 			nRightSample += (INT32)(pYM2413Buffer[1][n] * YM2413Volumes[BURN_SND_YM2413_YM2413_ROUTE_2]);
 		}
 		
-		nLeftSample = BURN_SND_CLIP(nLeftSample);
-		nRightSample = BURN_SND_CLIP(nRightSample);
-
-		if (nAddSound) {
-			pSoundBuf[(n << 1) + 0] = BURN_SND_CLIP(pSoundBuf[(n << 1) + 0] + nLeftSample);
-			pSoundBuf[(n << 1) + 1] = BURN_SND_CLIP(pSoundBuf[(n << 1) + 1] + nRightSample);
-		} else {
-			pSoundBuf[(n << 1) + 0] = nLeftSample;
-			pSoundBuf[(n << 1) + 1] = nRightSample;
+		nYM2413Mix[((n - nMixStart) << 1) + 0] = nLeftSample;
+		nYM2413Mix[((n - nMixStart) << 1) + 1] = nRightSample;
+
+		if (n - nMixStart == YM2413_MIX_LEN - 1 || n == nSegmentLength - 1) {
+			if (nAddSound) {
+				BurnSoundClampStereo_Add(nYM2413Mix, pSoundBuf + (nMixStart << 1), n - nMixStart + 1);
+			} else {
+				BurnSoundClampStereo(nYM2413Mix, pSoundBuf + (nMixStart << 1), n - nMixStart + 1);
+			}
+			nMixStart = n + 1;
 		}
 	}
 }
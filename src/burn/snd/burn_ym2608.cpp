@@ -20,6 +20,9 @@ static INT32 nFractionalPosition;
 
 static INT32 bYM2608AddSignal;
 
+#define YM2608_MIX_LEN	256
+static INT32 nYM2608Mix[YM2608_MIX_LEN * 2]; // routed samples, clamped to pSoundBuf a block at a time
+
 static double YM2608Volumes[3];
 static INT32 YM2608RouteDirs[3];
 
@@ -107,7 +110,9 @@ static void YM2608UpdateResample(INT16* pSoundBuf, INT32 nSegmentEnd)
 		pYM2608Buffer[5][i] = (INT32)((pYM2608Buffer[2][i] + pYM2608Buffer[3][i] + pYM2608Buffer[4][i]) * YM2608Volumes[BURN_SND_YM2608_AY8910_ROUTE]);
 	}
 
-	for (INT32 i = (nFractionalPosition & 0xFFFF0000) >> 15; i < nSegmentLength; i += 2, nFractionalPosition += nSampleSize) {
+	INT32 nMixStart = (nFractionalPosition & 0xFFFF0000) >> 15;
+
+	for (INT32 i = nMixStart; i < nSegmentLength; i += 2, nFractionalPosition += nSampleSize) {
 		INT32 nLeftSample[4] = {0, 0, 0, 0};
 		INT32 nRightSample[4] = {0, 0, 0, 0};
 		INT32 nTotalLeftSample, nTotalRightSample;
@@ -154,15 +159,16 @@ static void YM2608UpdateResample(INT16* pSoundBuf, INT32 nSegmentEnd)
 		nTotalLeftSample = INTERPOLATE4PS_16BIT((nFractionalPosition >> 4) & 0x0fff, nLeftSample[0], nLeftSample[1], nLeftSample[2], nLeftSample[3]);
 		nTotalRightSample = INTERPOLATE4PS_16BIT((nFractionalPosition >> 4) & 0x0fff, nRightSample[0], nRightSample[1], nRightSample[2], nRightSample[3]);
 		
-		nTotalLeftSample = BURN_SND_CLIP(nTotalLeftSample);
-		nTotalRightSample = BURN_SND_CLIP(nTotalRightSample);
-			
-		if (bYM2608AddSignal) {
-			pSoundBuf[i + 0] += nTotalLeftSample;
-			pSoundBuf[i + 1] += nTotalRightSample;
-		} else {
-			pSoundBuf[i + 0] = nTotalLeftSample;
-			pSoundBuf[i + 1] = nTotalRightSample;
+		nYM2608Mix[i - nMixStart + 0] = nTotalLeftSample;
+		nYM2608Mix[i - nMixStart + 1] = nTotalRightSample;
+
+		if (i - nMixStart == (YM2608_MIX_LEN - 1) * 2 || i + 2 >= nSegmentLength) {
+			if (bYM2608AddSignal) {
+				BurnSoundClampStereo_Add(nYM2608Mix, pSoundBuf + nMixStart, (i - nMixStart) / 2 + 1);
+			} else {
+				BurnSoundClampStereo(nYM2608Mix, pSoundBuf + nMixStart, (i - nMixStart) / 2 + 1);
+			}
+			nMixStart = i + 2;
 		}
 	}
 
@@ -216,6 +222,8 @@ static void YM2608UpdateNormal(INT16* pSoundBuf, INT32 nSegmentEnd)
 	pYM2608Buffer[3] = pBuffer + 4 + 3 * 4096;
 	pYM2608Buffer[4] = pBuffer + 4 + 4 * 4096;
 
+	INT32 nMixStart = nFractionalPosition;
+
 	for (INT32 n = nFractionalPosition; n < nSegmentLength; n++) {
 		INT32 nAYSample, nLeftSample = 0, nRightSample = 0;
 
@@ -244,15 +252,16 @@ static void YM2608UpdateNormal(INT16* pSoundBuf, INT32 nSegmentEnd)
 			nRightSample += (INT32)(pYM2608Buffer[1][n] * YM2608Volumes[BURN_SND_YM2608_YM2608_ROUTE_2]);
 		}
 		
-		nLeftSample = BURN_SND_CLIP(nLeftSample);
-		nRightSample = BURN_SND_CLIP(nRightSample);
-			
-		if (bYM2608AddSignal) {
-			pSoundBuf[(n << 1) + 0] += nLeftSample;
-			pSoundBuf[(n << 1) + 1] += nRightSample;
-		} else {
-			pSoundBuf[(n << 1) + 0] = nLeftSample;
-			pSoundBuf[(n << 1) + 1] = nRightSample;
+		nYM2608Mix[((n - nMixStart) << 1) + 0] = nLeftSample;
+		nYM2608Mix[((n - nMixStart) << 1) + 1] = nRightSample;
+
+		if (n - nMixStart == YM2608_MIX_LEN - 1 || n == nSegmentLength - 1) {
+			if (bYM2608AddSignal) {
+				BurnSoundClampStereo_Add(nYM2608Mix, pSoundBuf + (nMixStart << 1), n - nMixStart + 1);
+			} else {
+				BurnSoundClampStereo(nYM2608Mix, pSoundBuf + (nMixStart << 1), n - nMixStart + 1);
+			}
+			nMixStart = n + 1;
 		}
 	}
 
@@ -28,6 +28,9 @@ static double YM2610RightVolumes[3];
 
 INT32 bYM2610UseSeperateVolumes; // support custom Taito panning hardware
 
+#define YM2610_MIX_LEN	256
+static INT32 nYM2610Mix[YM2610_MIX_LEN * 2]; // routed samples, clamped to pSoundBuf a block at a time
+
 // ----------------------------------------------------------------------------
 // Execute YM2610 for part of a frame
 
@@ -112,7 +115,9 @@ static void YM2610UpdateResample(INT16* pSoundBuf, INT32 nSegmentEnd)
 		pYM2610Buffer[5][i] = BURN_SND_CLIP(pYM2610Buffer[2][i] + pYM2610Buffer[3][i] + pYM2610Buffer[4][i]);
 	}
 
-	for (INT32 i = (nFractionalPosition & 0xFFFF0000) >> 15; i < nSegmentLength; i += 2, nFractionalPosition += nSampleSize) {
+	INT32 nMixStart = (nFractionalPosition & 0xFFFF0000) >> 15;
+
+	for (INT32 i = nMixStart; i < nSegmentLength; i += 2, nFractionalPosition += nSampleSize) {
 		INT32 nLeftSample[4] = {0, 0, 0, 0};
 		INT32 nRightSample[4] = {0, 0, 0, 0};
 		INT32 nTotalLeftSample, nTotalRightSample;
@@ -191,17 +196,16 @@ static void YM2610UpdateResample(INT16* pSoundBuf, INT32 nSegmentEnd)
 		nTotalLeftSample = INTERPOLATE4PS_16BIT((nFractionalPosition >> 4) & 0x0fff, nLeftSample[0], nLeftSample[1], nLeftSample[2], nLeftSample[3]);
 		nTotalRightSample = INTERPOLATE4PS_16BIT((nFractionalPosition >> 4) & 0x0fff, nRightSample[0], nRightSample[1], nRightSample[2], nRightSample[3]);
 		
-		nTotalLeftSample = BURN_SND_CLIP(nTotalLeftSample);
-		nTotalRightSample = BURN_SND_CLIP(nTotalRightSample);
-			
-		if (bYM2610AddSignal) {
-//			pSoundBuf[i + 0] += nTotalLeftSample;
-//			pSoundBuf[i + 1] += nTotalRightSample;
-			pSoundBuf[i + 0] = BURN_SND_CLIP(pSoundBuf[i + 0] + nTotalLeftSample);
-			pSoundBuf[i + 1] = BURN_SND_CLIP(pSoundBuf[i + 1] + nTotalRightSample);
-		} else {
-			pSoundBuf[i + 0] = nTotalLeftSample;
-			pSoundBuf[i + 1] = nTotalRightSample;
+		nYM2610Mix[i - nMixStart + 0] = nTotalLeftSample;
+		nYM2610Mix[i - nMixStart + 1] = nTotalRightSample;
+
+		if (i - nMixStart == (YM2610_MIX_LEN - 1) * 2 || i + 2 >= nSegmentLength) {
+			if (bYM2610AddSignal) {
+				BurnSoundClampStereo_Add(nYM2610Mix, pSoundBuf + nMixStart, (i - nMixStart) / 2 + 1);
+			} else {
+				BurnSoundClampStereo(nYM2610Mix, pSoundBuf + nMixStart, (i - nMixStart) / 2 + 1);
+			}
+			nMixStart = i + 2;
 		}
 	}
 	
@@ -255,6 +259,8 @@ static void YM2610UpdateNormal(INT16* pSoundBuf, INT32 nSegmentEnd)
 	pYM2610Buffer[3] = pBuffer + 4 + 3 * 4096;
 	pYM2610Buffer[4] = pBuffer + 4 + 4 * 4096;
 
+	INT32 nMixStart = nFractionalPosition;
+
 	for (INT32 n = nFractionalPosition; n < nSegmentLength; n++) {
 		INT32 nAYSample, nLeftSample = 0, nRightSample = 0;
 
@@ -293,17 +299,16 @@ static void YM2610UpdateNormal(INT16* pSoundBuf, INT32 nSegmentEnd)
 			}
 		}
 		
-		nLeftSample = BURN_SND_CLIP(nLeftSample);
-		nRightSample = BURN_SND_CLIP(nRightSample);
-			
-		if (bYM2610AddSignal) {
-			//pSoundBuf[(n << 1) + 0] += nLeftSample;
-			//pSoundBuf[(n << 1) + 1] += nRightSample;
-			pSoundBuf[(n << 1) + 0] = BURN_SND_CLIP(pSoundBuf[(n << 1) + 0] + nLeftSample);
-			pSoundBuf[(n << 1) + 1] = BURN_SND_CLIP(pSoundBuf[(n << 1) + 1] + nRightSample);
-		} else {
-			pSoundBuf[(n << 1) + 0] = nLeftSample;
-			pSoundBuf[(n << 1) + 1] = nRightSample;
+		nYM2610Mix[((n - nMixStart) << 1) + 0] = nLeftSample;
+		nYM2610Mix[((n - nMixStart) << 1) + 1] = nRightSample;
+
+		if (n - nMixStart == YM2610_MIX_LEN - 1 || n == nSegmentLength - 1) {
+			if (bYM2610AddSignal) {
+				BurnSoundClampStereo_Add(nYM2610Mix, pSoundBuf + (nMixStart << 1), n - nMixStart + 1);
+			} else {
+				BurnSoundClampStereo(nYM2610Mix, pSoundBuf + (nMixStart << 1), n - nMixStart + 1);
+			}
+			nMixStart = n + 1;
 		}
 	}
 
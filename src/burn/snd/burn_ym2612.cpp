@@ -20,6 +20,9 @@ static INT32 nFractionalPosition;
 static INT32 nNumChips = 0;
 static INT32 bYM2612AddSignal;
 
+#define YM2612_MIX_LEN	256
+static INT32 nYM2612Mix[YM2612_MIX_LEN * 2]; // routed samples, clamped to pSoundBuf a block at a time
+
 static double YM2612Volumes[2 * MAX_YM2612];
 static INT32 YM2612RouteDirs[2 * MAX_YM2612];
 
@@ -102,7 +105,9 @@ static void YM2612UpdateResample(INT16* pSoundBuf, INT32 nSegmentEnd)
 		pYM2612Buffer[3] = pBuffer + 3 * 4096 + 4;
 	}
 
-	for (INT32 i = (nFractionalPosition & 0xFFFF0000) >> 15; i < nSegmentLength; i += 2, nFractionalPosition += nSampleSize) {
+	INT32 nMixStart = (nFractionalPosition & 0xFFFF0000) >> 15;
+
+	for (INT32 i = nMixStart; i < nSegmentLength; i += 2, nFractionalPosition += nSampleSize) {
 		INT32 nLeftSample[4] = {0, 0, 0, 0};
 		INT32 nRightSample[4] = {0, 0, 0, 0};
 		INT32 nTotalLeftSample, nTotalRightSample;
@@ -122,15 +127,16 @@ static void YM2612UpdateResample(INT16* pSoundBuf, INT32 nSegmentEnd)
 		nTotalLeftSample = INTERPOLATE4PS_16BIT((nFractionalPosition >> 4) & 0x0fff, nLeftSample[0], nLeftSample[1], nLeftSample[2], nLeftSample[3]);
 		nTotalRightSample = INTERPOLATE4PS_16BIT((nFractionalPosition >> 4) & 0x0fff, nRightSample[0], nRightSample[1], nRightSample[2], nRightSample[3]);
 		
-		nTotalLeftSample = BURN_SND_CLIP(nTotalLeftSample);
-		nTotalRightSample = BURN_SND_CLIP(nTotalRightSample);
-			
-		if (bYM2612AddSignal) {
-			pSoundBuf[i + 0] = BURN_SND_CLIP(pSoundBuf[i + 0] + nTotalLeftSample);
-			pSoundBuf[i + 1] = BURN_SND_CLIP(pSoundBuf[i + 1] + nTotalRightSample);
-		} else {
-			pSoundBuf[i + 0] = nTotalLeftSample;
-			pSoundBuf[i + 1] = nTotalRightSample;
+		nYM2612Mix[i - nMixStart + 0] = nTotalLeftSample;
+		nYM2612Mix[i - nMixStart + 1] = nTotalRightSample;
+
+		if (i - nMixStart == (YM2612_MIX_LEN - 1) * 2 || i + 2 >= nSegmentLength) {
+			if (bYM2612AddSignal) {
+				BurnSoundClampStereo_Add(nYM2612Mix, pSoundBuf + nMixStart, (i - nMixStart) / 2 + 1);
+			} else {
+				BurnSoundClampStereo(nYM2612Mix, pSoundBuf + nMixStart, (i - nMixStart) / 2 + 1);
+			}
+			nMixStart = i + 2;
 		}
 	}
 	
@@ -180,6 +186,8 @@ static void YM2612UpdateNormal(INT16* pSoundBuf, INT32 nSegmentEnd)
 		pYM2612Buffer[3] = pBuffer + 4 + 3 * 4096;
 	}
 
+	INT32 nMixStart = nFractionalPosition;
+
 	for (INT32 n = nFractionalPosition; n < nSegmentLength; n++) {
 		INT32 nLeftSample = 0, nRightSample = 0;
 
@@ -213,15 +221,16 @@ static void YM2612UpdateNormal(INT16* pSoundBuf, INT32 nSegmentEnd)
 			}
 		}
 		
-		nLeftSample = BURN_SND_CLIP(nLeftSample);
-		nRightSample = BURN_SND_CLIP(nRightSample);
-			
-		if (bYM2612AddSignal) {
-			pSoundBuf[(n << 1) + 0] = BURN_SND_CLIP(pSoundBuf[(n << 1) + 0] + nLeftSample);
-			pSoundBuf[(n << 1) + 1] = BURN_SND_CLIP(pSoundBuf[(n << 1) + 1] + nRightSample);
-		} else {
-			pSoundBuf[(n << 1) + 0] = nLeftSample;
-			pSoundBuf[(n << 1) + 1] = nRightSample;
+		nYM2612Mix[((n - nMixStart) << 1) + 0] = nLeftSample;
+		nYM2612Mix[((n - nMixStart) << 1) + 1] = nRightSample;
+
+		if (n - nMixStart == YM2612_MIX_LEN - 1 || n == nSegmentLength - 1) {
+			if (bYM2612AddSignal) {
+				BurnSoundClampStereo_Add(nYM2612Mix, pSoundBuf + (nMixStart << 1), n - nMixStart + 1);
+			} else {
+				BurnSoundClampStereo(nYM2612Mix, pSoundBuf + (nMixStart << 1), n - nMixStart + 1);
+			}
+			nMixStart = n + 1;
 		}
 	}
 
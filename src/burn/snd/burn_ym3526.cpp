@@ -17,6 +17,9 @@ static INT32 nFractionalPosition;
 
 static INT32 bYM3526AddSignal;
 
+#define YM3526_MIX_LEN	256
+static INT32 nYM3526Mix[YM3526_MIX_LEN * 2]; // routed samples, clamped to pSoundBuf a block at a time
+
 static double YM3526Volumes[1];
 static INT32 YM3526RouteDirs[1];
 
@@ -67,7 +70,9 @@ static void YM3526UpdateResample(INT16* pSoundBuf, INT32 nSegmentEnd)
 
 	pYM3526Buffer = pBuffer + 0 * 4096 + 4;
 
-	for (INT32 i = (nFractionalPosition & 0xFFFF0000) >> 15; i < nSegmentLength; i += 2, nFractionalPosition += nSampleSize) {
+	INT32 nMixStart = (nFractionalPosition & 0xFFFF0000) >> 15;
+
+	for (INT32 i = nMixStart; i < nSegmentLength; i += 2, nFractionalPosition += nSampleSize) {
 		INT32 nLeftSample[4] = {0, 0, 0, 0};
 		INT32 nRightSample[4] = {0, 0, 0, 0};
 		INT32 nTotalLeftSample, nTotalRightSample;
@@ -88,15 +93,16 @@ static void YM3526UpdateResample(INT16* pSoundBuf, INT32 nSegmentEnd)
 		nTotalLeftSample = INTERPOLATE4PS_16BIT((nFractionalPosition >> 4) & 0x0fff, nLeftSample[0], nLeftSample[1], nLeftSample[2], nLeftSample[3]);
 		nTotalRightSample = INTERPOLATE4PS_16BIT((nFractionalPosition >> 4) & 0x0fff, nRightSample[0], nRightSample[1], nRightSample[2], nRightSample[3]);
 		
-		nTotalLeftSample = BURN_SND_CLIP(nTotalLeftSample);
-		nTotalRightSample = BURN_SND_CLIP(nTotalRightSample);
-			
-		if (bYM3526AddSignal) {
-			pSoundBuf[i + 0] += nTotalLeftSample;
-			pSoundBuf[i + 1] += nTotalRightSample;
-		} else {
-			pSoundBuf[i + 0] = nTotalLeftSample;
-			pSoundBuf[i + 1] = nTotalRightSample;
+		nYM3526Mix[i - nMixStart + 0] = nTotalLeftSample;
+		nYM3526Mix[i - nMixStart + 1] = nTotalRightSample;
+
+		if (i - nMixStart == (YM3526_MIX_LEN - 1) * 2 || i + 2 >= nSegmentLength) {
+			if (bYM3526AddSignal) {
+				BurnSoundClampStereo_Add(nYM3526Mix, pSoundBuf + nMixStart, (i - nMixStart) / 2 + 1);
+			} else {
+				BurnSoundClampStereo(nYM3526Mix, pSoundBuf + nMixStart, (i - nMixStart) / 2 + 1);
+			}
+			nMixStart = i + 2;
 		}
 	}
 
@@ -135,6 +141,8 @@ static void YM3526UpdateNormal(INT16* pSoundBuf, INT32 nSegmentEnd)
 
 	pYM3526Buffer = pBuffer + 4 + 0 * 4096;
 
+	INT32 nMixStart = nFractionalPosition;
+
 	for (INT32 n = nFractionalPosition; n < nSegmentLength; n++) {
 		INT32 nLeftSample = 0, nRightSample = 0;
 		
@@ -145,15 +153,16 @@ static void YM3526UpdateNormal(INT16* pSoundBuf, INT32 nSegmentEnd)
 			nRightSample += (INT32)(pYM3526Buffer[n] * YM3526Volumes[BURN_SND_YM3526_ROUTE]);
 		}
 		
-		nLeftSample = BURN_SND_CLIP(nLeftSample);
-		nRightSample = BURN_SND_CLIP(nRightSample);
-			
-		if (bYM3526AddSignal) {
-			pSoundBuf[(n << 1) + 0] += nLeftSample;
-			pSoundBuf[(n << 1) + 1] += nRightSample;
-		} else {
-			pSoundBuf[(n << 1) + 0] = nLeftSample;
-			pSoundBuf[(n << 1) + 1] = nRightSample;
+		nYM3526Mix[((n - nMixStart) << 1) + 0] = nLeftSample;
+		nYM3526Mix[((n - nMixStart) << 1) + 1] = nRightSample;
+
+		if (n - nMixStart == YM3526_MIX_LEN - 1 || n == nSegmentLength - 1) {
+			if (bYM3526AddSignal) {
+				BurnSoundClampStereo_Add(nYM3526Mix, pSoundBuf + (nMixStart << 1), n - nMixStart + 1);
+			} else {
+				BurnSoundClampStereo(nYM3526Mix, pSoundBuf + (nMixStart << 1), n - nMixStart + 1);
+			}
+			nMixStart = n + 1;
 		}
 	}
 
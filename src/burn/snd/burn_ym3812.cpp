@@ -20,6 +20,9 @@ static INT32 nFractionalPosition;
 static INT32 nNumChips = 0;
 static INT32 bYM3812AddSignal;
 
+#define YM3812_MIX_LEN	256
+static INT32 nYM3812Mix[YM3812_MIX_LEN * 2]; // routed samples, clamped to pSoundBuf a block at a time
+
 static double YM3812Volumes[1 * MAX_YM3812];
 static INT32 YM3812RouteDirs[1 * MAX_YM3812];
 
@@ -75,7 +78,9 @@ static void YM3812UpdateResample(INT16* pSoundBuf, INT32 nSegmentEnd)
 		pYM3812Buffer[1] = pBuffer + 1 * 4096 + 4;
 	}
 
-	for (INT32 i = (nFractionalPosition & 0xFFFF0000) >> 15; i < nSegmentLength; i += 2, nFractionalPosition += nSampleSize) {
+	INT32 nMixStart = (nFractionalPosition & 0xFFFF0000) >> 15;
+
+	for (INT32 i = nMixStart; i < nSegmentLength; i += 2, nFractionalPosition += nSampleSize) {
 		INT32 nLeftSample[4] = {0, 0, 0, 0};
 		INT32 nRightSample[4] = {0, 0, 0, 0};
 		INT32 nTotalLeftSample, nTotalRightSample;
@@ -111,15 +116,16 @@ static void YM3812UpdateResample(INT16* pSoundBuf, INT32 nSegmentEnd)
 		nTotalLeftSample = INTERPOLATE4PS_16BIT((nFractionalPosition >> 4) & 0x0fff, nLeftSample[0], nLeftSample[1], nLeftSample[2], nLeftSample[3]);
 		nTotalRightSample = INTERPOLATE4PS_16BIT((nFractionalPosition >> 4) & 0x0fff, nRightSample[0], nRightSample[1], nRightSample[2], nRightSample[3]);
 		
-		nTotalLeftSample = BURN_SND_CLIP(nTotalLeftSample);
-		nTotalRightSample = BURN_SND_CLIP(nTotalRightSample);
-			
-		if (bYM3812AddSignal) {
-			pSoundBuf[i + 0] = BURN_SND_CLIP(pSoundBuf[i + 0] + nTotalLeftSample);
-			pSoundBuf[i + 1] = BURN_SND_CLIP(pSoundBuf[i + 1] + nTotalRightSample);
-		} else {
-			pSoundBuf[i + 0] = nTotalLeftSample;
-			pSoundBuf[i + 1] = nTotalRightSample;
+		nYM3812Mix[i - nMixStart + 0] = nTotalLeftSample;
+		nYM3812Mix[i - nMixStart + 1] = nTotalRightSample;
+
+		if (i - nMixStart == (YM3812_MIX_LEN - 1) * 2 || i + 2 >= nSegmentLength) {
+			if (bYM3812AddSignal) {
+				BurnSoundClampStereo_Add(nYM3812Mix, pSoundBuf + nMixStart, (i - nMixStart) / 2 + 1);
+			} else {
+				BurnSoundClampStereo(nYM3812Mix, pSoundBuf + nMixStart, (i - nMixStart) / 2 + 1);
+			}
+			nMixStart = i + 2;
 		}
 	}
 
@@ -160,6 +166,8 @@ static void YM3812UpdateNormal(INT16* pSoundBuf, INT32 nSegmentEnd)
 	pYM3812Buffer[0] = pBuffer + 4 + 0 * 4096;
 	pYM3812Buffer[1] = pBuffer + 4 + 1 * 4096;
 
+	INT32 nMixStart = nFractionalPosition;
+
 	for (INT32 n = nFractionalPosition; n < nSegmentLength; n++) {
 		INT32 nLeftSample = 0, nRightSample = 0;
 		
@@ -179,15 +187,16 @@ static void YM3812UpdateNormal(INT16* pSoundBuf, INT32 nSegmentEnd)
 			}
 		}
 		
-		nLeftSample = BURN_SND_CLIP(nLeftSample);
-		nRightSample = BURN_SND_CLIP(nRightSample);
-			
-		if (bYM3812AddSignal) {
-			pSoundBuf[(n << 1) + 0] = BURN_SND_CLIP(pSoundBuf[(n << 1) + 0] + nLeftSample);
-			pSoundBuf[(n << 1) + 1] = BURN_SND_CLIP(pSoundBuf[(n << 1) + 1] + nRightSample);
-		} else {
-			pSoundBuf[(n << 1) + 0] = nLeftSample;
-			pSoundBuf[(n << 1) + 1] = nRightSample;
+		nYM3812Mix[((n - nMixStart) << 1) + 0] = nLeftSample;
+		nYM3812Mix[((n - nMixStart) << 1) + 1] = nRightSample;
+
+		if (n - nMixStart == YM3812_MIX_LEN - 1 || n == nSegmentLength - 1) {
+			if (bYM3812AddSignal) {
+				BurnSoundClampStereo_Add(nYM3812Mix, pSoundBuf + (nMixStart << 1), n - nMixStart + 1);
+			} else {
+				BurnSoundClampStereo(nYM3812Mix, pSoundBuf + (nMixStart << 1), n - nMixStart + 1);
+			}
+			nMixStart = n + 1;
 		}
 	}
 
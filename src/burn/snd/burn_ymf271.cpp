@@ -8,6 +8,9 @@ static INT16* pYMF271Buffer[4];
 
 static INT32 bYMF271AddSignal;
 
+#define YMF271_MIX_LEN	256
+static INT32 nYMF271Mix[YMF271_MIX_LEN * 2]; // routed samples, clamped to pSoundBuf a block at a time
+
 static UINT32 nSampleSize;
 static INT32 nYMF271Position;
 static INT32 nFractionalPosition;
@@ -105,7 +108,9 @@ void BurnYMF271Update(INT32 nSegmentEnd)
 	pYMF271Buffer[2] = pBuffer + 2 * 4096 + 4;
 	pYMF271Buffer[3] = pBuffer + 3 * 4096 + 4;
 
-	for (INT32 i = (nFractionalPosition & 0xFFFF0000) >> 15; i < nSegmentLength; i += 2, nFractionalPosition += nSampleSize) {
+	INT32 nMixStart = (nFractionalPosition & 0xFFFF0000) >> 15;
+
+	for (INT32 i = nMixStart; i < nSegmentLength; i += 2, nFractionalPosition += nSampleSize) {
 		INT32 nLeftSample[4] = {0, 0, 0, 0};
 		INT32 nRightSample[4] = {0, 0, 0, 0};
 		INT32 nTotalLeftSample, nTotalRightSample;
@@ -122,15 +127,16 @@ void BurnYMF271Update(INT32 nSegmentEnd)
 		nTotalLeftSample  = INTERPOLATE4PS_16BIT((nFractionalPosition >> 4) & 0x0fff, nLeftSample[0], nLeftSample[1], nLeftSample[2], nLeftSample[3]);
 		nTotalRightSample = INTERPOLATE4PS_16BIT((nFractionalPosition >> 4) & 0x0fff, nRightSample[0], nRightSample[1], nRightSample[2], nRightSample[3]);
 
-		nTotalLeftSample  = BURN_SND_CLIP(nTotalLeftSample);
-		nTotalRightSample = BURN_SND_CLIP(nTotalRightSample);
+		nYMF271Mix[i - nMixStart + 0] = nTotalLeftSample;
+		nYMF271Mix[i - nMixStart + 1] = nTotalRightSample;
 
-		if (bYMF271AddSignal) {
-			pSoundBuf[i + 0] = BURN_SND_CLIP(pSoundBuf[i + 0] + nTotalLeftSample);
-			pSoundBuf[i + 1] = BURN_SND_CLIP(pSoundBuf[i + 1] + nTotalRightSample);
-		} else {
-			pSoundBuf[i + 0] = nTotalLeftSample;
-			pSoundBuf[i + 1] = nTotalRightSample;
+		if (i - nMixStart == (YMF271_MIX_LEN - 1) * 2 || i + 2 >= nSegmentLength) {
+			if (bYMF271AddSignal) {
+				BurnSoundClampStereo_Add(nYMF271Mix, pSoundBuf + nMixStart, (i - nMixStart) / 2 + 1);
+			} else {
+				BurnSoundClampStereo(nYMF271Mix, pSoundBuf + nMixStart, (i - nMixStart) / 2 + 1);
+			}
+			nMixStart = i + 2;
 		}
 	}
 
@@ -8,6 +8,9 @@ static INT16* pYMF278BBuffer[2];
 
 static INT32 bYMF278BAddSignal;
 
+#define YMF278B_MIX_LEN	256
+static INT32 nYMF278BMix[YMF278B_MIX_LEN * 2]; // routed samples, clamped to pSoundBuf a block at a time
+
 static UINT32 nSampleSize;
 static INT32 nYMF278BPosition;
 static INT32 nFractionalPosition;
@@ -103,7 +106,9 @@ void BurnYMF278BUpdate(INT32 nSegmentEnd)
 	pYMF278BBuffer[0] = pBuffer + 0 * 4096 + 4;
 	pYMF278BBuffer[1] = pBuffer + 1 * 4096 + 4;
 
-	for (INT32 i = (nFractionalPosition & 0xFFFF0000) >> 15; i < nSegmentLength; i += 2, nFractionalPosition += nSampleSize) {
+	INT32 nMixStart = (nFractionalPosition & 0xFFFF0000) >> 15;
+
+	for (INT32 i = nMixStart; i < nSegmentLength; i += 2, nFractionalPosition += nSampleSize) {
 		INT32 nLeftSample[4] = {0, 0, 0, 0};
 		INT32 nRightSample[4] = {0, 0, 0, 0};
 		INT32 nTotalLeftSample, nTotalRightSample;
@@ -119,12 +124,16 @@ void BurnYMF278BUpdate(INT32 nSegmentEnd)
 		nTotalLeftSample  = BURN_SND_CLIP(nTotalLeftSample * YMF278BVolumes[BURN_SND_YMF278B_YMF278B_ROUTE_1]);
 		nTotalRightSample = BURN_SND_CLIP(nTotalRightSample * YMF278BVolumes[BURN_SND_YMF278B_YMF278B_ROUTE_2]);
 
-		if (bYMF278BAddSignal) {
-			pSoundBuf[i + 0] = BURN_SND_CLIP(pSoundBuf[i + 0] + nTotalLeftSample);
-			pSoundBuf[i + 1] = BURN_SND_CLIP(pSoundBuf[i + 1] + nTotalRightSample);
-		} else {
-			pSoundBuf[i + 0] = nTotalLeftSample;
-			pSoundBuf[i + 1] = nTotalRightSample;
+		nYMF278BMix[i - nMixStart + 0] = nTotalLeftSample;
+		nYMF278BMix[i - nMixStart + 1] = nTotalRightSample;
+
+		if (i - nMixStart == (YMF278B_MIX_LEN - 1) * 2 || i + 2 >= nSegmentLength) {
+			if (bYMF278BAddSignal) {
+				BurnSoundClampStereo_Add(nYMF278BMix, pSoundBuf + nMixStart, (i - nMixStart) / 2 + 1);
+			} else {
+				BurnSoundClampStereo(nYMF278BMix, pSoundBuf + nMixStart, (i - nMixStart) / 2 + 1);
+			}
+			nMixStart = i + 2;
 		}
 	}
 
@@ -48,6 +48,7 @@ Unmapped registers:
 
 #include "burnint.h"
 #include "c140.h"
+#include "pcm_voice.h"
 
 // --- Future NOTE: if asic219 DOES NOT WORK, this is why!! (line below) -dink
 #define BYTE_XOR_BE(x) (x^1)
@@ -238,6 +239,7 @@ void c140_update_INT(INT16 **streams, INT32 samples_len)
 	INT32   frequency,delta,offset,pos;
 	INT32   cnt, voicecnt;
 	INT32   lastdt,prevdt,dltdt;
+	PCMV_BLOCK_BUF blk;
 	float   pbase=(float)m_baserate*2.0 / (float)m_sample_rate;
 
 	INT16   *lmix, *rmix;
@@ -298,104 +300,124 @@ void c140_update_INT(INT16 **streams, INT32 samples_len)
 			{
 				//compressed PCM (maybe correct...)
 				/* Loop for enough to fill sample buffer as requested */
-				for(INT32 j=0;j<(nSamplesNeeded);j++)
+				for(INT32 k=0;k<(nSamplesNeeded);k+=PCMV_BLOCK)
 				{
-					offset += delta;
-					cnt = (offset>>16)&0x7fff;
-					offset &= 0xffff;
-					pos+=cnt;
-					//for(;cnt>0;cnt--)
+					INT32 n=(nSamplesNeeded-k < PCMV_BLOCK) ? (nSamplesNeeded-k) : PCMV_BLOCK;
+					INT32 j;
+
+					for(j=0;j<n;j++)
 					{
-						/* Check for the end of the sample */
-						if(pos >= sz)
+						offset += delta;
+						cnt = (offset>>16)&0x7fff;
+						offset &= 0xffff;
+						pos+=cnt;
+						//for(;cnt>0;cnt--)
 						{
-							/* Check if its a looping sample, either stop or loop */
-							if(v->mode&0x10)
-							{
-								pos = (v->sample_loop - st);
-							}
-							else
+							/* Check for the end of the sample */
+							if(pos >= sz)
 							{
-								v->key=0;
-								break;
+								/* Check if its a looping sample, either stop or loop */
+								if(v->mode&0x10)
+								{
+									pos = (v->sample_loop - st);
+								}
+								else
+								{
+									v->key=0;
+									break;
+								}
 							}
-						}
 
-						/* Read the chosen sample byte */
-						dt=pSampleData[pos];
+							/* Read the chosen sample byte */
+							dt=pSampleData[pos];
+
+							/* decompress to 13bit range */     //2000.06.26 CAB
+							sdt=dt>>3;              //signed
+							if(sdt<0)   sdt = (sdt<<(dt&7)) - m_pcmtbl[dt&7];
+							else        sdt = (sdt<<(dt&7)) + m_pcmtbl[dt&7];
 
-						/* decompress to 13bit range */     //2000.06.26 CAB
-						sdt=dt>>3;              //signed
-						if(sdt<0)   sdt = (sdt<<(dt&7)) - m_pcmtbl[dt&7];
-						else        sdt = (sdt<<(dt&7)) + m_pcmtbl[dt&7];
+							prevdt=lastdt;
+							lastdt=sdt;
+							dltdt=(lastdt - prevdt);
+						}
 
-						prevdt=lastdt;
-						lastdt=sdt;
-						dltdt=(lastdt - prevdt);
+						/* Queue the sample value, interpolated for the whole block below */
+						blk.prev[j]=prevdt;
+						blk.delta[j]=dltdt;
+						blk.frac[j]=offset;
 					}
 
-					/* Caclulate the sample value */
-					dt=((dltdt*offset)>>16)+prevdt;
+					/* Caclulate the sample values and write them to the sample buffers */
+					PCMVoiceLerp(&blk, j);
+					PCMVoiceMix16(blk.out, j, lvol, rvol, 5+5, lmix+k, rmix+k);
 
-					/* Write the data to the sample buffers */
-					*lmix++ +=(dt*lvol)>>(5+5);
-					*rmix++ +=(dt*rvol)>>(5+5);
+					if (j < n) break;
 				}
 			}
 			else
 			{
 				/* linear 8bit signed PCM */
-				for(INT32 j=0;j<(nSamplesNeeded);j++)
+				for(INT32 k=0;k<(nSamplesNeeded);k+=PCMV_BLOCK)
 				{
-					offset += delta;
-					cnt = (offset>>16)&0x7fff;
-					offset &= 0xffff;
-					pos += cnt;
-					/* Check for the end of the sample */
-					if(pos >= sz)
+					INT32 n=(nSamplesNeeded-k < PCMV_BLOCK) ? (nSamplesNeeded-k) : PCMV_BLOCK;
+					INT32 j;
+
+					for(j=0;j<n;j++)
 					{
-						/* Check if its a looping sample, either stop or loop */
-						if( v->mode&0x10 )
+						offset += delta;
+						cnt = (offset>>16)&0x7fff;
+						offset &= 0xffff;
+						pos += cnt;
+						/* Check for the end of the sample */
+						if(pos >= sz)
 						{
-							pos = (v->sample_loop - st);
+							/* Check if its a looping sample, either stop or loop */
+							if( v->mode&0x10 )
+							{
+								pos = (v->sample_loop - st);
+							}
+							else
+							{
+								v->key=0;
+								break;
+							}
 						}
-						else
+
+						if( cnt )
 						{
-							v->key=0;
-							break;
-						}
-					}
+							prevdt=lastdt;
 
-					if( cnt )
-					{
-						prevdt=lastdt;
+							if (m_banking_type == C140_TYPE_ASIC219)
+							{
+								lastdt = pSampleData[BYTE_XOR_BE(pos)];
 
-						if (m_banking_type == C140_TYPE_ASIC219)
-						{
-							lastdt = pSampleData[BYTE_XOR_BE(pos)];
+								// Sign + magnitude format
+								if ((v->mode & 0x01) && (lastdt & 0x80))
+									lastdt = -(lastdt & 0x7f);
 
-							// Sign + magnitude format
-							if ((v->mode & 0x01) && (lastdt & 0x80))
-								lastdt = -(lastdt & 0x7f);
+								// Sign flip
+								if (v->mode & 0x40)
+									lastdt = -lastdt;
+							}
+							else
+							{
+								lastdt=pSampleData[pos];
+							}
 
-							// Sign flip
-							if (v->mode & 0x40)
-								lastdt = -lastdt;
-						}
-						else
-						{
-							lastdt=pSampleData[pos];
+							dltdt = (lastdt - prevdt);
 						}
 
-						dltdt = (lastdt - prevdt);
+						/* Queue the sample value, interpolated for the whole block below */
+						blk.prev[j]=prevdt;
+						blk.delta[j]=dltdt;
+						blk.frac[j]=offset;
 					}
 
-					/* Caclulate the sample value */
-					dt=((dltdt*offset)>>16)+prevdt;
+					/* Caclulate the sample values and write them to the sample buffers */
+					PCMVoiceLerp(&blk, j);
+					PCMVoiceMix16(blk.out, j, lvol, rvol, 5, lmix+k, rmix+k);
 
-					/* Write the data to the sample buffers */
-					*lmix++ +=(dt*lvol)>>5;
-					*rmix++ +=(dt*rvol)>>5;
+					if (j < n) break;
 				}
 			}
 
@@ -118,6 +118,7 @@
 #include "ay8910.h"
 #undef AY8910_CORE
 #include "fm.h"
+#include "fm_simd.h"
 
 #if defined FBNEO_DEBUG
 #ifdef __GNUC__
@@ -1510,6 +1511,30 @@ INLINE void update_phase_lfo_channel(FM_OPN *OPN, FM_CH *CH)
 	}
 }
 
+/* update phase counters AFTER output calculations */
+INLINE void chan_update_phase(FM_OPN *OPN, FM_CH *CH, int chnum)
+{
+	if(CH->pms)
+	{
+		/* add support for 3 slot mode */
+		if ((OPN->ST.mode & 0xC0) && (chnum == 2))
+		{
+		        update_phase_lfo_slot(OPN, &CH->SLOT[SLOT1], CH->pms, OPN->SL3.block_fnum[1]);
+		        update_phase_lfo_slot(OPN, &CH->SLOT[SLOT2], CH->pms, OPN->SL3.block_fnum[2]);
+		        update_phase_lfo_slot(OPN, &CH->SLOT[SLOT3], CH->pms, OPN->SL3.block_fnum[0]);
+		        update_phase_lfo_slot(OPN, &CH->SLOT[SLOT4], CH->pms, CH->block_fnum);
+		}
+		else update_phase_lfo_channel(OPN, CH);
+	}
+	else	/* no LFO phase modulation */
+	{
+		CH->SLOT[SLOT1].phase += CH->SLOT[SLOT1].Incr;
+		CH->SLOT[SLOT2].phase += CH->SLOT[SLOT2].Incr;
+		CH->SLOT[SLOT3].phase += CH->SLOT[SLOT3].Incr;
+		CH->SLOT[SLOT4].phase += CH->SLOT[SLOT4].Incr;
+	}
+}
+
 INLINE void chan_calc(FM_OPN *OPN, FM_CH *CH, int chnum)
 {
 	unsigned int eg_out;
@@ -1562,25 +1587,117 @@ INLINE void chan_calc(FM_OPN *OPN, FM_CH *CH, int chnum)
 	/* store current MEM */
 	CH->mem_value = mem;
 
-	/* update phase counters AFTER output calculations */
-	if(CH->pms)
+	chan_update_phase(OPN, CH, chnum);
+}
+
+/* channel-parallel operator path, see fm_simd.h */
+static int fm_synth = FM_SYNTH_SCALAR;
+
+static const int fm_chnum_6ch[6]  = { 0, 1, 2, 3, 4, 5 };
+static const int fm_chnum_2610[4] = { 1, 2, 4, 5 };
+
+static const FM_SIMD_TABLES fm_simd_tab = {
+	sin_tab, tl_tab, TL_TAB_LEN, ENV_QUIET, SIN_MASK, FREQ_SH, FREQ_SH, 1
+};
+
+static void chan_calc_simd(FM_OPN *OPN, int num, const int *chnum)
+{
+	FM_SIMD_BATCH b;
+	int i, k;
+
+	b.num = num;
+	memset(b.bus, 0, sizeof(b.bus));
+
+	for (i = 0; i < num; i++)
 	{
-		/* add support for 3 slot mode */
-		if ((OPN->ST.mode & 0xC0) && (chnum == 2))
+		FM_CH *CH = cch[i];
+		UINT32 AM = LFO_AM >> CH->ams;
+		INT32 out = CH->op1_out[0] + CH->op1_out[1];
+		INT8 d1;
+
+		b.bus[FMSimdBusIndex(CH->mem_connect, &m2, &c1, &c2, &mem)][i] = CH->mem_value;
+
+		for (k = 0; k < 4; k++)
 		{
-		        update_phase_lfo_slot(OPN, &CH->SLOT[SLOT1], CH->pms, OPN->SL3.block_fnum[1]);
-		        update_phase_lfo_slot(OPN, &CH->SLOT[SLOT2], CH->pms, OPN->SL3.block_fnum[2]);
-		        update_phase_lfo_slot(OPN, &CH->SLOT[SLOT3], CH->pms, OPN->SL3.block_fnum[0]);
-		        update_phase_lfo_slot(OPN, &CH->SLOT[SLOT4], CH->pms, CH->block_fnum);
+			b.phase[k][i] = CH->SLOT[k].phase;
+			b.env[k][i]   = volume_calc(&CH->SLOT[k]);
 		}
-		else update_phase_lfo_channel(OPN, CH);
+
+		CH->op1_out[0] = CH->op1_out[1];
+
+		d1 = FMSimdBusIndex(CH->connect1, &m2, &c1, &c2, &mem);
+		if (d1 == FM_BUS_NONE) {
+			/* algorithm 5 */
+			b.bus[FM_BUS_MEM][i] = b.bus[FM_BUS_C1][i] = b.bus[FM_BUS_C2][i] = CH->op1_out[0];
+		} else {
+			b.bus[d1][i] += CH->op1_out[0];
+		}
+
+		b.pm[i] = CH->FB ? (out << CH->FB) : 0;
+		b.dst[1][i] = FMSimdBusIndex(CH->connect3, &m2, &c1, &c2, &mem);
+		b.dst[2][i] = FMSimdBusIndex(CH->connect2, &m2, &c1, &c2, &mem);
 	}
-	else	/* no LFO phase modulation */
+
+	FMSimdOpCalc(&fm_simd_tab, b.phase[0], b.pm, b.env[0], b.out, num, fm_simd_tab.pm_sh_fb);
+
+	for (i = 0; i < num; i++)
+		cch[i]->op1_out[1] = b.out[i];
+
+	FMSimdRunStages(&fm_simd_tab, &b);
+
+	for (i = 0; i < num; i++)
 	{
-		CH->SLOT[SLOT1].phase += CH->SLOT[SLOT1].Incr;
-		CH->SLOT[SLOT2].phase += CH->SLOT[SLOT2].Incr;
-		CH->SLOT[SLOT3].phase += CH->SLOT[SLOT3].Incr;
-		CH->SLOT[SLOT4].phase += CH->SLOT[SLOT4].Incr;
+		FM_CH *CH = cch[i];
+
+		CH->mem_value = b.bus[FM_BUS_MEM][i];
+		*CH->connect4 += b.bus[FM_BUS_OUT][i];
+
+		chan_update_phase(OPN, CH, chnum[i]);
+	}
+}
+
+/* calculate cch[0 .. num-1], chnum[] gives the real channel number of each */
+static void chan_calc_channels(FM_OPN *OPN, int num, const int *chnum)
+{
+	int i;
+
+	switch (fm_synth)
+	{
+		case FM_SYNTH_SIMD:
+			chan_calc_simd(OPN, num, chnum);
+		break;
+
+		case FM_SYNTH_VERIFY:
+		{
+			FM_CH before[6], after[6];
+			INT32 out_start[8], out_ref[8];
+
+			for (i = 0; i < num; i++) before[i] = *cch[i];
+			memcpy(out_start, out_fm, sizeof(out_fm));
+
+			for (i = 0; i < num; i++) chan_calc(OPN, cch[i], chnum[i]);
+
+			for (i = 0; i < num; i++) { after[i] = *cch[i]; *cch[i] = before[i]; }
+			memcpy(out_ref, out_fm, sizeof(out_fm));
+			memcpy(out_fm, out_start, sizeof(out_fm));
+
+			chan_calc_simd(OPN, num, chnum);
+
+			for (i = 0; i < num; i++)
+			{
+				if (out_fm[chnum[i]] != out_ref[chnum[i]] || memcmp(cch[i], &after[i], sizeof(FM_CH)))
+					FMSimdReportMismatch("OPN", chnum[i], out_ref[chnum[i]], out_fm[chnum[i]]);
+
+				*cch[i] = after[i];		/* keep the scalar result */
+			}
+			memcpy(out_fm, out_ref, sizeof(out_fm));
+		}
+		break;
+
+		default:
+			for (i = 0; i < num; i++)
+				chan_calc(OPN, cch[i], chnum[i]);
+		break;
 	}
 }
 
@@ -1710,6 +1827,8 @@ static int init_tables(void)
 	signed int n;
 	double o,m;
 
+	fm_synth = nFMSynthesis;	/* operator path is selected at chip init */
+
 	for (x=0; x<TL_RES_LEN; x++)
 	{
 		m = (1<<16) / pow(2, (x+1) * (ENV_STEP/4.0) / 8.0);
@@ -2380,9 +2499,7 @@ void YM2203UpdateOne(int num, INT16 *buffer, int length)
 		}
 
 		/* calculate FM */
-		chan_calc(OPN, cch[0], 0 );
-		chan_calc(OPN, cch[1], 1 );
-		chan_calc(OPN, cch[2], 2 );
+		chan_calc_channels(OPN, 3, fm_chnum_6ch);
 
 		/* buffering */
 		{
@@ -3101,12 +3218,7 @@ void YM2608UpdateOne(int num, INT16 **buffer, int length)
 		}
 
 		/* calculate FM */
-		chan_calc(OPN, cch[0], 0 );
-		chan_calc(OPN, cch[1], 1 );
-		chan_calc(OPN, cch[2], 2 );
-		chan_calc(OPN, cch[3], 3 );
-		chan_calc(OPN, cch[4], 4 );
-		chan_calc(OPN, cch[5], 5 );
+		chan_calc_channels(OPN, 6, fm_chnum_6ch);
 
 		/* deltaT ADPCM */
 		if( DELTAT->portstate&0x80 )
@@ -3704,10 +3816,7 @@ void YM2610UpdateOne(int num, INT16 **buffer, int length)
 		}
 
 		/* calculate FM */
-		chan_calc(OPN, cch[0], 1 );	/*remapped to 1*/
-		chan_calc(OPN, cch[1], 2 );	/*remapped to 2*/
-		chan_calc(OPN, cch[2], 4 );	/*remapped to 4*/
-		chan_calc(OPN, cch[3], 5 );	/*remapped to 5*/
+		chan_calc_channels(OPN, 4, fm_chnum_2610);	/* remapped to 1,2,4,5 */
 
 		/* deltaT ADPCM */
 		if( DELTAT->portstate&0x80 )
@@ -3843,12 +3952,7 @@ void YM2610BUpdateOne(int num, INT16 **buffer, int length)
 		}
 
 		/* calculate FM */
-		chan_calc(OPN, cch[0], 0 );
-		chan_calc(OPN, cch[1], 1 );
-		chan_calc(OPN, cch[2], 2 );
-		chan_calc(OPN, cch[3], 3 );
-		chan_calc(OPN, cch[4], 4 );
-		chan_calc(OPN, cch[5], 5 );
+		chan_calc_channels(OPN, 6, fm_chnum_6ch);
 
 		/* deltaT ADPCM */
 		if( DELTAT->portstate&0x80 )
@@ -4402,15 +4506,9 @@ void YM2612UpdateOne(int num, INT16 **buffer, int length)
 		out_fm[5] = 0;
 		
 		/* calculate FM */
-		chan_calc(OPN, cch[0], 0 );
-		chan_calc(OPN, cch[1], 1 );
-		chan_calc(OPN, cch[2], 2 );
-		chan_calc(OPN, cch[3], 3 );
-		chan_calc(OPN, cch[4], 4 );
+		chan_calc_channels(OPN, dacen ? 5 : 6, fm_chnum_6ch);
 		if( dacen )
 			*cch[5]->connect4 += dacout;
-		else
-			chan_calc(OPN, cch[5], 5 );
 
 		/* advance envelope generator */
 		OPN->eg_timer += OPN->eg_timer_add;
@@ -0,0 +1,208 @@
+/*
+**
+** Channel-parallel operator evaluation shared by the OPN (fm.c), OPN2 (ym2612.c)
+** and OPM (ym2151.c) cores.
+**
+** The scalar cores run the four operators of a channel one after the other. The
+** operators of one channel depend on each other through the algorithm routing,
+** but the channels of a chip do not, so this path evaluates one operator stage
+** for every channel at once (SSE2 / NEON lanes, plain C otherwise):
+**
+**   stage 0 : M1 (with feedback)
+**   stage 1 : M2 / SLOT3  modulated by m2
+**   stage 2 : C1 / SLOT2  modulated by c1
+**   stage 3 : C2 / SLOT4  modulated by c2, always summed to the channel output
+**
+** The phase-to-index arithmetic, the envelope/quiet test and the output masking
+** run in vector registers, the sin_tab / tl_tab fetches stay scalar (there is
+** no gather on SSE2/NEON). The result is bit-identical to the scalar path.
+**
+** nFMSynthesis (burn.cpp) selects the path, latched when a chip is initialised:
+**   0 - scalar chan_calc()
+**   1 - channel-parallel path
+**   2 - channel-parallel path checked sample by sample against the scalar one
+**       (the scalar result is kept, debug builds log every mismatch)
+*/
+
+#ifndef _H_FM_SIMD_
+#define _H_FM_SIMD_
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define FM_SIMD_SSE2	1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	#include <arm_neon.h>
+	#define FM_SIMD_NEON	1
+#endif
+
+extern INT32 nFMSynthesis;
+
+#define FM_SYNTH_SCALAR	0
+#define FM_SYNTH_SIMD	1
+#define FM_SYNTH_VERIFY	2
+
+#define FM_SIMD_MAX_CH	8	/* OPM has 8 channels, OPN/OPN2 use 6 */
+
+/* per-channel modulation bus, replaces the m2/c1/c2/mem/carrier globals */
+enum { FM_BUS_M2 = 0, FM_BUS_C1, FM_BUS_C2, FM_BUS_MEM, FM_BUS_OUT, FM_BUS_MAX };
+#define FM_BUS_NONE		(-1)	/* algorithm 5 special mark (M1 feeds m2, c1 and c2) */
+
+typedef struct
+{
+	INT32	num;									/* channels (lanes) in use */
+	INT32	bus[FM_BUS_MAX][FM_SIMD_MAX_CH];		/* modulation inputs, MEM and channel output */
+	UINT32	phase[4][FM_SIMD_MAX_CH];				/* operator phase, in evaluation order */
+	UINT32	env[4][FM_SIMD_MAX_CH];					/* operator attenuation (EG + TL + AM) */
+	INT32	pm[FM_SIMD_MAX_CH];						/* stage 0 phase modulation (feedback) */
+	INT32	out[FM_SIMD_MAX_CH];					/* stage output */
+	INT8	dst[4][FM_SIMD_MAX_CH];					/* FM_BUS_* destination of each stage */
+} FM_SIMD_BATCH;
+
+typedef struct
+{
+	const unsigned int	*sin_tab;
+	const signed int	*tl_tab;
+	UINT32	tl_len;			/* TL_TAB_LEN */
+	UINT32	env_quiet;		/* ENV_QUIET */
+	UINT32	sin_mask;		/* SIN_MASK */
+	INT32	phase_sh;		/* phase -> sin_tab index shift */
+	INT32	pm_sh_fb;		/* feedback (stage 0) modulation shift */
+	INT32	pm_sh;			/* operator (stage 1-3) modulation shift */
+} FM_SIMD_TABLES;
+
+/* map a connect pointer of the scalar core onto the bus */
+INLINE INT8 FMSimdBusIndex(const INT32 *p, const INT32 *m2, const INT32 *c1, const INT32 *c2, const INT32 *mem)
+{
+	if (p == 0)   return FM_BUS_NONE;
+	if (p == m2)  return FM_BUS_M2;
+	if (p == c1)  return FM_BUS_C1;
+	if (p == c2)  return FM_BUS_C2;
+	if (p == mem) return FM_BUS_MEM;
+	return FM_BUS_OUT;	/* carrier */
+}
+
+/*
+  out[i] = (env[i] < env_quiet) ? op(phase[i], env[i], pm[i]) : 0
+  with op() = tl_tab[(env<<3) + sin_tab[((phase >> phase_sh) + (pm >> pm_sh)) & sin_mask]]
+  or 0 when the attenuated index falls outside tl_tab.
+  Only the low bits of the sum survive the mask, so the (pm << 15) / (phase & ~FREQ_MASK)
+  forms used by the scalar cores reduce exactly to this one.
+*/
+INLINE void FMSimdOpCalc(const FM_SIMD_TABLES *t, const UINT32 *phase, const INT32 *pm, const UINT32 *env, INT32 *out, INT32 num, INT32 pm_sh)
+{
+	INT32 i = 0;
+
+#if defined FM_SIMD_SSE2
+	const __m128i bias  = _mm_set1_epi32((int)0x80000000);
+	const __m128i quiet = _mm_set1_epi32((int)(t->env_quiet ^ 0x80000000));
+	const __m128i tllen = _mm_set1_epi32((int)(t->tl_len ^ 0x80000000));
+	const __m128i smask = _mm_set1_epi32((int)t->sin_mask);
+	const __m128i psh   = _mm_cvtsi32_si128(t->phase_sh);
+	const __m128i msh   = _mm_cvtsi32_si128(pm_sh);
+
+	for (; i + 4 <= num; i += 4)
+	{
+		__m128i ph  = _mm_loadu_si128((const __m128i*)(phase + i));
+		__m128i mod = _mm_loadu_si128((const __m128i*)(pm + i));
+		__m128i en  = _mm_loadu_si128((const __m128i*)(env + i));
+		__m128i idx = _mm_and_si128(_mm_add_epi32(_mm_srl_epi32(ph, psh), _mm_srl_epi32(mod, msh)), smask);
+		__m128i p, valid;
+		UINT32 lane[4];
+		INT32 res[4];
+
+		_mm_storeu_si128((__m128i*)lane, idx);
+		p = _mm_add_epi32(_mm_slli_epi32(en, 3), _mm_setr_epi32(t->sin_tab[lane[0]], t->sin_tab[lane[1]], t->sin_tab[lane[2]], t->sin_tab[lane[3]]));
+
+		/* unsigned compares through the sign bias */
+		valid = _mm_and_si128(_mm_cmplt_epi32(_mm_xor_si128(en, bias), quiet), _mm_cmplt_epi32(_mm_xor_si128(p, bias), tllen));
+
+		_mm_storeu_si128((__m128i*)lane, _mm_and_si128(p, valid));
+		res[0] = t->tl_tab[lane[0]];
+		res[1] = t->tl_tab[lane[1]];
+		res[2] = t->tl_tab[lane[2]];
+		res[3] = t->tl_tab[lane[3]];
+		_mm_storeu_si128((__m128i*)(out + i), _mm_and_si128(_mm_loadu_si128((const __m128i*)res), valid));
+	}
+#elif defined FM_SIMD_NEON
+	const uint32x4_t quiet = vdupq_n_u32(t->env_quiet);
+	const uint32x4_t tllen = vdupq_n_u32(t->tl_len);
+	const uint32x4_t smask = vdupq_n_u32(t->sin_mask);
+	const int32x4_t  psh   = vdupq_n_s32(-t->phase_sh);
+	const int32x4_t  msh   = vdupq_n_s32(-pm_sh);
+
+	for (; i + 4 <= num; i += 4)
+	{
+		uint32x4_t ph  = vld1q_u32(phase + i);
+		uint32x4_t mod = vreinterpretq_u32_s32(vld1q_s32(pm + i));
+		uint32x4_t en  = vld1q_u32(env + i);
+		uint32x4_t idx = vandq_u32(vaddq_u32(vshlq_u32(ph, psh), vshlq_u32(mod, msh)), smask);
+		uint32x4_t p, valid;
+		UINT32 lane[4];
+		INT32 res[4];
+
+		vst1q_u32(lane, idx);
+		lane[0] = t->sin_tab[lane[0]];
+		lane[1] = t->sin_tab[lane[1]];
+		lane[2] = t->sin_tab[lane[2]];
+		lane[3] = t->sin_tab[lane[3]];
+		p = vaddq_u32(vshlq_n_u32(en, 3), vld1q_u32(lane));
+
+		valid = vandq_u32(vcltq_u32(en, quiet), vcltq_u32(p, tllen));
+
+		vst1q_u32(lane, vandq_u32(p, valid));
+		res[0] = t->tl_tab[lane[0]];
+		res[1] = t->tl_tab[lane[1]];
+		res[2] = t->tl_tab[lane[2]];
+		res[3] = t->tl_tab[lane[3]];
+		vst1q_s32(out + i, vandq_s32(vld1q_s32(res), vreinterpretq_s32_u32(valid)));
+	}
+#endif
+
+	for (; i < num; i++)
+	{
+		UINT32 p;
+
+		out[i] = 0;
+		if (env[i] >= t->env_quiet)
+			continue;
+
+		p = (env[i] << 3) + t->sin_tab[((phase[i] >> t->phase_sh) + ((UINT32)pm[i] >> pm_sh)) & t->sin_mask];
+		if (p < t->tl_len)
+			out[i] = t->tl_tab[p];
+	}
+}
+
+/* stages 1-3: every core routes M2 / C1 / C2 identically once M1 has been placed on the bus */
+INLINE void FMSimdRunStages(const FM_SIMD_TABLES *t, FM_SIMD_BATCH *b)
+{
+	static const INT32 src[4] = { 0, FM_BUS_M2, FM_BUS_C1, FM_BUS_C2 };
+	INT32 s, i;
+
+	for (s = 1; s < 4; s++)
+	{
+		FMSimdOpCalc(t, b->phase[s], b->bus[src[s]], b->env[s], b->out, b->num, t->pm_sh);
+
+		if (s == 3)
+		{
+			for (i = 0; i < b->num; i++)
+				b->bus[FM_BUS_OUT][i] += b->out[i];
+		}
+		else
+		{
+			for (i = 0; i < b->num; i++)
+				b->bus[b->dst[s][i]][i] += b->out[i];
+		}
+	}
+}
+
+/* verification harness reporting (mode FM_SYNTH_VERIFY) */
+#if defined FBNEO_DEBUG && defined __GNUC__
+	#include <tchar.h>
+	extern INT32 (__cdecl *bprintf) (INT32 nStatus, TCHAR* szFormat, ...);
+	#define FMSimdReportMismatch(chip, ch, scalar, simd) \
+		bprintf(3, _T("%s: SIMD FM mismatch on channel %d (scalar %d, simd %d)\n"), _T(chip), (int)(ch), (int)(scalar), (int)(simd))
+#else
+	#define FMSimdReportMismatch(chip, ch, scalar, simd)
+#endif
+
+#endif /* _H_FM_SIMD_ */
@@ -0,0 +1,154 @@
+/*
+**
+** Block voice mixing shared by the wavetable PCM cores (segapcm.cpp, c140.cpp).
+**
+** Every chip keeps its own address stepping, loop / key-off and sample decode
+** rules - they differ in exactly the details that decide bit-exact output - but
+** once a voice's raw samples are known the rest of the per-sample work is the
+** same everywhere. The chip loop therefore only walks the sample data and fills
+** a block of up to PCMV_BLOCK entries, and the arithmetic on that block runs in
+** vector registers (SSE2 / NEON lanes, plain C otherwise):
+**
+**   PCMVoiceLerp()   s = prev + ((delta * frac) >> 16)          (16.16 stepping)
+**   PCMVoiceMix32()  L += s * lvol, R += s * rvol                (INT32 mix bus)
+**   PCMVoiceMix16()  L += (s * lvol) >> shift, R likewise        (INT16 mix bus,
+**                    wrapping like the "INT16 += INT32" of the scalar loops)
+**
+** All of it is integer arithmetic with the rounding of the scalar loops, the
+** output is bit-identical to them. Limits: samples, deltas and the final
+** interpolated value fit in 16 bits, volumes are 0 - 0x7fff.
+*/
+
+#ifndef _H_PCM_VOICE_
+#define _H_PCM_VOICE_
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define PCMV_SSE2	1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	#include <arm_neon.h>
+	#define PCMV_NEON	1
+#endif
+
+#define PCMV_BLOCK	64
+
+typedef struct
+{
+	INT16	prev[PCMV_BLOCK];	/* sample before the current position */
+	INT16	delta[PCMV_BLOCK];	/* next sample - prev */
+	UINT16	frac[PCMV_BLOCK];	/* position fraction, 0 - 0xffff */
+	INT16	out[PCMV_BLOCK];	/* interpolated / raw samples handed to the mixers */
+} PCMV_BLOCK_BUF;
+
+INLINE void PCMVoiceLerp(PCMV_BLOCK_BUF *b, INT32 n)
+{
+	INT32 i = 0;
+
+#if defined(PCMV_SSE2)
+	for (; i + 8 <= n; i += 8) {
+		__m128i p = _mm_loadu_si128((const __m128i*)(b->prev + i));
+		__m128i d = _mm_loadu_si128((const __m128i*)(b->delta + i));
+		__m128i f = _mm_loadu_si128((const __m128i*)(b->frac + i));
+		// mulhi treats frac as signed, add delta back where its top bit is set
+		__m128i h = _mm_mulhi_epi16(d, f);
+		h = _mm_add_epi16(h, _mm_and_si128(d, _mm_srai_epi16(f, 15)));
+		_mm_storeu_si128((__m128i*)(b->out + i), _mm_add_epi16(h, p));
+	}
+#elif defined(PCMV_NEON)
+	for (; i + 8 <= n; i += 8) {
+		int16x8_t p = vld1q_s16(b->prev + i);
+		int16x8_t d = vld1q_s16(b->delta + i);
+		uint16x8_t f = vld1q_u16(b->frac + i);
+		int32x4_t lo = vmulq_s32(vmovl_s16(vget_low_s16(d)), vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(f))));
+		int32x4_t hi = vmulq_s32(vmovl_s16(vget_high_s16(d)), vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(f))));
+		int16x8_t h = vcombine_s16(vmovn_s32(vshrq_n_s32(lo, 16)), vmovn_s32(vshrq_n_s32(hi, 16)));
+		vst1q_s16(b->out + i, vaddq_s16(h, p));
+	}
+#endif
+
+	for (; i < n; i++) {
+		b->out[i] = (INT16)(((b->delta[i] * (INT32)b->frac[i]) >> 16) + b->prev[i]);
+	}
+}
+
+INLINE void PCMVoiceMix32(const INT16 *src, INT32 n, INT32 lvol, INT32 rvol, INT32 *l, INT32 *r)
+{
+	INT32 i = 0;
+
+#if defined(PCMV_SSE2)
+	__m128i vl = _mm_set1_epi16((INT16)lvol);
+	__m128i vr = _mm_set1_epi16((INT16)rvol);
+
+	for (; i + 8 <= n; i += 8) {
+		__m128i s = _mm_loadu_si128((const __m128i*)(src + i));
+		__m128i pl = _mm_mullo_epi16(s, vl), ph = _mm_mulhi_epi16(s, vl);
+		_mm_storeu_si128((__m128i*)(l + i + 0), _mm_add_epi32(_mm_loadu_si128((const __m128i*)(l + i + 0)), _mm_unpacklo_epi16(pl, ph)));
+		_mm_storeu_si128((__m128i*)(l + i + 4), _mm_add_epi32(_mm_loadu_si128((const __m128i*)(l + i + 4)), _mm_unpackhi_epi16(pl, ph)));
+		pl = _mm_mullo_epi16(s, vr); ph = _mm_mulhi_epi16(s, vr);
+		_mm_storeu_si128((__m128i*)(r + i + 0), _mm_add_epi32(_mm_loadu_si128((const __m128i*)(r + i + 0)), _mm_unpacklo_epi16(pl, ph)));
+		_mm_storeu_si128((__m128i*)(r + i + 4), _mm_add_epi32(_mm_loadu_si128((const __m128i*)(r + i + 4)), _mm_unpackhi_epi16(pl, ph)));
+	}
+#elif defined(PCMV_NEON)
+	int16x4_t vl = vdup_n_s16((INT16)lvol);
+	int16x4_t vr = vdup_n_s16((INT16)rvol);
+
+	for (; i + 8 <= n; i += 8) {
+		int16x8_t s = vld1q_s16(src + i);
+		vst1q_s32(l + i + 0, vmlal_s16(vld1q_s32(l + i + 0), vget_low_s16(s), vl));
+		vst1q_s32(l + i + 4, vmlal_s16(vld1q_s32(l + i + 4), vget_high_s16(s), vl));
+		vst1q_s32(r + i + 0, vmlal_s16(vld1q_s32(r + i + 0), vget_low_s16(s), vr));
+		vst1q_s32(r + i + 4, vmlal_s16(vld1q_s32(r + i + 4), vget_high_s16(s), vr));
+	}
+#endif
+
+	for (; i < n; i++) {
+		l[i] += src[i] * lvol;
+		r[i] += src[i] * rvol;
+	}
+}
+
+INLINE void PCMVoiceMix16(const INT16 *src, INT32 n, INT32 lvol, INT32 rvol, INT32 shift, INT16 *l, INT16 *r)
+{
+	INT32 i = 0;
+
+#if defined(PCMV_SSE2)
+	__m128i vl = _mm_set1_epi16((INT16)lvol);
+	__m128i vr = _mm_set1_epi16((INT16)rvol);
+	__m128i sh = _mm_cvtsi32_si128(shift);
+
+	for (; i + 8 <= n; i += 8) {
+		__m128i s = _mm_loadu_si128((const __m128i*)(src + i));
+		__m128i v[2] = { vl, vr };
+		INT16 *d[2] = { l + i, r + i };
+
+		for (INT32 c = 0; c < 2; c++) {
+			__m128i pl = _mm_mullo_epi16(s, v[c]), ph = _mm_mulhi_epi16(s, v[c]);
+			__m128i a = _mm_sra_epi32(_mm_unpacklo_epi16(pl, ph), sh);
+			__m128i b = _mm_sra_epi32(_mm_unpackhi_epi16(pl, ph), sh);
+			// keep the low 16 bits (sign extended so the saturating pack is a plain narrow)
+			a = _mm_srai_epi32(_mm_slli_epi32(a, 16), 16);
+			b = _mm_srai_epi32(_mm_slli_epi32(b, 16), 16);
+			_mm_storeu_si128((__m128i*)d[c], _mm_add_epi16(_mm_loadu_si128((const __m128i*)d[c]), _mm_packs_epi32(a, b)));
+		}
+	}
+#elif defined(PCMV_NEON)
+	int16x4_t vl = vdup_n_s16((INT16)lvol);
+	int16x4_t vr = vdup_n_s16((INT16)rvol);
+	int32x4_t sh = vdupq_n_s32(-shift);
+
+	for (; i + 8 <= n; i += 8) {
+		int16x8_t s = vld1q_s16(src + i);
+		int16x8_t ml = vcombine_s16(vmovn_s32(vshlq_s32(vmull_s16(vget_low_s16(s), vl), sh)), vmovn_s32(vshlq_s32(vmull_s16(vget_high_s16(s), vl), sh)));
+		int16x8_t mr = vcombine_s16(vmovn_s32(vshlq_s32(vmull_s16(vget_low_s16(s), vr), sh)), vmovn_s32(vshlq_s32(vmull_s16(vget_high_s16(s), vr), sh)));
+		vst1q_s16(l + i, vaddq_s16(vld1q_s16(l + i), ml));
+		vst1q_s16(r + i, vaddq_s16(vld1q_s16(r + i), mr));
+	}
+#endif
+
+	for (; i < n; i++) {
+		l[i] += (src[i] * lvol) >> shift;
+		r[i] += (src[i] * rvol) >> shift;
+	}
+}
+
+#endif
@@ -5,6 +5,7 @@
 
 #include "burnint.h"
 #include "segapcm.h"
+#include "pcm_voice.h"
 
 #define MAX_CHIPS		2
 
@@ -40,25 +41,31 @@ static void SegaPCMUpdateOne(INT32 nChip, INT32 nLength)
 			UINT32 Addr = (Regs[0x85] << 16) | (Regs[0x84] << 8) | Chip[nChip]->low[Channel];
 			UINT32 Loop = (Regs[0x05] << 16) | (Regs[0x04] << 8);
 			UINT8 End = Regs[6] + 1;
-			INT32 i;
-			
-			for (i = 0; i < nLength; i++) {
-				INT8 v = 0;
-
-				if ((Addr >> 16) == End) {
-					if (Regs[0x86] & 2) {
-						Regs[0x86] |= 1;
-						break;
-					} else {
-						Addr = Loop;
+			UINT32 Step = (Regs[7] * Chip[nChip]->UpdateStep) >> 16;
+			INT16 Block[PCMV_BLOCK];
+
+			// walk the sample data a block at a time, the volume / mixing runs on the whole block
+			for (INT32 i = 0; i < nLength; i += PCMV_BLOCK) {
+				INT32 n = (nLength - i < PCMV_BLOCK) ? (nLength - i) : PCMV_BLOCK;
+				INT32 j;
+
+				for (j = 0; j < n; j++) {
+					if ((Addr >> 16) == End) {
+						if (Regs[0x86] & 2) {
+							Regs[0x86] |= 1;
+							break;
+						} else {
+							Addr = Loop;
+						}
 					}
+
+					Block[j] = Rom[Addr >> 8] - 0x80;
+					Addr = (Addr + Step) & 0xffffff;
 				}
 
-				v = Rom[Addr >> 8] - 0x80;
+				PCMVoiceMix32(Block, j, Regs[2], Regs[3], Left[nChip] + i, Right[nChip] + i);
 
-				Left[nChip][i] += v * Regs[2];
-				Right[nChip][i] += v * Regs[3];
-				Addr = (Addr + ((Regs[7] * Chip[nChip]->UpdateStep) >> 16)) & 0xffffff;
+				if (j < n) break;
 			}
 
 			Regs[0x84] = Addr >> 8;
@@ -14,6 +14,7 @@
 #include "driver.h"
 #include "state.h"
 #include "ym2151.h"
+#include "fm_simd.h"
 
 #if defined FBNEO_DEBUG
 #ifdef __GNUC__ 
@@ -509,6 +510,7 @@ static YM2151 * PSG;
 static signed int chanout[8];
 static signed int m2,c1,c2; /* Phase Modulation input for operators 2,3,4 */
 static signed int mem;		/* one sample delay memory */
+static int fm_synth = FM_SYNTH_SCALAR;	/* operator path, see fm_simd.h */
 
 
 /* save output as raw 16-bit sample */
@@ -1691,6 +1693,7 @@ int YM2151Init(int num, int chipbase, int clock, int rate, void (*timer_cb)(INT3
 	ym2151_state_save_register( YMNumChips );
 
 	init_tables();
+	fm_synth = nFMSynthesis;	/* operator path is selected at chip init */
 
 	for (i=0 ; i<YMNumChips; i++)
 	{
@@ -1987,6 +1990,121 @@ INLINE void chan7_calc(void)
 	op->mem_value = mem;
 }
 
+/* channel-parallel operator path, see fm_simd.h */
+static const FM_SIMD_TABLES fm_simd_tab = {
+	sin_tab, tl_tab, TL_TAB_LEN, ENV_QUIET, SIN_MASK, FREQ_SH, FREQ_SH, 1
+};
+
+static void chan_calc_simd(void)
+{
+	FM_SIMD_BATCH b;
+	YM2151Operator *op;
+	INT32 noise = PSG->noise & 0x80;
+	UINT32 env7 = 0;
+	int i, k;
+
+	b.num = 8;
+	memset(b.bus, 0, sizeof(b.bus));
+
+	for (i = 0; i < 8; i++)
+	{
+		UINT32 AM = 0;
+		INT8 d1;
+
+		op = &PSG->oper[i*4];	/* M1 */
+
+		b.bus[FMSimdBusIndex(op->mem_connect, &m2, &c1, &c2, &mem)][i] = op->mem_value;
+
+		if (op->ams)
+			AM = PSG->lfa << (op->ams-1);
+
+		for (k = 0; k < 4; k++)
+		{
+			b.phase[k][i] = op[k].phase;
+			b.env[k][i]   = volume_calc(&op[k]);
+		}
+
+		b.pm[i] = op->fb_shift ? ((op->fb_out_prev + op->fb_out_curr) << op->fb_shift) : 0;
+		op->fb_out_prev = op->fb_out_curr;
+
+		d1 = FMSimdBusIndex(op->connect, &m2, &c1, &c2, &mem);
+		if (d1 == FM_BUS_NONE)
+			/* algorithm 5 */
+			b.bus[FM_BUS_MEM][i] = b.bus[FM_BUS_C1][i] = b.bus[FM_BUS_C2][i] = op->fb_out_prev;
+		else
+			/* other algorithms */
+			b.bus[d1][i] = op->fb_out_prev;
+
+		b.dst[1][i] = FMSimdBusIndex((op+1)->connect, &m2, &c1, &c2, &mem);
+		b.dst[2][i] = FMSimdBusIndex((op+2)->connect, &m2, &c1, &c2, &mem);
+	}
+
+	/* channel 7 C2 is replaced by the noise generator */
+	if (noise)
+	{
+		env7 = b.env[3][7];
+		b.env[3][7] = ENV_QUIET;
+	}
+
+	FMSimdOpCalc(&fm_simd_tab, b.phase[0], b.pm, b.env[0], b.out, 8, fm_simd_tab.pm_sh_fb);
+
+	for (i = 0; i < 8; i++)
+		PSG->oper[i*4].fb_out_curr = b.out[i];
+
+	FMSimdRunStages(&fm_simd_tab, &b);
+
+	if (noise)
+	{
+		UINT32 noiseout = 0;
+		if (env7 < 0x3ff)
+			noiseout = (env7 ^ 0x3ff) * 2;	/* range of the YM2151 noise output is -2044 to 2040 */
+		b.bus[FM_BUS_OUT][7] += ((PSG->noise_rng&0x10000) ? noiseout: -noiseout); /* bit 16 -> output */
+	}
+
+	for (i = 0; i < 8; i++)
+	{
+		PSG->oper[i*4].mem_value = b.bus[FM_BUS_MEM][i];
+		chanout[i] += b.bus[FM_BUS_OUT][i];
+	}
+}
+
+static void chan_calc_batch(void)
+{
+	if (fm_synth == FM_SYNTH_VERIFY)
+	{
+		YM2151Operator before[32], after[32];
+		signed int out_start[8], out_ref[8];
+		int i;
+
+		memcpy(before, PSG->oper, sizeof(before));
+		memcpy(out_start, chanout, sizeof(chanout));
+
+		for (i = 0; i < 7; i++) chan_calc(i);
+		chan7_calc();
+
+		memcpy(after, PSG->oper, sizeof(after));
+		memcpy(out_ref, chanout, sizeof(chanout));
+		memcpy(PSG->oper, before, sizeof(before));
+		memcpy(chanout, out_start, sizeof(chanout));
+
+		chan_calc_simd();
+
+		for (i = 0; i < 8; i++)
+		{
+			if (chanout[i] != out_ref[i] || memcmp(&PSG->oper[i*4], &after[i*4], 4 * sizeof(YM2151Operator)))
+				FMSimdReportMismatch("YM2151", i, out_ref[i], chanout[i]);
+		}
+
+		/* keep the scalar result */
+		memcpy(PSG->oper, after, sizeof(after));
+		memcpy(chanout, out_ref, sizeof(chanout));
+	}
+	else
+	{
+		chan_calc_simd();
+	}
+}
+
 
 
 
@@ -2621,22 +2739,29 @@ void YM2151UpdateOne(int num, INT16 **buffers, int length)
 		chanout[6] = 0;
 		chanout[7] = 0;
 
-		chan_calc(0);
-		SAVE_SINGLE_CHANNEL(0)
-		chan_calc(1);
-		SAVE_SINGLE_CHANNEL(1)
-		chan_calc(2);
-		SAVE_SINGLE_CHANNEL(2)
-		chan_calc(3);
-		SAVE_SINGLE_CHANNEL(3)
-		chan_calc(4);
-		SAVE_SINGLE_CHANNEL(4)
-		chan_calc(5);
-		SAVE_SINGLE_CHANNEL(5)
-		chan_calc(6);
-		SAVE_SINGLE_CHANNEL(6)
-		chan7_calc();
-		SAVE_SINGLE_CHANNEL(7)
+		if (fm_synth != FM_SYNTH_SCALAR)
+		{
+			chan_calc_batch();
+		}
+		else
+		{
+			chan_calc(0);
+			SAVE_SINGLE_CHANNEL(0)
+			chan_calc(1);
+			SAVE_SINGLE_CHANNEL(1)
+			chan_calc(2);
+			SAVE_SINGLE_CHANNEL(2)
+			chan_calc(3);
+			SAVE_SINGLE_CHANNEL(3)
+			chan_calc(4);
+			SAVE_SINGLE_CHANNEL(4)
+			chan_calc(5);
+			SAVE_SINGLE_CHANNEL(5)
+			chan_calc(6);
+			SAVE_SINGLE_CHANNEL(6)
+			chan7_calc();
+			SAVE_SINGLE_CHANNEL(7)
+		}
 
 		outl = chanout[0] & PSG->pan[0];
 		outr = chanout[0] & PSG->pan[1];
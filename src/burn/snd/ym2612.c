@@ -158,6 +158,7 @@
 #include "support.h"		/* use RAINE */
 #endif
 #include "ym2612.h"
+#include "fm_simd.h"
 
 static INT32 in_reset = 0;
 
@@ -1445,6 +1446,36 @@ INLINE signed int op_calc1(UINT32 phase, unsigned int env, unsigned int pm)
   return tl_tab[p];
 }
 
+/* update phase counters AFTER output calculations */
+INLINE void chan_update_phase(FM_CH *CH)
+{
+  if(CH->pms)
+  {
+    /* 3-slot mode */
+    if ((ym2612.OPN.ST.mode & 0xC0) && (CH == &ym2612.CH[2]))
+    {
+      /* keyscale code is not modifiedby LFO */
+      UINT8 kc = ym2612.CH[2].kcode;
+      UINT32 pm = ym2612.CH[2].pms + ym2612.OPN.LFO_PM;
+      update_phase_lfo_slot(&ym2612.CH[2].SLOT[SLOT1], pm, kc, ym2612.OPN.SL3.block_fnum[1]);
+      update_phase_lfo_slot(&ym2612.CH[2].SLOT[SLOT2], pm, kc, ym2612.OPN.SL3.block_fnum[2]);
+      update_phase_lfo_slot(&ym2612.CH[2].SLOT[SLOT3], pm, kc, ym2612.OPN.SL3.block_fnum[0]);
+      update_phase_lfo_slot(&ym2612.CH[2].SLOT[SLOT4], pm, kc, ym2612.CH[2].block_fnum);
+    }
+    else
+    {
+      update_phase_lfo_channel(CH);
+    }
+  }
+  else  /* no LFO phase modulation */
+  {
+    CH->SLOT[SLOT1].phase += CH->SLOT[SLOT1].Incr;
+    CH->SLOT[SLOT2].phase += CH->SLOT[SLOT2].Incr;
+    CH->SLOT[SLOT3].phase += CH->SLOT[SLOT3].Incr;
+    CH->SLOT[SLOT4].phase += CH->SLOT[SLOT4].Incr;
+  }
+}
+
 INLINE void chan_calc(FM_CH *CH, int num)
 {
   do
@@ -1492,36 +1523,117 @@ INLINE void chan_calc(FM_CH *CH, int num)
     /* store current MEM */
     CH->mem_value = mem;
 
-    /* update phase counters AFTER output calculations */
-    if(CH->pms)
+    chan_update_phase(CH);
+
+    /* next channel */
+    CH++;
+  } while (--num);
+}
+
+/* channel-parallel operator path, see fm_simd.h */
+static int fm_synth = FM_SYNTH_SCALAR;
+
+static const FM_SIMD_TABLES fm_simd_tab = {
+  sin_tab, tl_tab, TL_TAB_LEN, ENV_QUIET, SIN_MASK, SIN_BITS, 0, 1
+};
+
+INLINE void chan_calc_simd(FM_CH *CH, int num)
+{
+  FM_SIMD_BATCH b;
+  int i, k;
+
+  b.num = num;
+  memset(b.bus, 0, sizeof(b.bus));
+
+  for (i = 0; i < num; i++)
+  {
+    UINT32 AM = ym2612.OPN.LFO_AM >> CH[i].ams;
+
+    b.bus[FMSimdBusIndex(CH[i].mem_connect, &m2, &c1, &c2, &mem)][i] = CH[i].mem_value;
+
+    for (k = 0; k < 4; k++)
     {
-      /* 3-slot mode */
-      if ((ym2612.OPN.ST.mode & 0xC0) && (CH == &ym2612.CH[2]))
-      {
-        /* keyscale code is not modifiedby LFO */
-        UINT8 kc = ym2612.CH[2].kcode;
-        UINT32 pm = ym2612.CH[2].pms + ym2612.OPN.LFO_PM;
-        update_phase_lfo_slot(&ym2612.CH[2].SLOT[SLOT1], pm, kc, ym2612.OPN.SL3.block_fnum[1]);
-        update_phase_lfo_slot(&ym2612.CH[2].SLOT[SLOT2], pm, kc, ym2612.OPN.SL3.block_fnum[2]);
-        update_phase_lfo_slot(&ym2612.CH[2].SLOT[SLOT3], pm, kc, ym2612.OPN.SL3.block_fnum[0]);
-        update_phase_lfo_slot(&ym2612.CH[2].SLOT[SLOT4], pm, kc, ym2612.CH[2].block_fnum);
-      }
-      else
-      {
-        update_phase_lfo_channel(CH);
-      }
+      b.phase[k][i] = CH[i].SLOT[k].phase;
+      b.env[k][i]   = volume_calc(&CH[i].SLOT[k]);
+    }
+
+    b.pm[i] = (CH[i].FB < SIN_BITS) ? ((CH[i].op1_out[0] + CH[i].op1_out[1]) >> CH[i].FB) : 0;
+    b.dst[0][i] = FMSimdBusIndex(CH[i].connect1, &m2, &c1, &c2, &mem);
+    b.dst[1][i] = FMSimdBusIndex(CH[i].connect3, &m2, &c1, &c2, &mem);
+    b.dst[2][i] = FMSimdBusIndex(CH[i].connect2, &m2, &c1, &c2, &mem);
+  }
+
+  FMSimdOpCalc(&fm_simd_tab, b.phase[0], b.pm, b.env[0], b.out, num, fm_simd_tab.pm_sh_fb);
+
+  for (i = 0; i < num; i++)
+  {
+    CH[i].op1_out[0] = CH[i].op1_out[1];
+    CH[i].op1_out[1] = b.out[i];
+
+    if (b.dst[0][i] == FM_BUS_NONE)
+    {
+      /* algorithm 5 */
+      b.bus[FM_BUS_MEM][i] = b.bus[FM_BUS_C1][i] = b.bus[FM_BUS_C2][i] = b.out[i];
     }
-    else  /* no LFO phase modulation */
+    else
     {
-      CH->SLOT[SLOT1].phase += CH->SLOT[SLOT1].Incr;
-      CH->SLOT[SLOT2].phase += CH->SLOT[SLOT2].Incr;
-      CH->SLOT[SLOT3].phase += CH->SLOT[SLOT3].Incr;
-      CH->SLOT[SLOT4].phase += CH->SLOT[SLOT4].Incr;
+      b.bus[b.dst[0][i]][i] = b.out[i];
     }
+  }
 
-    /* next channel */
-    CH++;
-  } while (--num);
+  FMSimdRunStages(&fm_simd_tab, &b);
+
+  for (i = 0; i < num; i++)
+  {
+    CH[i].mem_value = b.bus[FM_BUS_MEM][i];
+    *CH[i].connect4 += b.bus[FM_BUS_OUT][i];
+
+    chan_update_phase(&CH[i]);
+  }
+}
+
+INLINE void chan_calc_channels(FM_CH *CH, int num)
+{
+  switch (fm_synth)
+  {
+    case FM_SYNTH_SIMD:
+      chan_calc_simd(CH, num);
+    break;
+
+    case FM_SYNTH_VERIFY:
+    {
+      FM_CH before[6], after[6];
+      INT32 out_start[8], out_ref[8];
+      int i;
+
+      memcpy(before, CH, num * sizeof(FM_CH));
+      memcpy(out_start, out_fm, sizeof(out_fm));
+
+      chan_calc(CH, num);
+
+      memcpy(after, CH, num * sizeof(FM_CH));
+      memcpy(out_ref, out_fm, sizeof(out_fm));
+      memcpy(CH, before, num * sizeof(FM_CH));
+      memcpy(out_fm, out_start, sizeof(out_fm));
+
+      chan_calc_simd(CH, num);
+
+      for (i = 0; i < num; i++)
+      {
+        if (out_fm[i] != out_ref[i] || memcmp(&CH[i], &after[i], sizeof(FM_CH)))
+          FMSimdReportMismatch("YM2612", i, out_ref[i], out_fm[i]);
+      }
+
+      /* keep the scalar result */
+      memcpy(CH, after, num * sizeof(FM_CH));
+      memcpy(out_fm, out_ref, sizeof(out_fm));
+    }
+    break;
+
+    default:
+      chan_calc(CH, num);
+    break;
+  }
 }
 
 /* write a OPN mode register 0x20-0x2f */
@@ -1912,6 +2024,7 @@ void MDYM2612Init(void)
 {
   memset(&ym2612,0,sizeof(YM2612));
   init_tables();
+  fm_synth = nFMSynthesis;  /* operator path is selected at chip init */
   MDYM2612Config(14);
 }
 
@@ -2076,13 +2189,13 @@ void MDYM2612Update(INT16 **buffer, int length)
     /* calculate FM */
     if (!ym2612.dacen)
     {
-      chan_calc(&ym2612.CH[0],6);
+      chan_calc_channels(&ym2612.CH[0],6);
     }
     else
     {
       /* DAC Mode */
       out_fm[5] = ym2612.dacout;
-      chan_calc(&ym2612.CH[0],5);
+      chan_calc_channels(&ym2612.CH[0],5);
     }
 
     /* advance LFO */
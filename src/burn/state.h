@@ -43,6 +43,7 @@ void StateRunAheadLoad();
 #define ACB_RUNAHEAD			(1<<7) // for single instance runahead
 #define ACB_2RUNAHEAD			(1<<8) // for second instance runahead
 #define ACB_NET_OPT				(1<<9) // for netplay
+#define ACB_VIDEO				(1<<11) // areas that make up the picture, for BurnVideoUnchanged()
 
 #define ACB_FULLSCAN	(ACB_NVRAM | ACB_MEMCARD | ACB_MEMORY_RAM | ACB_DRIVER_DATA)
 
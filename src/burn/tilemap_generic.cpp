@@ -152,8 +152,14 @@ void GenericTilemapSetGfx(INT32 num, UINT8 *gfxbase, INT32 depth, INT32 tile_wid
 #endif
 }
 
+static void roz_thread_stop();
+
 void GenericTilemapExit()
 {
+	// only stop the worker: GenericTilesInit() runs this too, often after the roz
+	// chip asked for threading, the chip's own exit clears the request
+	roz_thread_stop();
+
 	// de-allocate any row/col scroll tables
 	for (INT32 i = 0; i < MAX_TILEMAPS; i++) {
 		cur_map = &maps[i];
@@ -1795,3 +1801,224 @@ tilemap_scan( scan_cols )
 {
 	return (cur_map->mheight * col) + row;
 }
+
+
+/*================================================================================================
+Rotate / zoom layer engine
+================================================================================================*/
+
+#include "thready.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GENERIC_ROZ_SSE2	1
+#endif
+
+#define ROZ_CHUNK		64		// pixels sampled per pass
+#define ROZ_MIN_SPLIT	64		// lines needed before a draw is shared with the worker thread
+
+static INT32 roz_threading = 0;		// asked for by the roz chip (K051316 / K053936 init)
+static INT32 roz_thread_running = 0;	// worker started, on the first draw that can use it
+
+// sample a run of pixels: pix[] gets the source pixel, ok[] is cleared for pixels outside a non-wrapping pixmap
+static void roz_sample(GenericRozSource *src, INT32 count, UINT32 cx, UINT32 cy, INT32 incxx, INT32 incxy, UINT16 *pix, UINT8 *ok)
+{
+	UINT16 *pixmap = src->pixmap;
+	INT32 width = src->width;
+	UINT32 wmask = src->width - 1;
+	UINT32 hmask = src->height - 1;
+	INT32 i = 0;
+
+	if (incxy == 0)
+	{
+		// the line stays on one source row
+		UINT32 yy = cy >> 16;
+
+		if (!src->wrap && yy > hmask) {
+			memset(ok, 0, count);
+			return;
+		}
+
+		UINT16 *row = pixmap + (src->wrap ? (yy & hmask) : yy) * width;
+
+		if (src->wrap) {
+			if (incxx == (1 << 16)) {
+				// straight copy, at most one wrap per chunk
+				UINT32 xx = (cx >> 16) & wmask;
+				while (i < count) {
+					INT32 run = width - xx;
+					if (run > count - i) run = count - i;
+					memcpy(pix + i, row + xx, run * sizeof(UINT16));
+					i += run;
+					xx = 0;
+				}
+			} else {
+				for (; i < count; i++, cx += incxx) pix[i] = row[(cx >> 16) & wmask];
+			}
+			memset(ok, 1, count);
+		} else {
+			for (; i < count; i++, cx += incxx) {
+				UINT32 xx = cx >> 16;
+				ok[i] = (xx <= wmask);
+				pix[i] = ok[i] ? row[xx] : 0;
+			}
+		}
+		return;
+	}
+
+	if (src->wrap)
+	{
+#if defined GENERIC_ROZ_SSE2
+		// source addresses 4 at a time, the fetches stay scalar
+		const __m128i vw = _mm_set1_epi32(wmask);
+		const __m128i vh = _mm_set1_epi32(hmask);
+		const __m128i vdx = _mm_set1_epi32((UINT32)incxx * 4);
+		const __m128i vdy = _mm_set1_epi32((UINT32)incxy * 4);
+		__m128i vx = _mm_setr_epi32(cx, cx + incxx, cx + (UINT32)incxx * 2, cx + (UINT32)incxx * 3);
+		__m128i vy = _mm_setr_epi32(cy, cy + incxy, cy + (UINT32)incxy * 2, cy + (UINT32)incxy * 3);
+		INT32 shift = 0;
+
+		while ((1 << shift) < width) shift++;
+
+		if ((1 << shift) == width) {
+			for (; i + 4 <= count; i += 4) {
+				INT32 offs[4];
+				__m128i xx = _mm_and_si128(_mm_srli_epi32(vx, 16), vw);
+				__m128i yy = _mm_and_si128(_mm_srli_epi32(vy, 16), vh);
+				_mm_storeu_si128((__m128i*)offs, _mm_or_si128(_mm_sll_epi32(yy, _mm_cvtsi32_si128(shift)), xx));
+				pix[i + 0] = pixmap[offs[0]];
+				pix[i + 1] = pixmap[offs[1]];
+				pix[i + 2] = pixmap[offs[2]];
+				pix[i + 3] = pixmap[offs[3]];
+				vx = _mm_add_epi32(vx, vdx);
+				vy = _mm_add_epi32(vy, vdy);
+			}
+			cx += (UINT32)incxx * i;
+			cy += (UINT32)incxy * i;
+		}
+#endif
+		for (; i < count; i++, cx += incxx, cy += incxy) {
+			pix[i] = pixmap[((cy >> 16) & hmask) * width + ((cx >> 16) & wmask)];
+		}
+		memset(ok, 1, count);
+	}
+	else
+	{
+		for (; i < count; i++, cx += incxx, cy += incxy) {
+			UINT32 xx = cx >> 16;
+			UINT32 yy = cy >> 16;
+			ok[i] = (xx <= wmask && yy <= hmask);
+			pix[i] = ok[i] ? pixmap[yy * width + xx] : 0;
+		}
+	}
+}
+
+static void roz_draw_lines(GenericRozSource *src, GenericRozTarget *dst, INT32 minx, INT32 maxx, INT32 miny, INT32 y0, INT32 y1, UINT32 startx, UINT32 starty, INT32 incxx, INT32 incxy, INT32 incyx, INT32 incyy)
+{
+	UINT16 pix[ROZ_CHUNK];
+	UINT8 ok[ROZ_CHUNK];
+
+	UINT16 transmask = src->transmask;
+	UINT16 transvalue = src->transvalue;
+	UINT16 pixmask = src->pixmask;
+	UINT8 priority = dst->priority;
+
+	startx += (UINT32)incyx * (y0 - miny);
+	starty += (UINT32)incyy * (y0 - miny);
+
+	for (INT32 y = y0; y < y1; y++, startx += incyx, starty += incyy)
+	{
+		INT32 line = (y - miny) * dst->pitch;
+		UINT32 cx = startx;
+		UINT32 cy = starty;
+
+		for (INT32 x = minx; x < maxx; )
+		{
+			INT32 count = maxx - x;
+			if (count > ROZ_CHUNK) count = ROZ_CHUNK;
+
+			roz_sample(src, count, cx, cy, incxx, incxy, pix, ok);
+
+			UINT8 *pri = dst->pri ? (dst->pri + line + x) : NULL;
+
+			if (dst->dst16) {
+				UINT16 *out = dst->dst16 + line + x;
+				for (INT32 i = 0; i < count; i++) {
+					if (!ok[i] || (transmask && (pix[i] & transmask) == transvalue)) continue;
+					out[i] = pix[i] & pixmask;
+					if (pri) pri[i] = priority;
+				}
+			} else {
+				UINT32 *out = dst->dst32 + line + x;
+				UINT32 *pal = dst->palette32;
+				for (INT32 i = 0; i < count; i++) {
+					if (!ok[i] || (transmask && (pix[i] & transmask) == transvalue)) continue;
+					out[i] = pal[pix[i] & pixmask];
+					if (pri) pri[i] = priority;
+				}
+			}
+
+			x += count;
+			cx += (UINT32)incxx * count;
+			cy += (UINT32)incxy * count;
+		}
+	}
+}
+
+// lines handed to the worker thread
+static struct {
+	GenericRozSource *src;
+	GenericRozTarget *dst;
+	INT32 minx, maxx, miny, y0, y1;
+	UINT32 startx, starty;
+	INT32 incxx, incxy, incyx, incyy;
+} roz_job;
+
+static void roz_thread_cb()
+{
+	roz_draw_lines(roz_job.src, roz_job.dst, roz_job.minx, roz_job.maxx, roz_job.miny, roz_job.y0, roz_job.y1, roz_job.startx, roz_job.starty, roz_job.incxx, roz_job.incxy, roz_job.incyx, roz_job.incyy);
+}
+
+static void roz_thread_stop()
+{
+	if (roz_thread_running) {
+		thready.exit();
+		roz_thread_running = 0;
+	}
+}
+
+void GenericRozSetThreading(INT32 enable)
+{
+	if (!enable) roz_thread_stop();
+
+	roz_threading = enable;
+}
+
+void GenericRozDraw(GenericRozSource *src, GenericRozTarget *dst, INT32 minx, INT32 maxx, INT32 miny, INT32 maxy, UINT32 startx, UINT32 starty, INT32 incxx, INT32 incxy, INT32 incyx, INT32 incyy)
+{
+	if (minx >= maxx || miny >= maxy) return;
+
+	if (roz_threading && (maxy - miny) >= ROZ_MIN_SPLIT)
+	{
+		if (!roz_thread_running) {
+			thready.init(roz_thread_cb);
+			roz_thread_running = 1;
+		}
+
+		// the worker takes the bottom half, the lines don't overlap
+		INT32 split = miny + (maxy - miny) / 2;
+
+		roz_job.src = src; roz_job.dst = dst;
+		roz_job.minx = minx; roz_job.maxx = maxx; roz_job.miny = miny;
+		roz_job.y0 = split; roz_job.y1 = maxy;
+		roz_job.startx = startx; roz_job.starty = starty;
+		roz_job.incxx = incxx; roz_job.incxy = incxy; roz_job.incyx = incyx; roz_job.incyy = incyy;
+
+		thready.notify();
+		roz_draw_lines(src, dst, minx, maxx, miny, miny, split, startx, starty, incxx, incxy, incyx, incyy);
+		thready.notify_wait();
+		return;
+	}
+
+	roz_draw_lines(src, dst, minx, maxx, miny, miny, maxy, startx, starty, incxx, incxy, incyx, incyy);
+}
@@ -189,4 +189,38 @@ void GenericTilemapDraw(INT32 which, INT32 bitmap, INT32 priority);
 // Dump all tilemaps to bitmap files
 void GenericTilemapDumpToBitmap();
 
+
+// Rotate / zoom (roz) layer engine
+//
+// Copies a pre-rendered source pixmap with an affine transform. The source position of
+// destination pixel (minx, miny) is (startx, starty) in 16.16 fixed point, it moves by
+// (incxx, incxy) for each pixel to the right and by (incyx, incyy) for each line down.
+
+struct GenericRozSource {
+	UINT16 *pixmap;
+	INT32 width;			// pixels per pixmap row
+	INT32 height;
+	INT32 wrap;				// 1: coordinates are masked (width and height must be powers of 2), 0: pixels outside the pixmap are skipped
+	UINT16 transmask;		// a pixel is skipped when (pixel & transmask) == transvalue, transmask 0 draws every pixel
+	UINT16 transvalue;
+	UINT16 pixmask;			// applied to every drawn pixel
+};
+
+struct GenericRozTarget {
+	UINT16 *dst16;			// indexed output, or NULL to draw dst32
+	UINT32 *dst32;			// high-color output through palette32
+	UINT32 *palette32;
+	UINT8 *pri;				// priority output (can be NULL)
+	INT32 pitch;			// destination pixels per line
+	INT32 priority;
+};
+
+// dst16 / dst32 / pri point at line miny, (x, y) is written at [(y - miny) * pitch + x]
+void GenericRozDraw(GenericRozSource *src, GenericRozTarget *dst, INT32 minx, INT32 maxx, INT32 miny, INT32 maxy, UINT32 startx, UINT32 starty, INT32 incxx, INT32 incxy, INT32 incyx, INT32 incyy);
+
+// Let large roz draws split their lines with a worker thread (off by default,
+// K051316 / K053936 turn it on at init when bBurnVideoThreading is set, the
+// thread itself is started by the first draw that uses it)
+void GenericRozSetThreading(INT32 enable);
+
 #endif
@@ -60,6 +60,8 @@ INT32 GenericTilesExit()
 
 	GenericTilemapExit();
 
+	GenericTilesClearGfxOpacity();
+
 	return 0;
 }
 
@@ -377,6 +379,142 @@ void BurnTransferRealloc()
 	BurnTransferClear();
 }
 
+// ----------------------------------------------------------------------------
+// Per-tile opacity
+//
+// Optional table of the lowest and highest pen used by every tile of a graphics
+// region.  A tile whose pens all equal the mask colour is skipped by the masked
+// renderers, a tile that never uses the mask colour is drawn by the unmasked
+// (branch-free) renderer instead.  Only register regions that are not rewritten
+// behind our back - GfxDecode() and GfxDecodeSingle() keep registered regions up
+// to date, anything else must call GenericTilesUpdateGfxOpacity().
+//
+// The renderers can't build the table on their own: they don't know whether a
+// region is ram that the driver writes to, or decoded roms it patches afterwards,
+// and a stale table draws the wrong pixels.  So drivers opt in, for now the sprite
+// roms of blktiger, cabal, ddragon, sf, snk68, terracre, tigeroad and toki.
+
+struct GenericTilesOpacity {
+	UINT8 *gfxbase;		// pointer to graphics data
+	INT32 tile_size;	// width * height
+	INT32 count;		// number of tiles
+	UINT8 *range;		// lowest and highest pen of each tile
+};
+
+static GenericTilesOpacity OpacityData[MAX_GFX];
+static GenericTilesOpacity *pOpacityLast = NULL;
+static INT32 nOpacityCount = 0;
+
+static GenericTilesOpacity *GenericTilesFindOpacity(UINT8 *GfxBase, INT32 nTileSize)
+{
+	for (INT32 i = 0; i < nOpacityCount; i++) {
+		if (OpacityData[i].gfxbase == GfxBase && OpacityData[i].tile_size == nTileSize) {
+			pOpacityLast = &OpacityData[i];
+			return pOpacityLast;
+		}
+	}
+
+	return NULL;
+}
+
+static void GenericTilesScanOpacity(GenericTilesOpacity *op, INT32 nStart, INT32 nCount)
+{
+	if (nStart < 0) {
+		nCount += nStart;
+		nStart = 0;
+	}
+	if (nStart + nCount > op->count) nCount = op->count - nStart;
+
+	for (INT32 i = nStart; i < nStart + nCount; i++) {
+		UINT8 *src = op->gfxbase + i * op->tile_size;
+		UINT8 lo = src[0], hi = src[0];
+
+		for (INT32 j = 1; j < op->tile_size; j++) {
+			if (src[j] < lo) lo = src[j];
+			if (src[j] > hi) hi = src[j];
+		}
+
+		op->range[i * 2 + 0] = lo;
+		op->range[i * 2 + 1] = hi;
+	}
+}
+
+void GenericTilesSetGfxOpacity(UINT8 *GfxBase, INT32 nTileWidth, INT32 nTileHeight, INT32 nGfxLen)
+{
+	INT32 nTileSize = nTileWidth * nTileHeight;
+	INT32 nCount = nGfxLen / nTileSize;
+
+	GenericTilesOpacity *op = GenericTilesFindOpacity(GfxBase, nTileSize);
+
+	if (op == NULL) {
+		if (nOpacityCount >= MAX_GFX) {
+			bprintf(PRINT_ERROR, _T("GenericTilesSetGfxOpacity: no free slots!\n"));
+			return;
+		}
+		op = &OpacityData[nOpacityCount++];
+	} else {
+		BurnFree(op->range);
+	}
+
+	op->gfxbase = GfxBase;
+	op->tile_size = nTileSize;
+	op->count = nCount;
+	op->range = (UINT8*)BurnMalloc(nCount * 2);
+
+	GenericTilesScanOpacity(op, 0, nCount);
+}
+
+void GenericTilesUpdateGfxOpacity(UINT8 *GfxBase, INT32 nTileWidth, INT32 nTileHeight, INT32 nStart, INT32 nCount)
+{
+	GenericTilesOpacity *op = GenericTilesFindOpacity(GfxBase, nTileWidth * nTileHeight);
+
+	if (op) GenericTilesScanOpacity(op, nStart, nCount);
+}
+
+void GenericTilesClearGfxOpacity()
+{
+	for (INT32 i = 0; i < nOpacityCount; i++) {
+		BurnFree(OpacityData[i].range);
+	}
+
+	memset(OpacityData, 0, sizeof(OpacityData));
+	pOpacityLast = NULL;
+	nOpacityCount = 0;
+}
+
+#define TILE_OPACITY_MIXED	0
+#define TILE_OPACITY_EMPTY	1	// every pixel is nMaskColour
+#define TILE_OPACITY_SOLID	2	// no pixel is nMaskColour
+
+static inline INT32 GenericTilesTileOpacity(UINT8 *pTile, INT32 nTileSize, INT32 nTileNumber, INT32 nMaskColour)
+{
+	if (nOpacityCount == 0) return TILE_OPACITY_MIXED;
+
+	GenericTilesOpacity *op = pOpacityLast;
+
+	if (op == NULL || op->gfxbase != pTile || op->tile_size != nTileSize) {
+		op = GenericTilesFindOpacity(pTile, nTileSize);
+		if (op == NULL) return TILE_OPACITY_MIXED;
+	}
+
+	if ((UINT32)nTileNumber >= (UINT32)op->count) return TILE_OPACITY_MIXED;
+
+	INT32 lo = op->range[nTileNumber * 2 + 0];
+	INT32 hi = op->range[nTileNumber * 2 + 1];
+
+	if (nMaskColour < lo || nMaskColour > hi) return TILE_OPACITY_SOLID;
+	if (lo == hi) return TILE_OPACITY_EMPTY;
+
+	return TILE_OPACITY_MIXED;
+}
+
+// skip empty tiles, hand solid ones to the unmasked renderer
+#define OPACITY_FAST_PATH(size, unmasked) \
+	switch (GenericTilesTileOpacity(pTile, size, nTileNumber, nMaskColour)) { \
+		case TILE_OPACITY_EMPTY: return; \
+		case TILE_OPACITY_SOLID: unmasked; return; \
+	}
+
 /*================================================================================================
 Graphics Decoding
 ================================================================================================*/
@@ -410,6 +548,8 @@ void GfxDecode(INT32 num, INT32 numPlanes, INT32 xSize, INT32 ySize, INT32 plane
 			}
 		}
 	}
+
+	if (nOpacityCount) GenericTilesUpdateGfxOpacity(pDest, xSize, ySize, 0, num);
 }
 
 void GfxDecodeSingle(INT32 which, INT32 numPlanes, INT32 xSize, INT32 ySize, INT32 planeoffsets[], INT32 xoffsets[], INT32 yoffsets[], INT32 modulo, UINT8 *pSrc, UINT8 *pDest)
@@ -432,6 +572,8 @@ void GfxDecodeSingle(INT32 which, INT32 numPlanes, INT32 xSize, INT32 ySize, INT
 			}
 		}
 	}
+
+	if (nOpacityCount) GenericTilesUpdateGfxOpacity(pDest, xSize, ySize, which, 1);
 }
 
 //================================================================================================
@@ -667,6 +809,8 @@ void Render8x8Tile_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, INT3
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(64, Render8x8Tile(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 6);
 
@@ -690,6 +834,8 @@ void Render8x8Tile_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(64, Render8x8Tile_Clip(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 6);
 
@@ -717,6 +863,8 @@ void Render8x8Tile_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipX called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(64, Render8x8Tile_FlipX(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 6);
 
@@ -740,6 +888,8 @@ void Render8x8Tile_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 S
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipX_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(64, Render8x8Tile_FlipX_Clip(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 6);
 
@@ -767,6 +917,8 @@ void Render8x8Tile_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipY called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(64, Render8x8Tile_FlipY(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 6);
 
@@ -790,6 +942,8 @@ void Render8x8Tile_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 S
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipY_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(64, Render8x8Tile_FlipY_Clip(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 6);
 
@@ -817,6 +971,8 @@ void Render8x8Tile_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 Start
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipXY called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(64, Render8x8Tile_FlipXY(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 6);
 
@@ -840,6 +996,8 @@ void Render8x8Tile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Mask_FlipXY_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(64, Render8x8Tile_FlipXY_Clip(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 6);
 
@@ -1139,6 +1297,8 @@ void Render16x16Tile_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, IN
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(256, Render16x16Tile(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 8);
 
@@ -1170,6 +1330,8 @@ void Render16x16Tile_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 Start
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(256, Render16x16Tile_Clip(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 8);
 
@@ -1205,6 +1367,8 @@ void Render16x16Tile_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 Star
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipX called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(256, Render16x16Tile_FlipX(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 8);
 
@@ -1236,6 +1400,8 @@ void Render16x16Tile_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipX_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(256, Render16x16Tile_FlipX_Clip(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 8);
 
@@ -1271,6 +1437,8 @@ void Render16x16Tile_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 Star
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipY called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(256, Render16x16Tile_FlipY(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 8);
 
@@ -1302,6 +1470,8 @@ void Render16x16Tile_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipY_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(256, Render16x16Tile_FlipY_Clip(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 8);
 
@@ -1337,6 +1507,8 @@ void Render16x16Tile_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 Sta
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipXY called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(256, Render16x16Tile_FlipXY(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 8);
 
@@ -1368,6 +1540,8 @@ void Render16x16Tile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT3
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Mask_FlipXY_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(256, Render16x16Tile_FlipXY_Clip(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 8);
 
@@ -1803,6 +1977,8 @@ void Render32x32Tile_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX, IN
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(1024, Render32x32Tile(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 10);
 
@@ -1850,6 +2026,8 @@ void Render32x32Tile_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 Start
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(1024, Render32x32Tile_Clip(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 10);
 
@@ -1901,6 +2079,8 @@ void Render32x32Tile_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 Star
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipX called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(1024, Render32x32Tile_FlipX(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 10);
 
@@ -1948,6 +2128,8 @@ void Render32x32Tile_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipX_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(1024, Render32x32Tile_FlipX_Clip(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 10);
 
@@ -1999,6 +2181,8 @@ void Render32x32Tile_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 Star
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipY called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(1024, Render32x32Tile_FlipY(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 10);
 
@@ -2046,6 +2230,8 @@ void Render32x32Tile_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipY_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(1024, Render32x32Tile_FlipY_Clip(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 10);
 
@@ -2097,6 +2283,8 @@ void Render32x32Tile_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32 Sta
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipXY called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(1024, Render32x32Tile_FlipXY(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 10);
 
@@ -2144,6 +2332,8 @@ void Render32x32Tile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT3
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Mask_FlipXY_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(1024, Render32x32Tile_FlipXY_Clip(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 10);
 
@@ -2363,6 +2553,8 @@ void RenderCustomTile_Mask(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(nWidth * nHeight, RenderCustomTile(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber * nWidth * nHeight);
 
@@ -2381,6 +2573,8 @@ void RenderCustomTile_Mask_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(nWidth * nHeight, RenderCustomTile_Clip(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber * nWidth * nHeight);
 
@@ -2403,6 +2597,8 @@ void RenderCustomTile_Mask_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipX called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(nWidth * nHeight, RenderCustomTile_FlipX(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber * nWidth * nHeight);
 
@@ -2421,6 +2617,8 @@ void RenderCustomTile_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHe
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipX_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(nWidth * nHeight, RenderCustomTile_FlipX_Clip(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber * nWidth * nHeight);
 
@@ -2443,6 +2641,8 @@ void RenderCustomTile_Mask_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipY called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(nWidth * nHeight, RenderCustomTile_FlipY(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber * nWidth * nHeight);
 
@@ -2461,6 +2661,8 @@ void RenderCustomTile_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHe
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipY_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(nWidth * nHeight, RenderCustomTile_FlipY_Clip(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber * nWidth * nHeight);
 
@@ -2483,6 +2685,8 @@ void RenderCustomTile_Mask_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipXY called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(nWidth * nHeight, RenderCustomTile_FlipXY(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber * nWidth * nHeight);
 
@@ -2501,6 +2705,8 @@ void RenderCustomTile_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nH
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Mask_FlipXY_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(nWidth * nHeight, RenderCustomTile_FlipXY_Clip(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber * nWidth * nHeight);
 
@@ -2737,6 +2943,8 @@ void Render8x8Tile_Prio_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 StartX,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(64, Render8x8Tile_Prio(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 6);
 
@@ -2761,6 +2969,8 @@ void Render8x8Tile_Prio_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32 St
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(64, Render8x8Tile_Prio_Clip(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 6);
 
@@ -2789,6 +2999,8 @@ void Render8x8Tile_Prio_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32 S
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipX called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(64, Render8x8Tile_Prio_FlipX(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 6);
 
@@ -2813,6 +3025,8 @@ void Render8x8Tile_Prio_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber, IN
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipX_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(64, Render8x8Tile_Prio_FlipX_Clip(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 6);
 
@@ -2841,6 +3055,8 @@ void Render8x8Tile_Prio_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32 S
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipY called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(64, Render8x8Tile_Prio_FlipY(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 6);
 
@@ -2865,6 +3081,8 @@ void Render8x8Tile_Prio_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber, IN
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipY_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(64, Render8x8Tile_Prio_FlipY_Clip(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 6);
 
@@ -2893,6 +3111,8 @@ void Render8x8Tile_Prio_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipXY called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(64, Render8x8Tile_Prio_FlipXY(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 6);
 
@@ -2917,6 +3137,8 @@ void Render8x8Tile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber, I
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render8x8Tile_Prio_Mask_FlipXY_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(64, Render8x8Tile_Prio_FlipXY_Clip(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 6);
 
@@ -3225,6 +3447,8 @@ void Render16x16Tile_Prio_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 Start
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(256, Render16x16Tile_Prio(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 8);
 
@@ -3257,6 +3481,8 @@ void Render16x16Tile_Prio_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(256, Render16x16Tile_Prio_Clip(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 8);
 
@@ -3293,6 +3519,8 @@ void Render16x16Tile_Prio_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipX called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(256, Render16x16Tile_Prio_FlipX(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 8);
 
@@ -3325,6 +3553,8 @@ void Render16x16Tile_Prio_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipX_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(256, Render16x16Tile_Prio_FlipX_Clip(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 8);
 
@@ -3361,6 +3591,8 @@ void Render16x16Tile_Prio_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipY called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(256, Render16x16Tile_Prio_FlipY(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 8);
 
@@ -3393,6 +3625,8 @@ void Render16x16Tile_Prio_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipY_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(256, Render16x16Tile_Prio_FlipY_Clip(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 8);
 
@@ -3429,6 +3663,8 @@ void Render16x16Tile_Prio_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT3
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipXY called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(256, Render16x16Tile_Prio_FlipXY(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 8);
 
@@ -3461,6 +3697,8 @@ void Render16x16Tile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render16x16Tile_Prio_Mask_FlipXY_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(256, Render16x16Tile_Prio_FlipXY_Clip(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 8);
 
@@ -3905,6 +4143,8 @@ void Render32x32Tile_Prio_Mask(UINT16* pDestDraw, INT32 nTileNumber, INT32 Start
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(1024, Render32x32Tile_Prio(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 10);
 
@@ -3953,6 +4193,8 @@ void Render32x32Tile_Prio_Mask_Clip(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(1024, Render32x32Tile_Prio_Clip(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 10);
 
@@ -4005,6 +4247,8 @@ void Render32x32Tile_Prio_Mask_FlipX(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipX called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(1024, Render32x32Tile_Prio_FlipX(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 10);
 
@@ -4053,6 +4297,8 @@ void Render32x32Tile_Prio_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nTileNumber,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipX_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(1024, Render32x32Tile_Prio_FlipX_Clip(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 10);
 
@@ -4105,6 +4351,8 @@ void Render32x32Tile_Prio_Mask_FlipY(UINT16* pDestDraw, INT32 nTileNumber, INT32
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipY called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(1024, Render32x32Tile_Prio_FlipY(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 10);
 
@@ -4153,6 +4401,8 @@ void Render32x32Tile_Prio_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nTileNumber,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipY_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(1024, Render32x32Tile_Prio_FlipY_Clip(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 10);
 
@@ -4205,6 +4455,8 @@ void Render32x32Tile_Prio_Mask_FlipXY(UINT16* pDestDraw, INT32 nTileNumber, INT3
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipXY called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(1024, Render32x32Tile_Prio_FlipXY(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 10);
 
@@ -4253,6 +4505,8 @@ void Render32x32Tile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nTileNumber,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("Render32x32Tile_Prio_Mask_FlipXY_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(1024, Render32x32Tile_Prio_FlipXY_Clip(pDestDraw, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber << 10);
 
@@ -4481,6 +4735,8 @@ void RenderCustomTile_Prio_Mask(UINT16* pDestDraw, INT32 nWidth, INT32 nHeight,
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(nWidth * nHeight, RenderCustomTile_Prio(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber * nWidth * nHeight);
 
@@ -4500,6 +4756,8 @@ void RenderCustomTile_Prio_Mask_Clip(UINT16* pDestDraw, INT32 nWidth, INT32 nHei
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(nWidth * nHeight, RenderCustomTile_Prio_Clip(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber * nWidth * nHeight);
 
@@ -4523,6 +4781,8 @@ void RenderCustomTile_Prio_Mask_FlipX(UINT16* pDestDraw, INT32 nWidth, INT32 nHe
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipX called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(nWidth * nHeight, RenderCustomTile_Prio_FlipX(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber * nWidth * nHeight);
 
@@ -4542,6 +4802,8 @@ void RenderCustomTile_Prio_Mask_FlipX_Clip(UINT16* pDestDraw, INT32 nWidth, INT3
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipX_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(nWidth * nHeight, RenderCustomTile_Prio_FlipX_Clip(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber * nWidth * nHeight);
 
@@ -4565,6 +4827,8 @@ void RenderCustomTile_Prio_Mask_FlipY(UINT16* pDestDraw, INT32 nWidth, INT32 nHe
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipY called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(nWidth * nHeight, RenderCustomTile_Prio_FlipY(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber * nWidth * nHeight);
 
@@ -4584,6 +4848,8 @@ void RenderCustomTile_Prio_Mask_FlipY_Clip(UINT16* pDestDraw, INT32 nWidth, INT3
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipY_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(nWidth * nHeight, RenderCustomTile_Prio_FlipY_Clip(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber * nWidth * nHeight);
 
@@ -4607,6 +4873,8 @@ void RenderCustomTile_Prio_Mask_FlipXY(UINT16* pDestDraw, INT32 nWidth, INT32 nH
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipXY called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(nWidth * nHeight, RenderCustomTile_Prio_FlipXY(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber * nWidth * nHeight);
 
@@ -4626,6 +4894,8 @@ void RenderCustomTile_Prio_Mask_FlipXY_Clip(UINT16* pDestDraw, INT32 nWidth, INT
 	if (!Debug_GenericTilesInitted) bprintf(PRINT_ERROR, _T("RenderCustomTile_Prio_Mask_FlipXY_Clip called without init\n"));
 #endif
 
+	OPACITY_FAST_PATH(nWidth * nHeight, RenderCustomTile_Prio_FlipXY_Clip(pDestDraw, nWidth, nHeight, nTileNumber, StartX, StartY, nTilePalette, nColourDepth, nPaletteOffset, nPriority, pTile));
+
 	UINT32 nPalette = (nTilePalette << nColourDepth) + nPaletteOffset;
 	pTileData = pTile + (nTileNumber * nWidth * nHeight);
 
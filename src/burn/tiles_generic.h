@@ -22,6 +22,13 @@ struct GenericTilesGfx {
 extern GenericTilesGfx GenericGfxData[];
 void GenericTilesSetGfx(INT32 nNum, UINT8 *GfxBase, INT32 nDepth, INT32 nTileWidth, INT32 nTileHeight, INT32 nGfxLen, UINT32 nColorOffset, UINT32 nColorMask);
 
+// optional per-tile opacity table, lets the masked renderers skip empty tiles and draw solid ones unmasked
+// only for graphics that are static or updated through GfxDecode / GfxDecodeSingle / GenericTilesUpdateGfxOpacity
+// opt-in per region (call after decoding), regions without a table are drawn as before
+void GenericTilesSetGfxOpacity(UINT8 *GfxBase, INT32 nTileWidth, INT32 nTileHeight, INT32 nGfxLen);
+void GenericTilesUpdateGfxOpacity(UINT8 *GfxBase, INT32 nTileWidth, INT32 nTileHeight, INT32 nStart, INT32 nCount);
+void GenericTilesClearGfxOpacity(); // called by GenericTilesExit()
+
 extern UINT8* pTileData;
 extern INT32 nScreenWidth, nScreenHeight;
 extern UINT8 GenericTilesPRIMASK;
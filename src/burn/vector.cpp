@@ -1,9 +1,14 @@
 // vector.cpp, by iq_132.  aa mods by dink
 #include "tiles_generic.h"
+#include "thready.h"
 #include "math.h"
 
 #define TABLE_SIZE  0x10000 // excessive?
 
+#define VECTOR_CACHE_SIZE		0x100	// rgb -> BurnHighCol() cache, per band
+#define VECTOR_BAND_MARGIN		8		// lines an anti-aliased beam can reach past its end points
+#define VECTOR_THREAD_HEIGHT	720		// rescaled to this height or more (and bBurnVideoThreading set), share the frame with a worker thread
+
 struct vector_line {
 	INT32 x;
 	INT32 y;
@@ -17,6 +22,21 @@ static INT32 vector_cnt;
 static UINT32 *pBitmap = NULL;
 static UINT32 *pPalette = NULL;
 
+// pBitmap is kept clear between frames, only the pixels between span_min[y] and span_max[y] get drawn,
+// converted and cleared again
+static INT32 *span_min = NULL;
+static INT32 *span_max = NULL;
+
+// a horizontal band of the screen, rasterized and converted on its own
+struct vector_band {
+	INT32 y0, y1;
+	UINT32 cache_rgb[VECTOR_CACHE_SIZE];
+	UINT32 cache_col[VECTOR_CACHE_SIZE];
+};
+
+static vector_band vector_bands[2];
+static INT32 vector_threading = 0;
+
 static INT32 clip_xmin, clip_xmax; // clipping for the final blit
 static INT32 clip_ymin, clip_ymax;
 
@@ -77,6 +97,38 @@ void vector_set_scale(INT32 x, INT32 y)
 		vector_scaleY = (float)nScreenHeight / y;
 }
 
+static void vector_alloc_bitmap()
+{
+	BurnFree(pBitmap);
+	BurnFree(span_min);
+	BurnFree(span_max);
+
+	pBitmap = (UINT32*)BurnMalloc(nScreenWidth * nScreenHeight * sizeof(INT32));
+	memset(pBitmap, 0, nScreenWidth * nScreenHeight * sizeof(INT32));
+
+	span_min = (INT32*)BurnMalloc(nScreenHeight * sizeof(INT32));
+	span_max = (INT32*)BurnMalloc(nScreenHeight * sizeof(INT32));
+
+	for (INT32 y = 0; y < nScreenHeight; y++) {
+		span_min[y] = nScreenWidth;
+		span_max[y] = -1;
+	}
+}
+
+static void vector_thread_cb();
+
+void vector_set_threading(INT32 enable)
+{
+	if (enable && !vector_threading) {
+		thready.init(vector_thread_cb);
+	}
+	if (!enable && vector_threading) {
+		thready.exit();
+	}
+
+	vector_threading = enable;
+}
+
 void vector_rescale(INT32 x, INT32 y)
 {
 	vector_rescaled = 1;
@@ -85,8 +137,7 @@ void vector_rescale(INT32 x, INT32 y)
 	BurnDrvSetVisibleSize(x, y);
 	Reinitialise();
 	BurnTransferRealloc();
-	BurnFree(pBitmap);
-	pBitmap = (UINT32*)BurnMalloc(nScreenWidth * nScreenHeight * sizeof(INT32));
+	vector_alloc_bitmap();
 
 	vector_set_clip(0, nScreenWidth, 0, nScreenHeight);
 
@@ -94,6 +145,8 @@ void vector_rescale(INT32 x, INT32 y)
 
 	// This is bit hacky, but thicker lines are more enjoyable at higher resolutions -barbudreadmon
 	vector_intens = (y / 480.0);
+
+	vector_set_threading(bBurnVideoThreading && y >= VECTOR_THREAD_HEIGHT);
 }
 
 void vector_resize_callback(INT32 width, INT32 height)
@@ -117,11 +170,15 @@ void vector_add_point(INT32 x, INT32 y, INT32 color, INT32 intensity)
 	vector_ptr->color = -1; // mark it as the last one to save some cycles later...
 }
 
-static inline void vector_draw_pixel(INT32 x, INT32 y, INT32 pixel)
+static inline void vector_draw_pixel(vector_band *band, INT32 x, INT32 y, INT32 pixel)
 {
-	if (x >= 0 && x < nScreenWidth && y >= 0 && y < nScreenHeight)
+	if (x >= 0 && x < nScreenWidth && y >= band->y0 && y < band->y1)
 	{
 		INT32 coords = y * nScreenWidth + x;
+
+		if (x < span_min[y]) span_min[y] = x;
+		if (x > span_max[y]) span_max[y] = x;
+
 		UINT32 d = pBitmap[coords];
 		pixel = pPalette[pixel];
 
@@ -170,13 +227,25 @@ static inline INT32 vec_mult(INT32 parm1, INT32 parm2) // stolen from mame, we n
 		return( result);
 }
 
-static void lineSimple(INT32 x0, INT32 y0, INT32 x1, INT32 y1, INT32 color, INT32 intensity)
+static void lineSimple(vector_band *band, INT32 x0, INT32 y0, INT32 x1, INT32 y1, INT32 color, INT32 intensity)
 {
 	color = color * 256 + intensity;
 	UINT32 p = pPalette[color];
 	if (p == 0) return; // safe to assume we can't draw black??
 	INT32 straight = 0;
 
+	{ // nothing to draw in this band?
+		INT32 ymin = (y0 < y1) ? y0 : y1;
+		INT32 ymax = (y0 < y1) ? y1 : y0;
+
+		if (vector_antialias) {
+			ymin = (ymin >> 16) - VECTOR_BAND_MARGIN;
+			ymax = (ymax >> 16) + VECTOR_BAND_MARGIN;
+		}
+
+		if (ymax < band->y0 || ymin >= band->y1) return;
+	}
+
 	if (x0 == x1 || y0 == y1) straight = 1;
 
 	if (vector_antialias == 0) {
@@ -190,7 +259,7 @@ static void lineSimple(INT32 x0, INT32 y0, INT32 x1, INT32 y1, INT32 color, INT3
 
 		while (1)
 		{
-			vector_draw_pixel(x0, y0, color);
+			vector_draw_pixel(band, x0, y0, color);
 
 			if (x0 == x1 && y0 == y1) break;
 
@@ -225,14 +294,14 @@ static void lineSimple(INT32 x0, INT32 y0, INT32 x1, INT32 y1, INT32 color, INT3
 				dy = y0 >> 16;
 				aa = (0xff - (0xff & (y0 >> 8))) - der;
 				CLAMP8(aa);
-				vector_draw_pixel(x0, dy++, (color & 0xff00) + gammaLUT[aa]);
+				vector_draw_pixel(band, x0, dy++, (color & 0xff00) + gammaLUT[aa]);
 				dx -= 0x10000 - (0xffff & y0);
 				aa = ((dx >> 8) & 0xff) - der;
 				dx >>= 16;
 				while (dx--)
-					vector_draw_pixel(x0, dy++, (color & 0xff00) + gammaLUT[color & 0xff]);
+					vector_draw_pixel(band, x0, dy++, (color & 0xff00) + gammaLUT[color & 0xff]);
 				CLAMP8(aa);
-				vector_draw_pixel(x0, dy, (color & 0xff00) + gammaLUT[aa]);
+				vector_draw_pixel(band, x0, dy, (color & 0xff00) + gammaLUT[aa]);
 				if (x0 == xx) break;
 				x0 += sx;
 				y0 += sy;
@@ -253,14 +322,14 @@ static void lineSimple(INT32 x0, INT32 y0, INT32 x1, INT32 y1, INT32 color, INT3
 				dx = x0 >> 16;
 				aa = (0xff - (0xff & (x0 >> 8))) - der;
 				CLAMP8(aa);
-				vector_draw_pixel(dx++, y0, (color & 0xff00) + gammaLUT[aa]);
+				vector_draw_pixel(band, dx++, y0, (color & 0xff00) + gammaLUT[aa]);
 				dy -= 0x10000 - (0xffff & x0);
 				aa = ((dy >> 8) & 0xff) - der;
 				dy >>= 16;
 				while (dy--)
-					vector_draw_pixel(dx++, y0, (color & 0xff00) + gammaLUT[color & 0xff]);
+					vector_draw_pixel(band, dx++, y0, (color & 0xff00) + gammaLUT[color & 0xff]);
 				CLAMP8(aa);
-				vector_draw_pixel(dx, y0, (color & 0xff00) + gammaLUT[aa]);
+				vector_draw_pixel(band, dx, y0, (color & 0xff00) + gammaLUT[aa]);
 				if (y0 == yy) break;
 				y0 += sy;
 				x0 += sx;
@@ -281,20 +350,12 @@ void vector_set_pix_cb(UINT32 (*cb)(INT32 x, INT32 y, UINT32 color))
 	pix_cb = cb;
 }
 
-void draw_vector(UINT32 *palette)
+static void vector_draw_band(vector_band *band)
 {
-	if (vector_rescaled) {
-		// don't draw this time around
-		vector_rescaled = 0;
-		return;
-	}
 	struct vector_line *ptr = &vector_table[0];
 
 	INT32 prev_x = 0, prev_y = 0;
 
-	memset (pBitmap, 0, nScreenWidth * nScreenHeight * sizeof(INT32));
-	pBurnDrvPalette = pPalette = palette;
-
 	for (INT32 i = 0; i < vector_cnt && i < TABLE_SIZE; i++, ptr++)
 	{
 		if (ptr->color == -1) break;
@@ -303,7 +364,7 @@ void draw_vector(UINT32 *palette)
 		INT32 curr_x = ptr->x * vector_scaleX;
 
 		if (ptr->intensity != 0) { // intensity 0 means turn off the beam...
-			lineSimple(curr_x, curr_y, prev_x, prev_y, ptr->color, ptr->intensity);
+			lineSimple(band, curr_x, curr_y, prev_x, prev_y, ptr->color, ptr->intensity);
 		}
 
 		prev_x = curr_x;
@@ -312,29 +373,85 @@ void draw_vector(UINT32 *palette)
 
 	// copy to the screen, only draw pixels that aren't black
 	// should be safe for any bit depth with putpix
+	memset(band->cache_rgb, 0, sizeof(band->cache_rgb));
+
+	INT32 pitch = nScreenWidth * nBurnBpp;
+	memset (pBurnDraw + band->y0 * pitch, 0, (band->y1 - band->y0) * pitch);
+
+	for (INT32 y = band->y0; y < band->y1; y++)
 	{
-		memset (pBurnDraw, 0, nScreenWidth * nScreenHeight * nBurnBpp);
+		if (span_max[y] < 0) continue;
 
-		for (INT32 y = 0; y < nScreenHeight; y++)
+		UINT32 idx = (y * nScreenWidth);
+		INT32 x0 = span_min[y];
+		INT32 x1 = span_max[y];
+
+		if (y >= clip_ymin && y <= clip_ymax)
 		{
-			if (y < clip_ymin || y > clip_ymax) continue;
-			UINT32 idx = (y * nScreenWidth);
+			INT32 sx = (x0 < clip_xmin) ? clip_xmin : x0;
+			INT32 ex = (x1 > clip_xmax) ? clip_xmax : x1;
 
-			for (INT32 x = 0; x < nScreenWidth; x++)
+			for (INT32 x = sx; x <= ex; x++)
 			{
-				if (x < clip_xmin || x > clip_xmax) continue;
-
 				UINT32 p = pBitmap[idx + x];
 
 				if (p) {
 					p = pix_cb(x, y, p);
-					PutPix(pBurnDraw + (idx + x) * nBurnBpp, BurnHighCol((p >> 16) & 0xff, (p >> 8) & 0xff, p & 0xff, 0));
+
+					UINT32 h = (p ^ (p >> 8) ^ (p >> 16)) & (VECTOR_CACHE_SIZE - 1);
+					if (band->cache_rgb[h] != p || p == 0) {
+						band->cache_rgb[h] = p;
+						band->cache_col[h] = BurnHighCol((p >> 16) & 0xff, (p >> 8) & 0xff, p & 0xff, 0);
+					}
+
+					PutPix(pBurnDraw + (idx + x) * nBurnBpp, band->cache_col[h]);
 				}
 			}
 		}
+
+		memset(pBitmap + idx + x0, 0, (x1 - x0 + 1) * sizeof(UINT32));
+		span_min[y] = nScreenWidth;
+		span_max[y] = -1;
 	}
 }
 
+static void vector_thread_cb()
+{
+	vector_draw_band(&vector_bands[1]);
+}
+
+void draw_vector(UINT32 *palette)
+{
+	if (vector_rescaled) {
+		// don't draw this time around
+		vector_rescaled = 0;
+		return;
+	}
+
+	pBurnDrvPalette = pPalette = palette;
+
+	if (vector_threading)
+	{
+		// the worker takes the bottom half, blending is additive so the bands don't depend on each other
+		INT32 split = nScreenHeight / 2;
+
+		vector_bands[0].y0 = 0;
+		vector_bands[0].y1 = split;
+		vector_bands[1].y0 = split;
+		vector_bands[1].y1 = nScreenHeight;
+
+		thready.notify();
+		vector_draw_band(&vector_bands[0]);
+		thready.notify_wait();
+		return;
+	}
+
+	vector_bands[0].y0 = 0;
+	vector_bands[0].y1 = nScreenHeight;
+
+	vector_draw_band(&vector_bands[0]);
+}
+
 void vector_reset()
 {
 	vector_cnt = 0;
@@ -350,7 +467,7 @@ void vector_init()
 
 	vector_set_clip(0, nScreenWidth, 0, nScreenHeight);
 
-	pBitmap = (UINT32*)BurnMalloc(nScreenWidth * nScreenHeight * sizeof(INT32));
+	vector_alloc_bitmap();
 
 	vector_table = (struct vector_line*)BurnMalloc(TABLE_SIZE * sizeof(vector_line));
 
@@ -373,11 +490,16 @@ void vector_init()
 void vector_exit()
 {
 	GenericTilesExit();
+
+	vector_set_threading(0);
 	
 	if (pBitmap) {
 		BurnFree (pBitmap);
 	}
 
+	BurnFree (span_min);
+	BurnFree (span_max);
+
 	pPalette = NULL;
 
 	BurnFree (vector_table);
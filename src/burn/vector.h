@@ -10,3 +10,4 @@ void vector_set_offsets(INT32 x, INT32 y);
 void vector_set_clip(INT32 xmin, INT32 xmax, INT32 ymin, INT32 ymax);
 void vector_set_pix_cb(UINT32 (*cb)(INT32, INT32, UINT32));
 void vector_rescale(INT32 x, INT32 y);
+void vector_set_threading(INT32 enable); // rasterize the bottom half of the screen on a worker thread
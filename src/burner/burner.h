@@ -258,6 +258,7 @@ INT32 BurnStateDecompress(UINT8* Def, INT32 nDefLen, INT32 bAll);
 // nvram.cpp
 INT32 BurnNvramLoad(TCHAR* szName);
 INT32 BurnNvramSave(TCHAR* szName);
+INT32 BurnNvramAutoSave(TCHAR* szName);
 
 // zipfn.cpp
 struct ZipEntry { char* szName;	UINT32 nLen; UINT32 nCrc; };
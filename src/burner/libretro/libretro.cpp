@@ -74,6 +74,7 @@ INT32 nAudSegLen = 0;
 
 static UINT8* pVidImage              = NULL;
 static bool bVidImageNeedRealloc     = false;
+static enum retro_pixel_format nVidImageFormat = RETRO_PIXEL_FORMAT_0RGB1555;
 static bool bRotationDone            = false;
 static int16_t *pAudBuffer           = NULL;
 static char text_missing_files[2048] = "";
@@ -1462,6 +1463,30 @@ static void VideoBufferInit()
 		memset(pVidImage, 0, nSize);
 }
 
+// Render straight into the frontend's framebuffer when it matches our format, size and pitch
+// (drivers assume rows are nGameWidth pixels apart), saving the frontend a copy of every frame.
+// Drivers may read back what they draw, so only cached memory is used.
+static UINT8* VideoBufferGet()
+{
+	struct retro_framebuffer fb;
+
+	memset(&fb, 0, sizeof(fb));
+	fb.width        = nGameWidth;
+	fb.height       = nGameHeight;
+	fb.access_flags = RETRO_MEMORY_ACCESS_WRITE | RETRO_MEMORY_ACCESS_READ;
+
+	if (environ_cb(RETRO_ENVIRONMENT_GET_CURRENT_SOFTWARE_FRAMEBUFFER, &fb)
+		&& fb.data != NULL
+		&& fb.format == nVidImageFormat
+		&& fb.width == (unsigned)nGameWidth
+		&& fb.height == (unsigned)nGameHeight
+		&& fb.pitch == (size_t)nBurnPitch
+		&& (fb.memory_flags & RETRO_MEMORY_TYPE_CACHED))
+		return (UINT8*)fb.data;
+
+	return pVidImage;
+}
+
 void retro_run()
 {
 	bool bEnableVideo  = true;
@@ -1570,7 +1595,7 @@ void retro_run()
 		bUpdateAudioLatency = false;
 	}
 
-	pBurnDraw = bEnableVideo && !bSkipFrame ? pVidImage : NULL; // Set to NULL to skip frame rendering
+	pBurnDraw = bEnableVideo && !bSkipFrame ? VideoBufferGet() : NULL; // Set to NULL to skip frame rendering
 	pBurnSoundOut = bEmulateAudio ? pAudBuffer : NULL; // Set to NULL to skip sound rendering
 
 	ForceFrameStep();
@@ -1582,6 +1607,10 @@ void retro_run()
 		audio_batch_cb(pBurnSoundOut, nBurnSoundLen);
 	}
 
+	// nothing was drawn, the frontend shows the previous frame again
+	if (bBurnFrameUnchanged)
+		pBurnDraw = NULL;
+
 	if (bVidImageNeedRealloc)
 	{
 		bVidImageNeedRealloc = false;
@@ -1718,6 +1747,7 @@ INT32 SetBurnHighCol(INT32 nDepth)
 		if(environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &fmt))
 		{
 			BurnHighCol = HighCol32;
+			nVidImageFormat = fmt;
 			nBurnBpp = 4;
 			return 0;
 		}
@@ -1727,6 +1757,7 @@ INT32 SetBurnHighCol(INT32 nDepth)
 	if(environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &fmt))
 	{
 		BurnHighCol = HighCol16;
+		nVidImageFormat = fmt;
 		nBurnBpp = 2;
 		return 0;
 	}
@@ -1735,6 +1766,7 @@ INT32 SetBurnHighCol(INT32 nDepth)
 	if(environ_cb(RETRO_ENVIRONMENT_SET_PIXEL_FORMAT, &fmt))
 	{
 		BurnHighCol = HighCol15;
+		nVidImageFormat = fmt;
 		nBurnBpp = 2;
 		return 0;
 	}
@@ -2208,6 +2240,10 @@ static bool retro_load_game_common()
 		// Libretro doesn't want the refresh rate to be limited to 60hz
 		bSpeedLimit60hz = false;
 
+		// Drivers may skip drawing frames that didn't change, we then hand the frontend a dupe
+		bool bCanDupe = false;
+		bBurnSkipUnchangedFrames = (environ_cb(RETRO_ENVIRONMENT_GET_CAN_DUPE, &bCanDupe) && bCanDupe) ? 1 : 0;
+
 		// Initialize game driver
 		if(BurnDrvInit() == 0)
 			HandleMessage(RETRO_LOG_INFO, "[FBNeo] Initialized driver for %s\n", g_driver_name);
@@ -2248,6 +2284,8 @@ static bool retro_load_game_common()
 				nCurrentFrame = 0;
 			}
 		}
+		// and keep it saved in the background, so a crash doesn't lose it
+		BurnNvramAutoSave(g_autofs_path);
 
 #ifndef NO_PGM2
 		retro_pgm2_cards_refresh_environment();
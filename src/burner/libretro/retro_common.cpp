@@ -97,6 +97,20 @@ static struct retro_core_option_v2_definition var_fbneo_allow_depth_32 = {
 	},
 	"enabled"
 };
+static struct retro_core_option_v2_definition var_fbneo_video_threading = {
+	"fbneo-video-threading",
+	"Threaded video rendering",
+	NULL,
+	"Render part of the screen on worker threads in games using rotate/zoom layers, in CPS-1/CPS-2 games, in Galactic Storm and in vector games rendered at 720p or more, it could improve performances on multi-core devices, closing & starting game again is required",
+	NULL,
+	"video",
+	{
+		{ "disabled", NULL },
+		{ "enabled",  NULL },
+		{ NULL,       NULL },
+	},
+	"disabled"
+};
 static struct retro_core_option_v2_definition var_fbneo_vertical_mode = {
 	"fbneo-vertical-mode",
 	"Vertical mode",
@@ -1053,6 +1067,10 @@ void set_environment()
 	var_fbneo_allow_depth_32.info                          = RETRO_DEPTH32_CAT_INFO;
 	vars_systems.push_back(&var_fbneo_allow_depth_32);
 
+	var_fbneo_video_threading.desc                         = RETRO_VIDEO_THREADING_DESC;
+	var_fbneo_video_threading.info                         = RETRO_VIDEO_THREADING_INFO;
+	vars_systems.push_back(&var_fbneo_video_threading);
+
 	var_fbneo_vertical_mode.desc                           = RETRO_VERTICAL_CAT_DESC;
 	var_fbneo_vertical_mode.info                           = RETRO_VERTICAL_CAT_INFO;
 	var_fbneo_vertical_mode.values[2].value                = RETRO_VERTICAL_VALUE_2;
@@ -1601,6 +1619,15 @@ void check_variables(void)
 			bAllowDepth32 = false;
 	}
 
+	var.key = var_fbneo_video_threading.key;
+	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+	{
+		if (strcmp(var.value, "enabled") == 0)
+			bBurnVideoThreading = 1;
+		else
+			bBurnVideoThreading = 0;
+	}
+
 	var.key = var_fbneo_vertical_mode.key;
 	if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
 	{
@@ -532,15 +532,21 @@ static const char* multi_language_strings[MAX_LANGUAGES][NUM_STRING] = {
 static const char* multi_language_strings_ext[MAX_LANGUAGES][NUM_STRING_EXT] = {
 	{
 		"Allow Ignore CRC",
-		"The prerequisite is to enable 'Allow patched romsets'. No longer strictly requiring Rom to have the correct CRC and file size to run, allowing Rom with the correct file name and file size to run. Resolve the issue of ROM not running due to CRC differences between new and old versions. Without CRC check, the loaded game content may not match the expected game content"
+		"The prerequisite is to enable 'Allow patched romsets'. No longer strictly requiring Rom to have the correct CRC and file size to run, allowing Rom with the correct file name and file size to run. Resolve the issue of ROM not running due to CRC differences between new and old versions. Without CRC check, the loaded game content may not match the expected game content",
+		"Threaded video rendering",
+		"Render part of the screen on worker threads in games using rotate/zoom layers, in CPS-1/CPS-2 games, in Galactic Storm and in vector games rendered at 720p or more, it could improve performances on multi-core devices, closing & starting game again is required"
 	},
 	{	// Simplified Chinese
 		"\u5141\u8bb8\u5ffd\u7565CRC",
-		"\u5148\u51b3\u6761\u4ef6\u662f\u542f\u7528'\u5141\u8bb8\u4fee\u8865\u96c6\u7ec4'.\u4e0d\u518d\u4e25\u683c\u8981\u6c42 ROM \u5177\u6709\u6b63\u786e\u7684 CRC \u548c\u6587\u4ef6\u5927\u5c0f\u624d\u80fd\u8fd0\u884c,\u5141\u8bb8\u5177\u6709\u6b63\u786e\u7684\u6587\u4ef6\u540d\u548c\u6587\u4ef6\u5927\u5c0f\u7684 ROM \u8fd0\u884c,\u89e3\u51b3\u7531\u4e8e\u65b0\u65e7\u7248\u672c\u4e4b\u95f4\u7684 CRC \u5dee\u5f02\u5bfc\u81f4 ROM \u65e0\u6cd5\u8fd0\u884c\u7684\u95ee\u9898.\u6ca1\u6709 CRC \u6821\u9a8c,\u52a0\u8f7d\u7684\u6e38\u620f\u5185\u5bb9\u53ef\u80fd\u4e0e\u9884\u671f\u7684\u6e38\u620f\u5185\u5bb9\u4e0d\u5339\u914d"
+		"\u5148\u51b3\u6761\u4ef6\u662f\u542f\u7528'\u5141\u8bb8\u4fee\u8865\u96c6\u7ec4'.\u4e0d\u518d\u4e25\u683c\u8981\u6c42 ROM \u5177\u6709\u6b63\u786e\u7684 CRC \u548c\u6587\u4ef6\u5927\u5c0f\u624d\u80fd\u8fd0\u884c,\u5141\u8bb8\u5177\u6709\u6b63\u786e\u7684\u6587\u4ef6\u540d\u548c\u6587\u4ef6\u5927\u5c0f\u7684 ROM \u8fd0\u884c,\u89e3\u51b3\u7531\u4e8e\u65b0\u65e7\u7248\u672c\u4e4b\u95f4\u7684 CRC \u5dee\u5f02\u5bfc\u81f4 ROM \u65e0\u6cd5\u8fd0\u884c\u7684\u95ee\u9898.\u6ca1\u6709 CRC \u6821\u9a8c,\u52a0\u8f7d\u7684\u6e38\u620f\u5185\u5bb9\u53ef\u80fd\u4e0e\u9884\u671f\u7684\u6e38\u620f\u5185\u5bb9\u4e0d\u5339\u914d",
+		"\u591a\u7ebf\u7a0b\u89c6\u9891\u6e32\u67d3",
+		"\u5728\u5de5\u4f5c\u7ebf\u7a0b\u4e0a\u6e32\u67d3\u90e8\u5206\u753b\u9762(\u65cb\u8f6c\u7f29\u653e\u56fe\u5c42\u548cCPS-1/CPS-2\u80cc\u666f\u56fe\u5c42),\u53ef\u5728\u591a\u6838\u8bbe\u5907\u4e0a\u63d0\u5347\u6027\u80fd,\u9700\u8981\u91cd\u65b0\u542f\u52a8\u6e38\u620f"
 	},
 	{	// Traditional Chinese
 		"\u5141\u8a31\u5ffd\u7565CRC",
-		"\u5148\u6c7a\u689d\u4ef6\u662f\u555f\u7528'\u5141\u8a31\u4fee\u88dc\u96c6\u7d44'.\u4e0d\u518d\u56b4\u683c\u8981\u6c42 ROM \u5177\u6709\u6b63\u78ba\u7684 CRC \u548c\u6587\u4ef6\u5927\u5c0f\u624d\u80fd\u904b\u884c,\u5141\u8a31\u5177\u6709\u6b63\u78ba\u7684\u6587\u4ef6\u540d\u548c\u6587\u4ef6\u5927\u5c0f\u7684 ROM \u904b\u884c,\u89e3\u6c7a\u7531\u65bc\u65b0\u820a\u7248\u672c\u4e4b\u9593\u7684 CRC \u5dee\u7570\u5c0e\u81f4 ROM \u7121\u6cd5\u904b\u884c\u7684\u554f\u984c.\u6c92\u6709 CRC \u6821\u9a57,\u52a0\u8f09\u7684\u904a\u6232\u5167\u5bb9\u53ef\u80fd\u8207\u9810\u671f\u7684\u904a\u6232\u5167\u5bb9\u4e0d\u5339\u914d"
+		"\u5148\u6c7a\u689d\u4ef6\u662f\u555f\u7528'\u5141\u8a31\u4fee\u88dc\u96c6\u7d44'.\u4e0d\u518d\u56b4\u683c\u8981\u6c42 ROM \u5177\u6709\u6b63\u78ba\u7684 CRC \u548c\u6587\u4ef6\u5927\u5c0f\u624d\u80fd\u904b\u884c,\u5141\u8a31\u5177\u6709\u6b63\u78ba\u7684\u6587\u4ef6\u540d\u548c\u6587\u4ef6\u5927\u5c0f\u7684 ROM \u904b\u884c,\u89e3\u6c7a\u7531\u65bc\u65b0\u820a\u7248\u672c\u4e4b\u9593\u7684 CRC \u5dee\u7570\u5c0e\u81f4 ROM \u7121\u6cd5\u904b\u884c\u7684\u554f\u984c.\u6c92\u6709 CRC \u6821\u9a57,\u52a0\u8f09\u7684\u904a\u6232\u5167\u5bb9\u53ef\u80fd\u8207\u9810\u671f\u7684\u904a\u6232\u5167\u5bb9\u4e0d\u5339\u914d",
+		"\u591a\u57f7\u884c\u7dd2\u8996\u8a0a\u6e32\u67d3",
+		"\u5728\u5de5\u4f5c\u57f7\u884c\u7dd2\u4e0a\u6e32\u67d3\u90e8\u5206\u756b\u9762(\u65cb\u8f49\u7e2e\u653e\u5716\u5c64\u548cCPS-1/CPS-2\u80cc\u666f\u5716\u5c64),\u53ef\u5728\u591a\u6838\u5fc3\u88dd\u7f6e\u4e0a\u63d0\u5347\u6548\u80fd,\u9700\u8981\u91cd\u65b0\u555f\u52d5\u904a\u6232"
 	}
 };
 
@@ -40,43 +40,54 @@ static INT32 NvramInfo(int* pnLen)
 INT32 BurnNvramLoad(TCHAR* szName)
 {
 	INT32 nLen = 0;
-	char ReadHeader[8];
 
-	FILE* fp = _tfopen(szName, _T("rb"));
-	if (fp == NULL) {
+	NvramInfo(&nLen);
+
+	if (nLen <= 0) {
 		return 1;
 	}
 
-	// abort the loading of older headered/compressed nvrams
-	memset(ReadHeader, 0, 8);
-	fread(ReadHeader, 1, 8, fp);
-	if (memcmp(ReadHeader, "FB1 FS1 ", 8) == 0) {
-		fclose(fp);
+	UINT8 *data = (UINT8*)malloc(nLen);
+	if (data == NULL) {
 		return 1;
 	}
-	fseek(fp, 0L, SEEK_SET);
 
-	fseek(fp, 0L, SEEK_END);
-	nLen = ftell(fp);
-	fseek(fp, 0L, SEEK_SET);
+	// start from the current contents, a short file only replaces what it has
+	BurnAcb = NvramSaveAcb;
+	pNvramData = data;
+	BurnAreaScan(ACB_NVRAM | ACB_READ, NULL);
 
-	UINT8 *data = (UINT8*)malloc(nLen);
-	if (data == NULL) {
-		fclose(fp);
+	INT32 nRead = BurnPersistLoad(szName, data, nLen);
+
+	// abort the loading of older headered/compressed nvrams
+	if (nRead < 0 || (nRead >= 8 && memcmp(data, "FB1 FS1 ", 8) == 0)) {
+		free(data);
 		return 1;
 	}
-	fread(data, 1, nLen, fp);
-	fclose(fp);
 
 	BurnAcb = NvramLoadAcb;
 	pNvramData = data;
 	BurnAreaScan(ACB_NVRAM | ACB_WRITE, NULL);
 
-	if (data) {
-		free(data);
-		data = NULL;
+	free(data);
+
+	return 0;
+}
+
+static INT32 NvramSnapshot(UINT8 *pDest, INT32 nLen)
+{
+	INT32 nCurrentLen = 0;
+
+	NvramInfo(&nCurrentLen);
+
+	if (nCurrentLen != nLen) {
+		return 1;
 	}
 
+	BurnAcb = NvramSaveAcb;
+	pNvramData = pDest;
+	BurnAreaScan(ACB_NVRAM | ACB_READ, NULL);
+
 	return 0;
 }
 
@@ -91,33 +102,27 @@ INT32 BurnNvramSave(TCHAR* szName)
 		return 1;
 	}
 
-	FILE* fp = _tfopen(szName, _T("wb"));
-	if (fp == NULL) {
-		return 1;
-	}
-
 	UINT8 *data = (UINT8*)malloc(nLen);
 	if (data == NULL) {
-		fclose(fp);
 		return 1;
 	}
 
-	BurnAcb = NvramSaveAcb;
-	pNvramData = data;
-	BurnAreaScan(ACB_NVRAM | ACB_READ, NULL);
+	NvramSnapshot(data, nLen);
 
-	nRet = fwrite(data, 1, nLen, fp);
+	nRet = BurnPersistSave(szName, data, nLen);
 
-	fclose(fp);
+	free(data);
 
-	if (data) {
-		free(data);
-		data = NULL;
-	}
+	return nRet ? 1 : 0;
+}
 
-	if (nRet != nLen) {
-		return 1;
-	}
+// keep szName up to date in the background while the game runs (see burn_persist.cpp),
+// the final write at exit is still BurnNvramSave()
+INT32 BurnNvramAutoSave(TCHAR* szName)
+{
+	INT32 nLen = 0;
 
-	return 0;
+	NvramInfo(&nLen);
+
+	return (BurnPersistAdd(szName, nLen, NvramSnapshot) < 0) ? 1 : 0;
 }
@@ -117,12 +117,14 @@ int ConfigAppLoad()
 		VAR(gameSelectedFromFilter);
 #endif
 		VAR(bVidScanlines);
+		VAR(bBurnVideoThreading);
 		VAR(bDoGamma);
 		FLT(nGamma);
 		VAR(nAudSampleRate[0]);
 		VAR(nAudDSPModule[0]);
 		VAR(nInterpolation);
 		VAR(nFMInterpolation);
+		VAR(nFMSynthesis);
 		VAR(EnableHiscores);
 		// Other
 		STR(szAppRomPaths[0]);
@@ -224,6 +226,8 @@ int ConfigAppSave()
 #endif
 	fprintf(f, "\n// If non-zero, enable scanlines\n");
 	VAR(bVidScanlines);
+	fprintf(f, "\n// If non-zero, let the roz, CPS layer, vector and polygon renderers use worker threads\n");
+	VAR(bBurnVideoThreading);
 	fprintf(f, "\n// If non-zero, enable software gamma correction\n");
 	VAR(bDoGamma);
 	_ftprintf(f, _T("\n// Gamma to correct with\n"));
@@ -236,6 +240,8 @@ int ConfigAppSave()
 	VAR(nInterpolation);
 	_ftprintf(f, _T("\n// The order of FM interpolation\n"));
 	VAR(nFMInterpolation);
+	_ftprintf(f, _T("\n// FM operator path (0 = scalar, 1 = SIMD, 2 = SIMD checked against scalar)\n"));
+	VAR(nFMSynthesis);
 	_ftprintf(f, _T("\n// If non-zero, enable high score saving support.\n"));
 	VAR(EnableHiscores);
 
@@ -296,6 +296,7 @@ int ConfigAppLoad()
 		VAR(bVidDX9WinFullscreen);
 		VAR(bVidVSync);
 		VAR(bVidDWMSync);
+		VAR(bBurnVideoThreading);
 
 		VAR(bVidScanlines);
 		VAR(nVidScanIntensity);
@@ -359,6 +360,7 @@ int ConfigAppLoad()
 		VAR(nAudSegCount);
 		VAR(nInterpolation);
 		VAR(nFMInterpolation);
+		VAR(nFMSynthesis);
 		VAR(nAudSampleRate[0]);
 		VAR(nAudDSPModule[0]);
 		VAR(nAudSampleRate[1]);
@@ -666,6 +668,8 @@ int ConfigAppSave()
 	VAR(bVidVSync);
 	_ftprintf(h, _T("\n// If non-zero, try to synchronise to DWM on Windows 7+, this fixes frame stuttering problems.\n"));
 	VAR(bVidDWMSync);
+	_ftprintf(h, _T("\n// If non-zero, let the roz, CPS layer, vector and polygon renderers use worker threads\n"));
+	VAR(bBurnVideoThreading);
 	_ftprintf(h, _T("\n// Transfer method:  0 = blit from system memory / use driver/DirectX texture management;\n"));
 	_ftprintf(h, _T("//                   1 = copy to a video memory surface, then use bltfast();\n"));
 	_ftprintf(h, _T("//                  -1 = autodetect for DirectDraw, equals 1 for Direct3D\n"));
@@ -760,6 +764,8 @@ int ConfigAppSave()
 	VAR(nInterpolation);
 	_ftprintf(h, _T("\n// The order of FM interpolation\n"));
 	VAR(nFMInterpolation);
+	_ftprintf(h, _T("\n// FM operator path (0 = scalar, 1 = SIMD, 2 = SIMD checked against scalar)\n"));
+	VAR(nFMSynthesis);
 	_ftprintf(h, _T("\n"));
 	_ftprintf(h, _T("// --- DirectSound plugin settings --------------------------------------------\n"));
 	_ftprintf(h, _T("\n// Sample rate\n"));
@@ -170,11 +170,16 @@ void Arm7Reset()
     arm7_core_reset();
 }
 
-/*
-static void arm7_exit()
+void arm7_exit()
 {
-    
-}*/
+    // must call core exit
+    arm7_decode_exit();
+}
+
+void arm7_fetch_flush()
+{
+    arm7_decode_flush();
+}
 
 int Arm7Run(int cycles)
 {
@@ -92,6 +92,11 @@
 
 #define ARM7_INLINE	static inline
 
+/* ARM9_MODE is defined by the including file (arm9.cpp sets it to 1) */
+#ifndef ARM9_MODE
+#define ARM9_MODE 0
+#endif
+
 /* Prototypes */
 
 // SJE: should these be inline? or are they too big to see any benefit?
@@ -229,6 +234,207 @@ ARM7_INLINE UINT32 cpu_readop16(UINT32 addr)
     return result;
 }
 
+/***************************************************************************
+ * Pre-decoded instruction pages
+ *
+ * ARM words fetched from directly mapped pages are decoded once into an
+ * instruction class + condition and kept per 4kb page.  Every entry carries
+ * the word it was decoded from and is compared against the word in memory
+ * on each fetch, so writes to code pages (by the cpu itself or by the host
+ * side, e.g. the 68k filling shared ram) drop the stale entry.  Fetches that
+ * go through a handler or hit the idle loop page stay on the slow path.
+ ***************************************************************************/
+
+/* condition passes, indexed by the condition field, one bit per NZCV value */
+static const UINT16 arm7_cond_table[16] = {
+    0xf0f0, 0x0f0f, 0xcccc, 0x3333, 0xff00, 0x00ff, 0xaaaa, 0x5555,
+    0x0c0c, 0xf3f3, 0xaa55, 0x55aa, 0x0a05, 0xf5fa, 0xffff, 0x0000
+};
+
+#define ARM7_COND_PASSED(cond)  ((arm7_cond_table[cond] >> (GET_CPSR >> 28)) & 1)
+
+static ARM7_DECODE_PAGE **arm7_decode_map = NULL;
+static ARM7_DECODE_PAGE *arm7_decode_page = NULL;   // page of the current fetch
+static UINT8 *arm7_decode_mem = NULL;               // host memory of that page, NULL = slow path
+static UINT32 arm7_decode_addr = ~0;                // (address >> ARM7_DECODE_SHIFT) of that page
+
+static void arm7_decode_insn(ARM7_DECODED *dec)
+{
+    UINT32 insn = dec->insn;
+
+    dec->cond = insn >> INSN_COND_SHIFT;
+
+#if ARM9_MODE
+    /* BLX (immediate) lives in the NV space and is unconditional */
+    if ((insn & 0xfe000000) == 0xfa000000)
+    {
+        dec->cond = COND_AL;
+        dec->op = ARM7_OP_BLX_IMM;
+        return;
+    }
+#endif
+
+    switch ((insn & 0xF000000) >> 24)
+    {
+        case 0:
+        case 1:
+        case 2:
+        case 3:
+#if ARM9_MODE
+            if ((insn & 0x0ffffff0) == 0x012fff30)
+                dec->op = ARM7_OP_BLX_REG;
+            else if ((insn & 0x0fff0ff0) == 0x016f0f10)
+                dec->op = ARM7_OP_CLZ;
+            else if ((insn & 0x0ffffff0) == 0x012fff10)
+                dec->op = ARM7_OP_BX;
+            else if ((insn & 0x0ff00090) == 0x01000080)
+                dec->op = ARM7_OP_SMLAXY;
+            else if ((insn & 0x0ff00090) == 0x01400080)
+                dec->op = ARM7_OP_SMLALXY;
+            else if ((insn & 0x0ff00090) == 0x01600080)
+                dec->op = ARM7_OP_SMULXY;
+            else if ((insn & 0x0ff000b0) == 0x012000a0)
+                dec->op = ARM7_OP_SMULWY;
+            else if ((insn & 0x0ff000b0) == 0x01200080)
+                dec->op = ARM7_OP_SMLAWY;
+            else if ((insn & 0x0f9000f0) == 0x01000050)
+                dec->op = ARM7_OP_QARITH;
+            else
+#else
+            if ((insn & 0x0ffffff0) == 0x012fff10)
+                dec->op = ARM7_OP_BX;
+            else
+#endif
+            /* Multiply OR Swap OR Half Word Data Transfer */
+            if ((insn & 0x0e000000) == 0 && (insn & 0x80) && (insn & 0x10))
+            {
+                if (insn & 0x60)
+                    dec->op = ARM7_OP_HALFDT;
+                else if (insn & 0x01000000)
+                    dec->op = ARM7_OP_SWAP;
+                else if (insn & 0x800000)
+                    dec->op = (insn & 0x00400000) ? ARM7_OP_SMULL : ARM7_OP_UMULL;
+                else
+                    dec->op = ARM7_OP_MUL;
+            }
+            /* PSR Transfer (MRS & MSR) - S bit clear, bit 24,23 = 10 */
+            else if (((insn & 0x00100000) == 0) && ((insn & 0x01800000) == 0x01000000))
+                dec->op = ARM7_OP_PSR;
+            else
+                dec->op = ARM7_OP_ALU;
+            break;
+        case 4:
+        case 5:
+        case 6:
+        case 7:
+            dec->op = ARM7_OP_MEMSINGLE;
+            break;
+        case 8:
+        case 9:
+            dec->op = ARM7_OP_MEMBLOCK;
+            break;
+        case 0xa:
+        case 0xb:
+            dec->op = ARM7_OP_BRANCH;
+            break;
+        case 0xc:
+        case 0xd:
+            dec->op = ARM7_OP_CPDT;
+            break;
+        case 0xe:
+            dec->op = (insn & 0x10) ? ARM7_OP_CPRT : ARM7_OP_CPDO;
+            break;
+        default:
+            dec->op = ARM7_OP_SWI;
+            break;
+    }
+}
+
+static void arm7_decode_select(UINT32 addr)
+{
+    UINT32 page = (addr & 0x7fffffff) >> ARM7_DECODE_SHIFT;
+
+    arm7_decode_addr = addr >> ARM7_DECODE_SHIFT;
+    arm7_decode_mem = Arm7GetFetchPage(addr);
+    arm7_decode_page = NULL;
+
+    if (arm7_decode_mem == NULL) return;
+
+    if (arm7_decode_map == NULL) {
+        arm7_decode_map = (ARM7_DECODE_PAGE**)calloc(ARM7_DECODE_PAGES, sizeof(ARM7_DECODE_PAGE*));
+    }
+
+    if (arm7_decode_map && arm7_decode_map[page] == NULL) {
+        arm7_decode_map[page] = (ARM7_DECODE_PAGE*)calloc(1, sizeof(ARM7_DECODE_PAGE));
+    }
+
+    if (arm7_decode_map == NULL || arm7_decode_map[page] == NULL) {
+        arm7_decode_mem = NULL;
+        return;
+    }
+
+    arm7_decode_page = arm7_decode_map[page];
+}
+
+// the fetch map changed (mapping, banking or idle loop address), re-select on the next fetch
+static void arm7_decode_flush(void)
+{
+    arm7_decode_addr = ~0;
+    arm7_decode_page = NULL;
+    arm7_decode_mem = NULL;
+}
+
+static void arm7_decode_exit(void)
+{
+    if (arm7_decode_map) {
+        for (INT32 i = 0; i < ARM7_DECODE_PAGES; i++) {
+            if (arm7_decode_map[i]) free(arm7_decode_map[i]);
+        }
+
+        free(arm7_decode_map);
+        arm7_decode_map = NULL;
+    }
+
+    arm7_decode_flush();
+}
+
+// fetch + decode an ARM instruction, tmp receives the result on the slow path
+ARM7_INLINE const ARM7_DECODED *arm7_decode_fetch32(UINT32 addr, ARM7_DECODED *tmp)
+{
+    if ((addr >> ARM7_DECODE_SHIFT) != arm7_decode_addr)
+        arm7_decode_select(addr);
+
+    if (arm7_decode_mem && (addr & 3) == 0)
+    {
+        UINT32 insn = BURN_ENDIAN_SWAP_INT32(*((UINT32*)(arm7_decode_mem + (addr & (ARM7_DECODE_SIZE - 4)))));
+        ARM7_DECODED *dec = &arm7_decode_page->arm[(addr & (ARM7_DECODE_SIZE - 1)) >> 2];
+
+        if (dec->insn != insn || dec->op == ARM7_OP_NONE)
+        {
+            dec->insn = insn;
+            arm7_decode_insn(dec);
+        }
+
+        return dec;
+    }
+
+    tmp->insn = cpu_readop32(addr);
+    arm7_decode_insn(tmp);
+
+    return tmp;
+}
+
+ARM7_INLINE UINT32 arm7_decode_fetch16(UINT32 addr)
+{
+    if ((addr >> ARM7_DECODE_SHIFT) != arm7_decode_addr)
+        arm7_decode_select(addr);
+
+    if (arm7_decode_mem)
+        return BURN_ENDIAN_SWAP_INT16(*((UINT16*)(arm7_decode_mem + (addr & (ARM7_DECODE_SIZE - 2)))));
+
+    return cpu_readop16(addr);
+}
+
 /***************
  * helper funcs
  ***************/
@@ -366,6 +366,53 @@ enum
     COND_NV               /*  0           never                   */
 };
 
+/* Pre-decoded instruction classes (what the execute loop dispatches on) */
+enum
+{
+    ARM7_OP_NONE = 0,     /* entry not decoded yet */
+    ARM7_OP_ALU,
+    ARM7_OP_PSR,
+    ARM7_OP_MUL,
+    ARM7_OP_SMULL,
+    ARM7_OP_UMULL,
+    ARM7_OP_SWAP,
+    ARM7_OP_HALFDT,
+    ARM7_OP_BX,
+    ARM7_OP_MEMSINGLE,
+    ARM7_OP_MEMBLOCK,
+    ARM7_OP_BRANCH,
+    ARM7_OP_CPDT,
+    ARM7_OP_CPRT,
+    ARM7_OP_CPDO,
+    ARM7_OP_SWI,
+    /* ARMv5TE (ARM9_MODE) */
+    ARM7_OP_BLX_IMM,
+    ARM7_OP_BLX_REG,
+    ARM7_OP_CLZ,
+    ARM7_OP_SMLAXY,
+    ARM7_OP_SMLALXY,
+    ARM7_OP_SMULXY,
+    ARM7_OP_SMULWY,
+    ARM7_OP_SMLAWY,
+    ARM7_OP_QARITH
+};
+
+#define ARM7_DECODE_SHIFT   12                          /* same 4kb pages as the memory map */
+#define ARM7_DECODE_SIZE    (1 << ARM7_DECODE_SHIFT)
+#define ARM7_DECODE_PAGES   (0x80000000 >> ARM7_DECODE_SHIFT)
+
+typedef struct
+{
+    UINT32 insn;          /* instruction word the entry was decoded from */
+    UINT8  op;            /* ARM7_OP_* */
+    UINT8  cond;          /* condition field, COND_AL for the unconditional ARMv5 forms */
+} ARM7_DECODED;
+
+typedef struct
+{
+    ARM7_DECODED arm[ARM7_DECODE_SIZE / 4];
+} ARM7_DECODE_PAGE;
+
 #define LSL(v, s) ((v) << (s))
 #define LSR(v, s) ((v) >> (s))
 #define ROL(v, s) (LSL((v), (s)) | (LSR((v), 32u - (s))))
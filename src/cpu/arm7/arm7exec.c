@@ -43,6 +43,8 @@
 {
     UINT32 pc;
     UINT32 insn;
+    const ARM7_DECODED *dec;
+    ARM7_DECODED dec_tmp;
     /* ARM9_MODE is defined by the including file (arm9.cpp sets it to 1, arm7.cpp to 0) */
 #ifndef ARM9_MODE
 #define ARM9_MODE 0
@@ -68,7 +70,7 @@
             INT32 offs;
 
             pc = R15;
-            insn = cpu_readop16(pc & (~1));
+            insn = arm7_decode_fetch16(pc & (~1));
             ARM7_ICOUNT -= (3 - thumbCycles[insn >> 8]);
             switch ((insn & THUMB_INSN_TYPE) >> THUMB_INSN_TYPE_SHIFT)
             {
@@ -1229,378 +1231,277 @@
         else
         {
 
-            /* load 32 bit instruction */
+            /* load 32 bit instruction (pre-decoded when the page allows it) */
             pc = R15;
-            insn = cpu_readop32(pc);
-
-#if ARM9_MODE
-            /* ARMv5TE: BLX (immediate) uses condition field = 0xF (NV space re-used)
-               Encoding: 1111 101H offset_24  -- unconditional branch with link, switch to THUMB */
-            if ((insn >> 28) == 0xf && ((insn >> 25) & 7) == 5)
-            {
-                INT32 offset = ((insn & 0x00ffffff) << 2) | ((insn >> 24) & 1) << 1;
-                if (offset & 0x02000000) offset |= 0xfc000000; /* sign extend 26-bit */
-                SET_REGISTER(14, R15 + 4);
-                R15 = (R15 + 8 + offset) & ~1;
-                SET_CPSR(GET_CPSR | T_MASK); /* switch to THUMB */
-                ARM7_ICOUNT -= 3;
-                goto L_EndInstruction;
-            }
-#endif
+            dec = arm7_decode_fetch32(pc, &dec_tmp);
+            insn = dec->insn;
 
             /* process condition codes for this instruction */
-            switch (insn >> INSN_COND_SHIFT)
-            {
-            case COND_EQ:
-                if (Z_IS_CLEAR(GET_CPSR))
-                    goto L_Next;
-                break;
-            case COND_NE:
-                if (Z_IS_SET(GET_CPSR))
-                    goto L_Next;
-                break;
-            case COND_CS:
-                if (C_IS_CLEAR(GET_CPSR))
-                    goto L_Next;
-                break;
-            case COND_CC:
-                if (C_IS_SET(GET_CPSR))
-                    goto L_Next;
-                break;
-            case COND_MI:
-                if (N_IS_CLEAR(GET_CPSR))
-                    goto L_Next;
-                break;
-            case COND_PL:
-                if (N_IS_SET(GET_CPSR))
-                    goto L_Next;
-                break;
-            case COND_VS:
-                if (V_IS_CLEAR(GET_CPSR))
-                    goto L_Next;
-                break;
-            case COND_VC:
-                if (V_IS_SET(GET_CPSR))
-                    goto L_Next;
-                break;
-            case COND_HI:
-                if (C_IS_CLEAR(GET_CPSR) || Z_IS_SET(GET_CPSR))
-                    goto L_Next;
-                break;
-            case COND_LS:
-                if (C_IS_SET(GET_CPSR) && Z_IS_CLEAR(GET_CPSR))
-                    goto L_Next;
-                break;
-            case COND_GE:
-                if (!(GET_CPSR & N_MASK) != !(GET_CPSR & V_MASK)) /* Use x ^ (x >> ...) method */
-                    goto L_Next;
-                break;
-            case COND_LT:
-                if (!(GET_CPSR & N_MASK) == !(GET_CPSR & V_MASK))
-                    goto L_Next;
-                break;
-            case COND_GT:
-                if (Z_IS_SET(GET_CPSR) || (!(GET_CPSR & N_MASK) != !(GET_CPSR & V_MASK)))
-                    goto L_Next;
-                break;
-            case COND_LE:
-                if (Z_IS_CLEAR(GET_CPSR) && (!(GET_CPSR & N_MASK) == !(GET_CPSR & V_MASK)))
-                  goto L_Next;
-                break;
-            case COND_NV:
-#if ARM9_MODE
-                /* ARMv5: condition 0xF encodes unconditional instructions */
-                /* BLX (immediate): 1111 101H offset_24 */
-                if ((insn & 0x0E000000) == 0x0A000000) {
-                    /* H bit (bit 24) adds 2 to target for Thumb halfword alignment */
-                    INT32 off = (INT32)(insn << 8) >> 6;  /* sign-extend 24-bit offset, x4 */
-                    if (insn & 0x01000000) off |= 2;      /* H bit */
-                    SET_REGISTER(14, (R15 + 4));           /* LR = return address */
-                    R15 = (R15 + 8 + off);                 /* target = PC+8+offset */
-                    SET_CPSR(GET_CPSR | T_MASK);           /* switch to Thumb mode */
-                } else {
-                    /* PLD, CDP2, MCR2, MRC2, STC2, LDC2: treat as NOP */
-                }
+            if (!ARM7_COND_PASSED(dec->cond))
                 goto L_Next;
-#else
-                goto L_Next;
-#endif
-            }
+
             /*******************************************************************/
-            /* If we got here - condition satisfied, so decode the instruction */
+            /* If we got here - condition satisfied, so execute the instruction */
             /*******************************************************************/
-            switch ((insn & 0xF000000) >> 24)
+            switch (dec->op)
             {
-                case 0:
-                case 1:
-                case 2:
-                case 3:
 #if ARM9_MODE
-                    /* ARMv5TE: BLX Rm - Branch with Link and Exchange (register) */
-                    /* Encoding: cond 0001 0010 1111 1111 1111 0011 Rm */
-                    if ((insn & 0x0ffffff0) == 0x012fff30)
-                    {
-                        UINT32 rm_val = GET_REGISTER(insn & 0x0f);
-                        /* LR = addr of next instruction (PC+4, no thumb adjustment) */
-                        SET_REGISTER(14, (R15 + 4) & ~1);
-                        /* Switch to THUMB if bit 0 of Rm is set */
-                        if (rm_val & 1) {
-                            SET_CPSR(GET_CPSR | T_MASK);
-                            R15 = rm_val & ~1;
-                        } else {
-                            SET_CPSR(GET_CPSR & ~T_MASK);
-                            R15 = rm_val & ~3;
-                        }
+                /* ARMv5TE: BLX (immediate) uses condition field = 0xF (NV space re-used)
+                   Encoding: 1111 101H offset_24  -- unconditional branch with link, switch to THUMB */
+                case ARM7_OP_BLX_IMM:
+                {
+                    INT32 offset = ((insn & 0x00ffffff) << 2) | ((insn >> 24) & 1) << 1;
+                    if (offset & 0x02000000) offset |= 0xfc000000; /* sign extend 26-bit */
+                    SET_REGISTER(14, R15 + 4);
+                    R15 = (R15 + 8 + offset) & ~1;
+                    SET_CPSR(GET_CPSR | T_MASK); /* switch to THUMB */
+                    ARM7_ICOUNT -= 3;
+                    goto L_EndInstruction;
+                }
+                /* ARMv5TE: BLX Rm - Branch with Link and Exchange (register) */
+                /* Encoding: cond 0001 0010 1111 1111 1111 0011 Rm */
+                case ARM7_OP_BLX_REG:
+                {
+                    UINT32 rm_val = GET_REGISTER(insn & 0x0f);
+                    /* LR = addr of next instruction (PC+4, no thumb adjustment) */
+                    SET_REGISTER(14, (R15 + 4) & ~1);
+                    /* Switch to THUMB if bit 0 of Rm is set */
+                    if (rm_val & 1) {
+                        SET_CPSR(GET_CPSR | T_MASK);
+                        R15 = rm_val & ~1;
+                    } else {
+                        SET_CPSR(GET_CPSR & ~T_MASK);
+                        R15 = rm_val & ~3;
                     }
-                    /* ARMv5TE: CLZ Rd, Rm - Count Leading Zeros */
-                    /* Encoding: cond 0001 0110 1111 Rd 1111 0001 Rm */
-                    else if ((insn & 0x0fff0ff0) == 0x016f0f10)
-                    {
-                        UINT32 rm_val = GET_REGISTER(insn & 0x0f);
-                        UINT32 rd = (insn >> 12) & 0x0f;
-                        UINT32 count = 0;
-                        if (rm_val == 0) {
-                            count = 32;
-                        } else {
-                            while ((rm_val & 0x80000000) == 0) { count++; rm_val <<= 1; }
-                        }
-                        SET_REGISTER(rd, count);
-                        R15 += 4;
+                    break;
+                }
+                /* ARMv5TE: CLZ Rd, Rm - Count Leading Zeros */
+                /* Encoding: cond 0001 0110 1111 Rd 1111 0001 Rm */
+                case ARM7_OP_CLZ:
+                {
+                    UINT32 rm_val = GET_REGISTER(insn & 0x0f);
+                    UINT32 rd = (insn >> 12) & 0x0f;
+                    UINT32 count = 0;
+                    if (rm_val == 0) {
+                        count = 32;
+                    } else {
+                        while ((rm_val & 0x80000000) == 0) { count++; rm_val <<= 1; }
                     }
-                    /* Branch and Exchange (BX) */
-                    else if ((insn & 0x0ffffff0) == 0x012fff10)
-                    {
-                        UINT32 rm_val = GET_REGISTER(insn & 0x0f);
-                        if (rm_val & 1) {
-                            SET_CPSR(GET_CPSR | T_MASK);
-                            R15 = rm_val & ~1;
-                        } else {
-                            SET_CPSR(GET_CPSR & ~T_MASK);
-                            R15 = rm_val & ~3;
-                        }
+                    SET_REGISTER(rd, count);
+                    R15 += 4;
+                    break;
+                }
+                /* Branch and Exchange (BX) */
+                case ARM7_OP_BX:
+                {
+                    UINT32 rm_val = GET_REGISTER(insn & 0x0f);
+                    if (rm_val & 1) {
+                        SET_CPSR(GET_CPSR | T_MASK);
+                        R15 = rm_val & ~1;
+                    } else {
+                        SET_CPSR(GET_CPSR & ~T_MASK);
+                        R15 = rm_val & ~3;
                     }
-                    else
-                    /* ARMv5TE: Enhanced DSP multiply instructions */
-                    if ((insn & 0x0ff00090) == 0x01000080)  /* SMLAxy */
-                    {
-                        UINT32 rm = insn & 0x0f;
-                        UINT32 rs = (insn >> 8) & 0x0f;
-                        UINT32 rn = (insn >> 12) & 0x0f;
-                        UINT32 rd = (insn >> 16) & 0x0f;
-                        INT32 rm_val = (INT32)GET_REGISTER(rm);
-                        INT32 rs_val = (INT32)GET_REGISTER(rs);
-                        INT32 rn_val = (INT32)GET_REGISTER(rn);
-                        INT16 operand1, operand2;
+                    break;
+                }
+                /* ARMv5TE: Enhanced DSP multiply instructions */
+                case ARM7_OP_SMLAXY:
+                {
+                    UINT32 rm = insn & 0x0f;
+                    UINT32 rs = (insn >> 8) & 0x0f;
+                    UINT32 rn = (insn >> 12) & 0x0f;
+                    UINT32 rd = (insn >> 16) & 0x0f;
+                    INT32 rm_val = (INT32)GET_REGISTER(rm);
+                    INT32 rs_val = (INT32)GET_REGISTER(rs);
+                    INT32 rn_val = (INT32)GET_REGISTER(rn);
+                    INT16 operand1, operand2;
 
-                        operand1 = (insn & 0x20) ? (INT16)(rm_val >> 16) : (INT16)(rm_val & 0xffff);
-                        operand2 = (insn & 0x40) ? (INT16)(rs_val >> 16) : (INT16)(rs_val & 0xffff);
-                        INT64 result = (INT64)operand1 * operand2 + rn_val;
-                        SET_REGISTER(rd, (UINT32)result);
-                        R15 += 4;
-                    }
-                    else if ((insn & 0x0ff00090) == 0x01400080)  /* SMLALxy */
-                    {
-                        UINT32 rm = insn & 0x0f;
-                        UINT32 rs = (insn >> 8) & 0x0f;
-                        UINT32 rdlo = (insn >> 12) & 0x0f;
-                        UINT32 rdhi = (insn >> 16) & 0x0f;
-                        INT16 operand1 = (insn & 0x20) ? (INT16)(GET_REGISTER(rm) >> 16) : (INT16)(GET_REGISTER(rm) & 0xffff);
-                        INT16 operand2 = (insn & 0x40) ? (INT16)(GET_REGISTER(rs) >> 16) : (INT16)(GET_REGISTER(rs) & 0xffff);
-                        INT64 acc = ((INT64)(INT32)GET_REGISTER(rdhi) << 32) | GET_REGISTER(rdlo);
-                        INT64 result = acc + (INT64)operand1 * operand2;
-                        SET_REGISTER(rdlo, (UINT32)(result & 0xffffffff));
-                        SET_REGISTER(rdhi, (UINT32)(result >> 32));
-                        R15 += 4;
-                    }
-                    else if ((insn & 0x0ff00090) == 0x01600080)  /* SMULxy */
-                    {
-                        UINT32 rm = insn & 0x0f;
-                        UINT32 rs = (insn >> 8) & 0x0f;
-                        UINT32 rd = (insn >> 16) & 0x0f;
-                        INT32 rm_val = (INT32)GET_REGISTER(rm);
-                        INT32 rs_val = (INT32)GET_REGISTER(rs);
-                        INT16 operand1, operand2;
-                        INT32 result;
+                    operand1 = (insn & 0x20) ? (INT16)(rm_val >> 16) : (INT16)(rm_val & 0xffff);
+                    operand2 = (insn & 0x40) ? (INT16)(rs_val >> 16) : (INT16)(rs_val & 0xffff);
+                    INT64 result = (INT64)operand1 * operand2 + rn_val;
+                    SET_REGISTER(rd, (UINT32)result);
+                    R15 += 4;
+                    break;
+                }
+                case ARM7_OP_SMLALXY:
+                {
+                    UINT32 rm = insn & 0x0f;
+                    UINT32 rs = (insn >> 8) & 0x0f;
+                    UINT32 rdlo = (insn >> 12) & 0x0f;
+                    UINT32 rdhi = (insn >> 16) & 0x0f;
+                    INT16 operand1 = (insn & 0x20) ? (INT16)(GET_REGISTER(rm) >> 16) : (INT16)(GET_REGISTER(rm) & 0xffff);
+                    INT16 operand2 = (insn & 0x40) ? (INT16)(GET_REGISTER(rs) >> 16) : (INT16)(GET_REGISTER(rs) & 0xffff);
+                    INT64 acc = ((INT64)(INT32)GET_REGISTER(rdhi) << 32) | GET_REGISTER(rdlo);
+                    INT64 result = acc + (INT64)operand1 * operand2;
+                    SET_REGISTER(rdlo, (UINT32)(result & 0xffffffff));
+                    SET_REGISTER(rdhi, (UINT32)(result >> 32));
+                    R15 += 4;
+                    break;
+                }
+                case ARM7_OP_SMULXY:
+                {
+                    UINT32 rm = insn & 0x0f;
+                    UINT32 rs = (insn >> 8) & 0x0f;
+                    UINT32 rd = (insn >> 16) & 0x0f;
+                    INT32 rm_val = (INT32)GET_REGISTER(rm);
+                    INT32 rs_val = (INT32)GET_REGISTER(rs);
+                    INT16 operand1, operand2;
+                    INT32 result;
 
-                        operand1 = (insn & 0x20) ? (INT16)(rm_val >> 16) : (INT16)(rm_val & 0xffff);
-                        operand2 = (insn & 0x40) ? (INT16)(rs_val >> 16) : (INT16)(rs_val & 0xffff);
-                        result = (INT32)operand1 * operand2;
-                        SET_REGISTER(rd, (UINT32)result);
-                        R15 += 4;
-                    }
-                    else if ((insn & 0x0ff000b0) == 0x012000a0)  /* SMULWy */
-                    {
-                        UINT32 rm = insn & 0x0f;
-                        UINT32 rs = (insn >> 8) & 0x0f;
-                        UINT32 rd = (insn >> 16) & 0x0f;
-                        INT32 rm_val = (INT32)GET_REGISTER(rm);
-                        INT32 rs_val = (INT32)GET_REGISTER(rs);
-                        INT16 operand2;
+                    operand1 = (insn & 0x20) ? (INT16)(rm_val >> 16) : (INT16)(rm_val & 0xffff);
+                    operand2 = (insn & 0x40) ? (INT16)(rs_val >> 16) : (INT16)(rs_val & 0xffff);
+                    result = (INT32)operand1 * operand2;
+                    SET_REGISTER(rd, (UINT32)result);
+                    R15 += 4;
+                    break;
+                }
+                case ARM7_OP_SMULWY:
+                {
+                    UINT32 rm = insn & 0x0f;
+                    UINT32 rs = (insn >> 8) & 0x0f;
+                    UINT32 rd = (insn >> 16) & 0x0f;
+                    INT32 rm_val = (INT32)GET_REGISTER(rm);
+                    INT32 rs_val = (INT32)GET_REGISTER(rs);
+                    INT16 operand2;
 
-                        operand2 = (insn & 0x40) ? (INT16)(rs_val >> 16) : (INT16)(rs_val & 0xffff);
-                        INT32 result = (INT32)(((INT64)rm_val * operand2) >> 16);
-                        SET_REGISTER(rd, (UINT32)result);
-                        R15 += 4;
-                    }
-                    else if ((insn & 0x0ff000b0) == 0x01200080)  /* SMLAWy */
-                    {
-                        UINT32 rm = insn & 0x0f;
-                        UINT32 rs = (insn >> 8) & 0x0f;
-                        UINT32 rn = (insn >> 12) & 0x0f;
-                        UINT32 rd = (insn >> 16) & 0x0f;
-                        INT32 rm_val = (INT32)GET_REGISTER(rm);
-                        INT32 rs_val = (INT32)GET_REGISTER(rs);
-                        INT32 rn_val = (INT32)GET_REGISTER(rn);
-                        INT16 operand2;
+                    operand2 = (insn & 0x40) ? (INT16)(rs_val >> 16) : (INT16)(rs_val & 0xffff);
+                    INT32 result = (INT32)(((INT64)rm_val * operand2) >> 16);
+                    SET_REGISTER(rd, (UINT32)result);
+                    R15 += 4;
+                    break;
+                }
+                case ARM7_OP_SMLAWY:
+                {
+                    UINT32 rm = insn & 0x0f;
+                    UINT32 rs = (insn >> 8) & 0x0f;
+                    UINT32 rn = (insn >> 12) & 0x0f;
+                    UINT32 rd = (insn >> 16) & 0x0f;
+                    INT32 rm_val = (INT32)GET_REGISTER(rm);
+                    INT32 rs_val = (INT32)GET_REGISTER(rs);
+                    INT32 rn_val = (INT32)GET_REGISTER(rn);
+                    INT16 operand2;
 
-                        operand2 = (insn & 0x40) ? (INT16)(rs_val >> 16) : (INT16)(rs_val & 0xffff);
-                        INT64 result = (INT64)rm_val * operand2;
-                        result = (result >> 16) + rn_val;
-                        SET_REGISTER(rd, (UINT32)result);
-                        R15 += 4;
-                    }
-                    else
-                    /* ARMv5TE: Saturated arithmetic: QADD, QSUB, QDADD, QDSUB */
-                    if ((insn & 0x0f9000f0) == 0x01000050)
-                    {
-                        UINT32 rm = insn & 0x0f;
-                        UINT32 rn = (insn >> 16) & 0x0f;
-                        UINT32 rd = (insn >> 12) & 0x0f;
-                        INT32 rm_val = (INT32)GET_REGISTER(rm);
-                        INT32 rn_val = (INT32)GET_REGISTER(rn);
-                        INT64 result;
-                        INT32 doubled;
+                    operand2 = (insn & 0x40) ? (INT16)(rs_val >> 16) : (INT16)(rs_val & 0xffff);
+                    INT64 result = (INT64)rm_val * operand2;
+                    result = (result >> 16) + rn_val;
+                    SET_REGISTER(rd, (UINT32)result);
+                    R15 += 4;
+                    break;
+                }
+                /* ARMv5TE: Saturated arithmetic: QADD, QSUB, QDADD, QDSUB */
+                case ARM7_OP_QARITH:
+                {
+                    UINT32 rm = insn & 0x0f;
+                    UINT32 rn = (insn >> 16) & 0x0f;
+                    UINT32 rd = (insn >> 12) & 0x0f;
+                    INT32 rm_val = (INT32)GET_REGISTER(rm);
+                    INT32 rn_val = (INT32)GET_REGISTER(rn);
+                    INT64 result;
+                    INT32 doubled;
 
-                        switch ((insn >> 21) & 3) {
-                            case 0: /* QADD */
-                                result = (INT64)rm_val + rn_val;
-                                if (result > 0x7fffffffLL) result = 0x7fffffff;
-                                else if (result < -0x80000000LL) result = (INT32)0x80000000u;
-                                break;
-                            case 1: /* QSUB */
-                                result = (INT64)rm_val - rn_val;
-                                if (result > 0x7fffffffLL) result = 0x7fffffff;
-                                else if (result < -0x80000000LL) result = (INT32)0x80000000u;
-                                break;
-                            case 2: /* QDADD */
-                                doubled = rn_val * 2;
-                                if ((INT64)rn_val * 2 != doubled) doubled = (rn_val < 0) ? (INT32)0x80000000u : 0x7fffffff;
-                                result = (INT64)rm_val + doubled;
-                                if (result > 0x7fffffffLL) result = 0x7fffffff;
-                                else if (result < -0x80000000LL) result = (INT32)0x80000000u;
-                                break;
-                            default: /* QDSUB */
-                                doubled = rn_val * 2;
-                                if ((INT64)rn_val * 2 != doubled) doubled = (rn_val < 0) ? (INT32)0x80000000u : 0x7fffffff;
-                                result = (INT64)rm_val - doubled;
-                                if (result > 0x7fffffffLL) result = 0x7fffffff;
-                                else if (result < -0x80000000LL) result = (INT32)0x80000000u;
-                                break;
-                        }
-                        SET_REGISTER(rd, (UINT32)(INT32)result);
-                        R15 += 4;
+                    switch ((insn >> 21) & 3) {
+                        case 0: /* QADD */
+                            result = (INT64)rm_val + rn_val;
+                            if (result > 0x7fffffffLL) result = 0x7fffffff;
+                            else if (result < -0x80000000LL) result = (INT32)0x80000000u;
+                            break;
+                        case 1: /* QSUB */
+                            result = (INT64)rm_val - rn_val;
+                            if (result > 0x7fffffffLL) result = 0x7fffffff;
+                            else if (result < -0x80000000LL) result = (INT32)0x80000000u;
+                            break;
+                        case 2: /* QDADD */
+                            doubled = rn_val * 2;
+                            if ((INT64)rn_val * 2 != doubled) doubled = (rn_val < 0) ? (INT32)0x80000000u : 0x7fffffff;
+                            result = (INT64)rm_val + doubled;
+                            if (result > 0x7fffffffLL) result = 0x7fffffff;
+                            else if (result < -0x80000000LL) result = (INT32)0x80000000u;
+                            break;
+                        default: /* QDSUB */
+                            doubled = rn_val * 2;
+                            if ((INT64)rn_val * 2 != doubled) doubled = (rn_val < 0) ? (INT32)0x80000000u : 0x7fffffff;
+                            result = (INT64)rm_val - doubled;
+                            if (result > 0x7fffffffLL) result = 0x7fffffff;
+                            else if (result < -0x80000000LL) result = (INT32)0x80000000u;
+                            break;
                     }
-                    else
+                    SET_REGISTER(rd, (UINT32)(INT32)result);
+                    R15 += 4;
+                    break;
+                }
 #else
-                    /* Branch and Exchange (BX) */
-                    if ((insn & 0x0ffffff0) == 0x012fff10)     // bits 27-4 == 000100101111111111110001
-                    {
-                        R15 = GET_REGISTER(insn & 0x0f);
-                        // If new PC address has A0 set, switch to Thumb mode
-                        if (R15 & 1) {
-                            SET_CPSR(GET_CPSR|T_MASK);
-                            R15--;
-                        }
+                /* Branch and Exchange (BX) */
+                case ARM7_OP_BX:
+                    R15 = GET_REGISTER(insn & 0x0f);
+                    // If new PC address has A0 set, switch to Thumb mode
+                    if (R15 & 1) {
+                        SET_CPSR(GET_CPSR|T_MASK);
+                        R15--;
                     }
-                    else
+                    break;
 #endif
-                    /* Multiply OR Swap OR Half Word Data Transfer */
-                    if ((insn & 0x0e000000) == 0 && (insn & 0x80) && (insn & 0x10))  // bits 27-25=000 bit 7=1 bit 4=1
-                    {
-                        /* Half Word Data Transfer */
-                        if (insn & 0x60)         // bits = 6-5 != 00
-                        {
-                            HandleHalfWordDT(insn);
-                        }
-                        else
-                        /* Swap */
-                        if (insn & 0x01000000)   // bit 24 = 1
-                        {
-                            HandleSwap(insn);
-                        }
-                        /* Multiply Or Multiply Long */
-                        else
-                        {
-                            /* multiply long */
-                            if (insn & 0x800000) // Bit 23 = 1 for Multiply Long
-                            {
-                                /* Signed? */
-                                if (insn & 0x00400000)
-                                    HandleSMulLong(insn);
-                                else
-                                    HandleUMulLong(insn);
-                            }
-                            /* multiply */
-                            else
-                            {
-                                HandleMul(insn);
-                            }
-                            R15 += 4;
-                        }
-                    }
-                    else
-                    /* Data Processing OR PSR Transfer */
-                    if ((insn & 0x0c000000) == 0)   // bits 27-26 == 00 - This check can only exist properly after Multiplication check above
-                    {
-                        /* PSR Transfer (MRS & MSR) */
-                        if (((insn & 0x00100000) == 0) && ((insn & 0x01800000) == 0x01000000)) // S bit must be clear, and bit 24,23 = 10
-                        {
-                            HandlePSRTransfer(insn);
-                            ARM7_ICOUNT += 2;       // PSR only takes 1 - S Cycle, so we add + 2, since at end, we -3..
-                            R15 += 4;
-                        }
-                        /* Data Processing */
-                        else
-                        {
-                            HandleALU(insn);
-                        }
-                    }
+                /* Half Word Data Transfer */
+                case ARM7_OP_HALFDT:
+                    HandleHalfWordDT(insn);
+                    break;
+                /* Swap */
+                case ARM7_OP_SWAP:
+                    HandleSwap(insn);
+                    break;
+                /* Multiply Or Multiply Long */
+                case ARM7_OP_SMULL:
+                    HandleSMulLong(insn);
+                    R15 += 4;
+                    break;
+                case ARM7_OP_UMULL:
+                    HandleUMulLong(insn);
+                    R15 += 4;
+                    break;
+                case ARM7_OP_MUL:
+                    HandleMul(insn);
+                    R15 += 4;
+                    break;
+                /* PSR Transfer (MRS & MSR) */
+                case ARM7_OP_PSR:
+                    HandlePSRTransfer(insn);
+                    ARM7_ICOUNT += 2;       // PSR only takes 1 - S Cycle, so we add + 2, since at end, we -3..
+                    R15 += 4;
+                    break;
+                /* Data Processing */
+                case ARM7_OP_ALU:
+                    HandleALU(insn);
                     break;
                 /* Data Transfer - Single Data Access */
-                case 4:
-                case 5:
-                case 6:
-                case 7:
+                case ARM7_OP_MEMSINGLE:
                     HandleMemSingle(insn);
                     R15 += 4;
                     break;
                 /* Block Data Transfer/Access */
-                case 8:
-                case 9:
+                case ARM7_OP_MEMBLOCK:
                     HandleMemBlock(insn);
                     R15 += 4;
                     break;
                 /* Branch or Branch & Link */
-                case 0xa:
-                case 0xb:
+                case ARM7_OP_BRANCH:
                     HandleBranch(insn);
                     break;
                 /* Co-Processor Data Transfer */
-                case 0xc:
-                case 0xd:
+                case ARM7_OP_CPDT:
                     HandleCoProcDT(insn);
                     R15 += 4;
                     break;
-                /* Co-Processor Data Operation or Register Transfer */
-                case 0xe:
-                    if (insn & 0x10)
-                        HandleCoProcRT(insn);
-                    else
-                        HandleCoProcDO(insn);
+                /* Co-Processor Register Transfer */
+                case ARM7_OP_CPRT:
+                    HandleCoProcRT(insn);
+                    R15 += 4;
+                    break;
+                /* Co-Processor Data Operation */
+                case ARM7_OP_CPDO:
+                    HandleCoProcDO(insn);
                     R15 += 4;
                     break;
                 /* Software Interrupt */
-                case 0x0f:
+                case ARM7_OP_SWI:
                     ARM7.pendingSwi = 1;
                     ARM7_CHECKIRQ;
                     //couldn't find any cycle counts for SWI
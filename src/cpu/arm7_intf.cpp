@@ -29,6 +29,8 @@ static UINT8  (*pReadByteHandler)(UINT32) = NULL;
 static UINT32 Arm7IdleLoop = ~0;
 
 extern void arm7_set_irq_line(INT32 irqline, INT32 state);
+extern void arm7_fetch_flush();
+extern void arm7_exit();
 
 static void core_set_irq(INT32 /*cpu*/, INT32 irqline, INT32 state)
 {
@@ -75,6 +77,8 @@ void Arm7Exit() // only one cpu supported
 	}
 
 	Arm7IdleLoop = ~0;
+
+	arm7_exit();
 	
 	DebugCPU_ARM7Initted = 0;
 }
@@ -95,6 +99,8 @@ void Arm7MapMemory(UINT8 *src, UINT32 start, UINT32 finish, INT32 type)
 		if (type & (1 << WRITE)) membase[WRITE][offset] = src + (i << PAGE_SHIFT);
 		if (type & (1 << FETCH)) membase[FETCH][offset] = src + (i << PAGE_SHIFT);
 	}
+
+	if (type & (1 << FETCH)) arm7_fetch_flush();
 }
 
 void Arm7SetWriteByteHandler(void (*write)(UINT32, UINT8))
@@ -345,6 +351,19 @@ UINT32 Arm7FetchLong(UINT32 addr)
 	return 0;
 }
 
+// Host page behind opcode fetches at addr for the pre-decoded path, NULL when
+// the fetch has to go through Arm7FetchLong/Word (handler or idle loop page)
+UINT8 *Arm7GetFetchPage(UINT32 addr)
+{
+	addr &= MAX_MEMORY_AND;
+
+	if ((addr >> PAGE_SHIFT) == (Arm7IdleLoop >> PAGE_SHIFT)) {
+		return NULL;
+	}
+
+	return membase[FETCH][addr >> PAGE_SHIFT];
+}
+
 void Arm7SetIRQLine(INT32 line, INT32 state)
 {
 #if defined FBNEO_DEBUG
@@ -369,6 +388,8 @@ void Arm7SetIdleLoopAddress(UINT32 address)
 #endif
 
 	Arm7IdleLoop = address;
+
+	arm7_fetch_flush();
 }
 
 
@@ -7,6 +7,7 @@ UINT16 Arm7ReadWord(UINT32 addr);
 UINT32 Arm7ReadLong(UINT32 addr);
 UINT16 Arm7FetchWord(UINT32 addr);
 UINT32 Arm7FetchLong(UINT32 addr);
+UINT8 *Arm7GetFetchPage(UINT32 addr);
 
 void Arm7RunEnd();
 void Arm7RunEndEatCycles();
@@ -29,6 +29,7 @@
 #define Arm7ReadLong          Arm9ReadLong
 #define Arm7FetchWord         Arm9FetchWord
 #define Arm7FetchLong         Arm9FetchLong
+#define Arm7GetFetchPage      Arm9GetFetchPage
 #define Arm7RunEndEatCycles   Arm9RunEndEatCycles
 
 // ---------------------------------------------------------------------------
@@ -211,6 +212,16 @@ void arm9_set_irq_line(int irqline, int state)
 	arm7_core_set_irq_line(irqline, state);
 }
 
+void arm9_exit()
+{
+	arm7_decode_exit();
+}
+
+void arm9_fetch_flush()
+{
+	arm7_decode_flush();
+}
+
 UINT32 Arm9DbgGetPC()
 {
 	return arm9.sArmRegister[eR15];
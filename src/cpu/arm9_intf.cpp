@@ -32,6 +32,8 @@ static UINT8  (*pReadByteHandler)(UINT32) = NULL;
 static UINT32 Arm9IdleLoop = ~0;
 
 extern void arm9_set_irq_line(INT32 irqline, INT32 state);
+extern void arm9_fetch_flush();
+extern void arm9_exit();
 
 static void core_set_irq(INT32 /*cpu*/, INT32 irqline, INT32 state)
 {
@@ -79,6 +81,8 @@ void Arm9Exit()
 
 	Arm9IdleLoop = ~0;
 
+	arm9_exit();
+
 	DebugCPU_ARM9Initted = 0;
 }
 
@@ -98,6 +102,8 @@ void Arm9UnmapMemory(UINT32 start, UINT32 finish, INT32 type)
 		if (type & (1 << WRITE)) membase[WRITE][offset] = NULL;
 		if (type & (1 << FETCH)) membase[FETCH][offset] = NULL;
 	}
+
+	if (type & (1 << FETCH)) arm9_fetch_flush();
 }
 
 void Arm9MapMemory(UINT8 *src, UINT32 start, UINT32 finish, INT32 type)
@@ -116,6 +122,8 @@ void Arm9MapMemory(UINT8 *src, UINT32 start, UINT32 finish, INT32 type)
 		if (type & (1 << WRITE)) membase[WRITE][offset] = src + (i << PAGE_SHIFT);
 		if (type & (1 << FETCH)) membase[FETCH][offset] = src + (i << PAGE_SHIFT);
 	}
+
+	if (type & (1 << FETCH)) arm9_fetch_flush();
 }
 
 void Arm9SetWriteByteHandler(void (*write)(UINT32, UINT8))
@@ -323,6 +331,19 @@ UINT32 Arm9FetchLong(UINT32 addr)
 	return 0;
 }
 
+// Host page behind opcode fetches at addr for the pre-decoded path, NULL when
+// the fetch has to go through Arm9FetchLong/Word (handler or idle loop page)
+UINT8 *Arm9GetFetchPage(UINT32 addr)
+{
+	addr &= MAX_MEMORY_AND;
+
+	if ((addr >> PAGE_SHIFT) == (Arm9IdleLoop >> PAGE_SHIFT)) {
+		return NULL;
+	}
+
+	return membase[FETCH][addr >> PAGE_SHIFT];
+}
+
 void Arm9SetIRQLine(INT32 line, INT32 state)
 {
 #if defined FBNEO_DEBUG
@@ -345,6 +366,8 @@ void Arm9SetIdleLoopAddress(UINT32 address)
 	if (!DebugCPU_ARM9Initted) bprintf(PRINT_ERROR, _T("Arm9SetIdleLoopAddress called without init\n"));
 #endif
 	Arm9IdleLoop = address;
+
+	arm9_fetch_flush();
 }
 
 void Arm9_write_rom_byte(UINT32 addr, UINT8 data)
@@ -11,6 +11,7 @@ UINT16 Arm9ReadWord(UINT32 addr);
 UINT32 Arm9ReadLong(UINT32 addr);
 UINT16 Arm9FetchWord(UINT32 addr);
 UINT32 Arm9FetchLong(UINT32 addr);
+UINT8 *Arm9GetFetchPage(UINT32 addr);
 
 void Arm9RunEnd();
 void Arm9RunEndEatCycles();
@@ -23,10 +23,98 @@ static INT32 current_num_cycles = 0;
 #define MAP_PAGE_MASK	0xfff
 #define MAP_MASK		0xfffff
 
+/* Decoded-instruction cache
+
+   Instructions fetched from directly mapped (memmap[0]) pages are decoded once
+   and kept per linear address: the raw bytes, the handler left after the prefix
+   bytes and the addressing form of the modrm operand.  Entries are keyed on CS.d
+   and only used while paging is off, so a mode or segment change just misses.
+   A page holding cached code has an odd count in dc_page_gen[], any write to it
+   bumps the count and drops the page's entries (i386InvalidateCode() does the
+   same for memory changed behind the cpu's back, e.g. RAM restored from a save
+   state).  Handlers still do their own CYCLES(), the prefixes are replayed
+   together with theirs. */
+
+#define DC_BITS			14
+#define DC_ENTRIES		(1 << DC_BITS)
+#define DC_MAXLEN		16
+#define DC_MAXPREFIX	4
+
+enum { DC_PFX_OSIZE = 0, DC_PFX_ASIZE, DC_PFX_LOCK, DC_PFX_CS, DC_PFX_DS, DC_PFX_ES, DC_PFX_FS, DC_PFX_GS, DC_PFX_SS };
+
+typedef struct {
+	UINT32 pc;
+	UINT32 gen;					// dc_page_gen[] of the page when decoded
+	void (*handler)(void);		// handler after the prefixes / 0x0f
+	INT32 ea_disp;
+	UINT8 key;					// CS.d + 1, 0 = empty
+	UINT8 len;					// bytes fetched by the instruction
+	UINT8 head;					// prefix and opcode bytes
+	UINT8 opcode;
+	UINT8 nprefix;
+	UINT8 prefix[DC_MAXPREFIX];
+	UINT8 ea_pos;				// offset of the byte after modrm, 0 = no cached EA
+	UINT8 ea_len;
+	UINT8 ea_modrm;
+	UINT8 ea_asize;
+	UINT8 ea_base;				// REG32() / REG16() index, 0xff = none
+	UINT8 ea_index;
+	UINT8 ea_scale;
+	UINT8 ea_seg;
+	UINT8 bytes[DC_MAXLEN];
+} I386_DECODED;
+
+static I386_DECODED *dc_cache = NULL;
+static UINT32 *dc_page_gen = NULL;
+
+static I386_DECODED *dc_cur;	// entry being replayed / recorded
+static UINT8 *dc_bytes;
+static UINT32 dc_base;			// linear address of dc_bytes[0]
+static UINT32 dc_avail = 0;		// bytes FETCH*() may take from dc_bytes
+static INT32 dc_recording = 0;
+static UINT32 dc_rec_len;
+static I386_DECODED dc_rec;
+
+static void dc_flush()
+{
+	if (dc_cache) memset(dc_cache, 0, DC_ENTRIES * sizeof(I386_DECODED));
+}
+
+INLINE void dc_write_check(UINT32 address)
+{
+	UINT32 *gen = &dc_page_gen[address >> MAP_PAGE_SHIFT];
+
+	if (*gen & 1) *gen += 1;
+}
+
+// called by FETCH*() for bytes not taken from the cache while an instruction is recorded
+static void dc_record(UINT32 pc, UINT32 value, UINT32 n)
+{
+	UINT32 off = pc - dc_base;
+
+	// gaps (branch taken mid-instruction), page crossings and overlong
+	// instructions are not cached
+	if (off > dc_rec_len || off > DC_MAXLEN - n || ((pc + n - 1) ^ dc_base) >> MAP_PAGE_SHIFT) {
+		dc_recording = 0;
+		return;
+	}
+
+	for (UINT32 i = 0; i < n; i++) {
+		dc_rec.bytes[off + i] = (value >> (i * 8)) & 0xff;
+	}
+
+	if (off + n > dc_rec_len) dc_rec_len = off + n;
+}
+
 static void map_init()
 {
 	memmap[0] = (UINT8**)BurnMalloc((MAP_MASK + 1) * sizeof(UINT8**));
 	memmap[1] = (UINT8**)BurnMalloc((MAP_MASK + 1) * sizeof(UINT8**));
+
+	dc_cache = (I386_DECODED*)BurnMalloc(DC_ENTRIES * sizeof(I386_DECODED));
+	dc_page_gen = (UINT32*)BurnMalloc((MAP_MASK + 1) * sizeof(UINT32));
+	memset(dc_page_gen, 0, (MAP_MASK + 1) * sizeof(UINT32));
+	dc_flush();
 }
 
 static UINT8 (*program_read_byte)(UINT32) = NULL;
@@ -62,6 +150,14 @@ void i386MapMemory(UINT8 *mem, UINT64 start, UINT64 end, UINT32 flags)
 	for (UINT64 i = start; i < end; i += (1 << MAP_PAGE_SHIFT)) {
 		if (flags & MAP_ROM) memmap[0][i >> MAP_PAGE_SHIFT] = mem == NULL ? NULL : (mem + (i - start));
 		if (flags & MAP_WRITE) memmap[1][i >> MAP_PAGE_SHIFT] = mem == NULL ? NULL : (mem + (i - start));
+		dc_write_check((UINT32)i);
+	}
+}
+
+void i386InvalidateCode(UINT32 start, UINT32 end)
+{
+	for (UINT64 i = start & ~MAP_PAGE_MASK; i <= end; i += (1 << MAP_PAGE_SHIFT)) {
+		dc_write_check((UINT32)i);
 	}
 }
 
@@ -121,6 +217,8 @@ UINT32 i386ReadLong(UINT32 address)
 
 static void program_write_byte_32le(UINT32 address, UINT8 data)
 {
+	dc_write_check(address);
+
 	if (memmap[1][address >> MAP_PAGE_SHIFT]) {
 		memmap[1][address >> MAP_PAGE_SHIFT][address & MAP_PAGE_MASK] = data;
 		return;
@@ -136,6 +234,8 @@ static void program_write_byte_32le(UINT32 address, UINT8 data)
 
 static void program_write_word_32le(UINT32 address, UINT16 data)
 {
+	dc_write_check(address);
+
 	UINT16 *ptr = (UINT16*)memmap[1][address >> MAP_PAGE_SHIFT];
 	if (ptr) {
 		ptr[(address & MAP_PAGE_MASK) / 2] = BURN_ENDIAN_SWAP_INT16(data);
@@ -152,6 +252,8 @@ static void program_write_word_32le(UINT32 address, UINT16 data)
 
 static void program_write_dword_32le(UINT32 address, UINT32 data)
 {
+	dc_write_check(address);
+
 	UINT32 *ptr = (UINT32*)memmap[1][address >> MAP_PAGE_SHIFT];
 
 	if (ptr) {
@@ -250,6 +352,8 @@ static void io_write_dword_32le(UINT32 address, UINT32 data)
 
 static void cheat_write_byte(UINT32 address, UINT8 data)
 {
+	dc_write_check(address);
+
 	if (memmap[0][address >> 12]) memmap[0][address >> 12][address & 0xfff] = data;
 	if (memmap[1][address >> 12]) memmap[1][address >> 12][address & 0xfff] = data;
 
@@ -393,10 +497,30 @@ static void modrm_to_EA(UINT8 mod_rm, UINT32* out_ea, UINT8* out_segment)
 	UINT8 rm = mod_rm & 0x7;
 	UINT32 ea;
 	UINT8 segment;
+	UINT32 rec_pos = I.pc - dc_base;
 
 	//if( mod_rm >= 0xc0 )
 	//	osd_die("i386: Called modrm_to_EA with modrm value %02X !\n",mod_rm);
 
+	if( rec_pos < dc_avail && rec_pos == dc_cur->ea_pos && mod_rm == dc_cur->ea_modrm && I.address_size == dc_cur->ea_asize ) {
+		/* addressing form taken from the decoded-instruction cache */
+		ea = dc_cur->ea_disp;
+		if( I.address_size ) {
+			if( dc_cur->ea_base != 0xff ) ea += REG32(dc_cur->ea_base);
+			if( dc_cur->ea_index != 0xff ) ea += REG32(dc_cur->ea_index) << dc_cur->ea_scale;
+		} else {
+			if( dc_cur->ea_base != 0xff ) ea += REG16(dc_cur->ea_base);
+			if( dc_cur->ea_index != 0xff ) ea += REG16(dc_cur->ea_index);
+			ea &= 0xffff;
+		}
+		I.eip += dc_cur->ea_len;
+		I.pc += dc_cur->ea_len;
+
+		*out_ea = ea;
+		*out_segment = I.segment_prefix ? I.segment_override : dc_cur->ea_seg;
+		return;
+	}
+
 	if( I.address_size ) {
 		switch( rm )
 		{
@@ -463,6 +587,13 @@ static void modrm_to_EA(UINT8 mod_rm, UINT32* out_ea, UINT8* out_segment)
 		*out_ea = ea & 0xffff;
 		*out_segment = segment;
 	}
+
+	if( dc_recording && dc_rec.ea_pos == 0 ) {
+		dc_rec.ea_pos = rec_pos;
+		dc_rec.ea_len = (I.pc - dc_base) - rec_pos;
+		dc_rec.ea_modrm = mod_rm;
+		dc_rec.ea_asize = I.address_size;
+	}
 }
 
 static UINT32 GetNonTranslatedEA(UINT8 modrm)
@@ -659,6 +790,189 @@ static void I386OP(decode_two_byte)(void)
 		I.opcode_table2_16[I.opcode]();
 }
 
+/* Decoded-instruction cache: execute / record */
+
+static void dc_store(I386_DECODED *dc, UINT32 pc, UINT32 gen, UINT8 key)
+{
+	I386_DECODED *r = &dc_rec;
+	UINT8 os = key - 1;
+	UINT32 i, p;
+	void (*h)(void) = NULL;
+	static const UINT8 regs16_base[8] = { BX, BX, BP, BP, SI, DI, BP, BX };
+	static const UINT8 regs16_index[8] = { SI, DI, SI, DI, 0xff, 0xff, 0xff, 0xff };
+	static const UINT8 regs32[8] = { EAX, ECX, EDX, EBX, ESP, EBP, ESI, EDI };
+
+	r->nprefix = 0;
+	for (i = 0; i < dc_rec_len; i++)
+	{
+		UINT8 act;
+		h = os ? I.opcode_table1_32[r->bytes[i]] : I.opcode_table1_16[r->bytes[i]];
+
+		if (h == I386OP(operand_size)) { act = DC_PFX_OSIZE; os ^= 1; }
+		else if (h == I386OP(address_size)) act = DC_PFX_ASIZE;
+		else if (h == I386OP(lock)) act = DC_PFX_LOCK;
+		else if (h == I386OP(segment_CS)) act = DC_PFX_CS;
+		else if (h == I386OP(segment_DS)) act = DC_PFX_DS;
+		else if (h == I386OP(segment_ES)) act = DC_PFX_ES;
+		else if (h == I386OP(segment_FS)) act = DC_PFX_FS;
+		else if (h == I386OP(segment_GS)) act = DC_PFX_GS;
+		else if (h == I386OP(segment_SS)) act = DC_PFX_SS;
+		else break;
+
+		if (r->nprefix == DC_MAXPREFIX) return;
+		r->prefix[r->nprefix++] = act;
+	}
+
+	if (i >= dc_rec_len) return;
+
+	r->opcode = r->bytes[i];
+	r->head = i + 1;
+
+	if (h == I386OP(decode_two_byte))
+	{
+		if (r->head >= dc_rec_len) return;
+		r->opcode = r->bytes[r->head];
+		h = os ? I.opcode_table2_32[r->opcode] : I.opcode_table2_16[r->opcode];
+		r->head++;
+	}
+
+	r->handler = h;
+
+	// resolve the first modrm operand into base + (index << scale) + disp
+	if (r->ea_pos)
+	{
+		UINT8 mod = (r->ea_modrm >> 6) & 3;
+		UINT8 rm = r->ea_modrm & 7;
+
+		p = r->ea_pos;
+		r->ea_base = r->ea_index = 0xff;
+		r->ea_scale = 0;
+		r->ea_disp = 0;
+
+		if (p < r->head || p + r->ea_len > dc_rec_len) {
+			r->ea_pos = 0;
+		} else if (r->ea_asize) {
+			if (rm == 4) {
+				UINT8 sib = r->bytes[p++];
+				UINT8 base = sib & 7;
+				if (((sib >> 3) & 7) != 4) {
+					r->ea_index = regs32[(sib >> 3) & 7];
+					r->ea_scale = sib >> 6;
+				}
+				if (base == 5 && mod == 0) {
+					r->ea_disp = r->bytes[p] | (r->bytes[p + 1] << 8) | (r->bytes[p + 2] << 16) | ((UINT32)r->bytes[p + 3] << 24);
+					p += 4;
+					r->ea_seg = DS;
+				} else {
+					r->ea_base = regs32[base];
+					r->ea_seg = (base == 4 || base == 5) ? SS : DS;
+				}
+			} else if (rm == 5 && mod == 0) {
+				r->ea_disp = r->bytes[p] | (r->bytes[p + 1] << 8) | (r->bytes[p + 2] << 16) | ((UINT32)r->bytes[p + 3] << 24);
+				p += 4;
+				r->ea_seg = DS;
+			} else {
+				r->ea_base = regs32[rm];
+				r->ea_seg = (rm == 5) ? SS : DS;
+			}
+
+			if (mod == 1) {
+				r->ea_disp += (INT8)r->bytes[p++];
+			} else if (mod == 2) {
+				r->ea_disp += r->bytes[p] | (r->bytes[p + 1] << 8) | (r->bytes[p + 2] << 16) | ((UINT32)r->bytes[p + 3] << 24);
+				p += 4;
+			}
+		} else {
+			if (rm == 6 && mod == 0) {
+				r->ea_disp = r->bytes[p] | (r->bytes[p + 1] << 8);
+				p += 2;
+				r->ea_seg = DS;
+			} else {
+				r->ea_base = regs16_base[rm];
+				r->ea_index = regs16_index[rm];
+				r->ea_seg = (rm == 2 || rm == 3 || rm == 6) ? SS : DS;
+			}
+
+			if (mod == 1) {
+				r->ea_disp += (INT8)r->bytes[p++];
+			} else if (mod == 2) {
+				r->ea_disp += (INT16)(r->bytes[p] | (r->bytes[p + 1] << 8));
+				p += 2;
+			}
+		}
+
+		if (r->ea_pos && p - r->ea_pos != r->ea_len) r->ea_pos = 0;
+	}
+
+	r->pc = pc;
+	r->gen = gen;
+	r->key = key;
+	r->len = dc_rec_len;
+	memcpy(dc, r, sizeof(I386_DECODED));
+}
+
+static void i386_execute_cached(void)
+{
+	UINT32 pc = I.pc;
+	UINT32 *gen = &dc_page_gen[pc >> MAP_PAGE_SHIFT];
+	I386_DECODED *dc = &dc_cache[pc & (DC_ENTRIES - 1)];
+	UINT8 key = I.sreg[CS].d + 1;
+
+	if (dc->pc == pc && dc->key == key && dc->gen == *gen)
+	{
+		for (INT32 i = 0; i < dc->nprefix; i++)
+		{
+			switch (dc->prefix[i])
+			{
+				case DC_PFX_OSIZE: I.operand_size ^= 1; break;
+				case DC_PFX_ASIZE: I.address_size ^= 1; break;
+				case DC_PFX_LOCK: CYCLES(CYCLES_LOCK); break;
+				case DC_PFX_CS: I.segment_prefix = 1; I.segment_override = CS; break;
+				case DC_PFX_DS: I.segment_prefix = 1; I.segment_override = DS; CYCLES(0); break;
+				case DC_PFX_ES: I.segment_prefix = 1; I.segment_override = ES; CYCLES(0); break;
+				case DC_PFX_FS: I.segment_prefix = 1; I.segment_override = FS; CYCLES(1); break;
+				case DC_PFX_GS: I.segment_prefix = 1; I.segment_override = GS; CYCLES(1); break;
+				case DC_PFX_SS: I.segment_prefix = 1; I.segment_override = SS; CYCLES(0); break;
+			}
+		}
+
+		dc_cur = dc;
+		dc_bytes = dc->bytes;
+		dc_base = pc;
+		dc_avail = dc->len;
+
+		I.eip += dc->head;
+		I.pc += dc->head;
+		I.opcode = dc->opcode;
+		dc->handler();
+
+		dc_avail = 0;
+		return;
+	}
+
+	if (memmap[0][pc >> MAP_PAGE_SHIFT] == NULL)
+	{
+		I386OP(decode_opcode)();
+		return;
+	}
+
+	*gen |= 1;		// page now holds cached code
+
+	UINT32 start_gen = *gen;
+
+	dc_cur = &dc_rec;
+	dc_base = pc;
+	dc_rec_len = 0;
+	dc_rec.ea_pos = 0;
+	dc_recording = 1;
+
+	I386OP(decode_opcode)();
+
+	// a write to the page while the instruction ran leaves start_gen stale
+	if (dc_recording && dc_rec_len) dc_store(dc, pc, start_gen, key);
+	dc_recording = 0;
+}
+
 /*************************************************************************/
 
 static void i386_postload()
@@ -739,6 +1053,8 @@ void i386Reset()
 
 	CHANGE_PC(I.eip);
 
+	dc_flush();
+
 	cpu_running = 1;
 	current_num_cycles = 0;
 }
@@ -747,6 +1063,8 @@ void i386Exit()
 {
 	BurnFree(memmap[0]);
 	BurnFree(memmap[1]);
+	BurnFree(dc_cache);
+	BurnFree(dc_page_gen);
 
 	for (int j=0; j < X86_NUM_CPUS; j++)
 	{
@@ -919,7 +1237,10 @@ INT32 i386Run(INT32 num_cycles)
 
 	//	CALL_MAME_DEBUG;
 
-		I386OP(decode_opcode)();
+		if ((I.cr[0] & 0x80000000) == 0 && I.a20_mask == 0xffffffff)
+			i386_execute_cached();
+		else
+			I386OP(decode_opcode)();
 	}
 
 	num_cycles = current_num_cycles - I.cycles;
@@ -1090,6 +1411,9 @@ INT32 i386Scan(INT32 nAction)
 		SCAN_VAR(current_num_cycles);
 	}
 
+	// the decoded-instruction cache only goes stale where memory changed: ROM is
+	// not touched by a state load, drivers call i386InvalidateCode() for the RAM
+	// they restore (no flush here, this runs every frame with runahead / rewind)
 	if (nAction & ACB_WRITE) {
 		i386_postload();
 	}
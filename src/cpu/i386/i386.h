@@ -347,12 +347,21 @@ INLINE UINT8 FETCH(void)
 	UINT8 value;
 	UINT32 address = I.pc;
 
+	if ((address - dc_base) < dc_avail)	// replaying a cached instruction
+	{
+		value = dc_bytes[address - dc_base];
+		I.eip++;
+		I.pc++;
+		return value;
+	}
+
 	if (I.cr[0] & 0x80000000)		// page translation enabled
 	{
 		translate_address(&address);
 	}
 
 	value = cpu_readop(address & I.a20_mask);
+	if (dc_recording) dc_record(I.pc, value, 1);
 	I.eip++;
 	I.pc++;
 	return value;
@@ -361,6 +370,15 @@ INLINE UINT16 FETCH16(void)
 {
 	UINT16 value;
 	UINT32 address = I.pc;
+	UINT32 offset = address - dc_base;
+
+	if (offset < dc_avail && dc_avail - offset >= 2)
+	{
+		value = dc_bytes[offset] | (dc_bytes[offset + 1] << 8);
+		I.eip += 2;
+		I.pc += 2;
+		return value;
+	}
 
 	if (I.cr[0] & 0x80000000)		// page translation enabled
 	{
@@ -375,6 +393,7 @@ INLINE UINT16 FETCH16(void)
 		address &= I.a20_mask;
 		value = cpu_readop16(address);
 	}
+	if (dc_recording) dc_record(I.pc, value, 2);
 	I.eip += 2;
 	I.pc += 2;
 	return value;
@@ -383,6 +402,15 @@ INLINE UINT32 FETCH32(void)
 {
 	UINT32 value;
 	UINT32 address = I.pc;
+	UINT32 offset = address - dc_base;
+
+	if (offset < dc_avail && dc_avail - offset >= 4)
+	{
+		value = dc_bytes[offset] | (dc_bytes[offset + 1] << 8) | (dc_bytes[offset + 2] << 16) | ((UINT32)dc_bytes[offset + 3] << 24);
+		I.eip += 4;
+		I.pc += 4;
+		return value;
+	}
 
 	if (I.cr[0] & 0x80000000)		// page translation enabled
 	{
@@ -399,6 +427,7 @@ INLINE UINT32 FETCH32(void)
 		address &= I.a20_mask;
 		value = cpu_readop32(address);
 	}
+	if (dc_recording) dc_record(I.pc, value, 4);
 	I.eip += 4;
 	I.pc += 4;
 	return value;
@@ -7,6 +7,7 @@ void i386Close();
 void i386Reset();
 void i386Init(INT32); // only 1 supported
 void i386MapMemory(UINT8 *mem, UINT64 start, UINT64 end, UINT32 flags);
+void i386InvalidateCode(UINT32 start, UINT32 end); // code memory changed behind the cpu's back
 void i386SetReadHandlers(UINT8 (*read8)(UINT32), UINT16 (*read16)(UINT32), UINT32 (*read32)(UINT32));
 void i386SetWriteHandlers(void (*write8)(UINT32,UINT8), void (*write16)(UINT32,UINT16), void (*write32)(UINT32,UINT32));
 void i386NewFrame();
@@ -16,21 +16,10 @@ namespace tms
 {
 
 
-#define mem_read(addr)  TMS34010ReadWord(addr)
-#define mem_write(addr,v) TMS34010WriteWord(addr,v)
-
-
-static inline dword mem_read_d(dword addr)
-{
-    dword data = mem_read(addr);
-    return data | (mem_read(addr + 16) << 16);
-}
-
-static inline void mem_write_d(dword addr, dword data)
-{
-    mem_write(addr, data);
-    mem_write(addr+16, data >> 16);
-}
+#define mem_read(addr)  TMS34010ReadWordFast(addr)
+#define mem_write(addr,v) TMS34010WriteWordFast(addr,v)
+#define mem_read_d(addr)  TMS34010ReadLongFast(addr)
+#define mem_write_d(addr,v) TMS34010WriteLongFast(addr,v)
 
 
 // Read fields
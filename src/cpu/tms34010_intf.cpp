@@ -9,7 +9,7 @@
 #define PAGE_MASK   0xFFF
 #define PAGE_COUNT  (1 << (ADDR_BITS - PAGE_SHIFT))
 #define PAGE_WADD    (PAGE_COUNT)
-#define MAXHANDLER  32
+#define MAXHANDLER  TMS34010_MAXHANDLER
 #define PFN(x)  (((x) >> PAGE_SHIFT) & 0xFFFFF)
 
 template<typename T>
@@ -35,6 +35,7 @@ struct TMS34010MemoryMap
 };
 
 static TMS34010MemoryMap g_mmap;
+UINT8 **TMS34010PageMap = g_mmap.map;
 
 static UINT16 default_read(UINT32 address) { return ~0; }
 static void default_write(UINT32 address, UINT16 value) {}
@@ -38,6 +38,61 @@ UINT32 TMS34010GetPPC();
 
 UINT16 TMS34010ReadWord(UINT32 address);
 void TMS34010WriteWord(UINT32 address, UINT16 value);
+
+// page map (read pages, then write pages), shared with the core so that accesses
+// to memory mapped with TMS34010MapMemory() don't go through a function call.
+// entries below TMS34010_MAXHANDLER are handler numbers, anything else is a pointer.
+#define TMS34010_PAGE_SHIFT		12
+#define TMS34010_PAGE_MASK		0xfff
+#define TMS34010_PAGE_WADD		(1 << (32 - TMS34010_PAGE_SHIFT))
+#define TMS34010_MAXHANDLER		32
+
+extern UINT8 **TMS34010PageMap;
+
+static inline UINT16 TMS34010ReadWordFast(UINT32 address)
+{
+	UINT8 *pr = TMS34010PageMap[address >> TMS34010_PAGE_SHIFT];
+	if ((uintptr_t)pr >= TMS34010_MAXHANDLER) {
+		return BURN_ENDIAN_SWAP_INT16(*((UINT16*)(pr + ((address & TMS34010_PAGE_MASK) >> 3))));
+	}
+	return TMS34010ReadWord(address);
+}
+
+static inline void TMS34010WriteWordFast(UINT32 address, UINT16 value)
+{
+	UINT8 *pr = TMS34010PageMap[TMS34010_PAGE_WADD + (address >> TMS34010_PAGE_SHIFT)];
+	if ((uintptr_t)pr >= TMS34010_MAXHANDLER) {
+		*((UINT16*)(pr + ((address & TMS34010_PAGE_MASK) >> 3))) = BURN_ENDIAN_SWAP_INT16(value);
+		return;
+	}
+	TMS34010WriteWord(address, value);
+}
+
+// 32-bit access = word at address, word at address + 16, one lookup when both are in the same page
+static inline UINT32 TMS34010ReadLongFast(UINT32 address)
+{
+	UINT8 *pr = TMS34010PageMap[address >> TMS34010_PAGE_SHIFT];
+	if ((uintptr_t)pr >= TMS34010_MAXHANDLER && (address & TMS34010_PAGE_MASK) < 0xff0) {
+		UINT16 *p = (UINT16*)(pr + ((address & TMS34010_PAGE_MASK) >> 3));
+		return BURN_ENDIAN_SWAP_INT16(p[0]) | (BURN_ENDIAN_SWAP_INT16(p[1]) << 16);
+	}
+	UINT32 data = TMS34010ReadWordFast(address);
+	return data | (TMS34010ReadWordFast(address + 16) << 16);
+}
+
+static inline void TMS34010WriteLongFast(UINT32 address, UINT32 data)
+{
+	UINT8 *pr = TMS34010PageMap[TMS34010_PAGE_WADD + (address >> TMS34010_PAGE_SHIFT)];
+	if ((uintptr_t)pr >= TMS34010_MAXHANDLER && (address & TMS34010_PAGE_MASK) < 0xff0) {
+		UINT16 *p = (UINT16*)(pr + ((address & TMS34010_PAGE_MASK) >> 3));
+		p[0] = BURN_ENDIAN_SWAP_INT16((UINT16)data);
+		p[1] = BURN_ENDIAN_SWAP_INT16((UINT16)(data >> 16));
+		return;
+	}
+	TMS34010WriteWordFast(address, data);
+	TMS34010WriteWordFast(address + 16, data >> 16);
+}
+
 void TMS34010MapReset();
 void TMS34010MapMemory(UINT8 *mem, UINT32 start, UINT32 end, UINT8 type);
 void TMS34010MapHandler(uintptr_t num, UINT32 start, UINT32 end, UINT8 type);